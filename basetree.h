@@ -28,12 +28,18 @@
 
 #include "context.h"
 #include "rewritedata.h"
+#include "normprofile.h"
 
 /*
  * Version number of data file
  */
 #define BASETREE_MAGIC 0x20210613
 
+/*
+ * Version number of `normaliseNode()` trace file
+ */
+#define BASETRACE_MAGIC 0x20261017
+
 #if !defined(DEFAULT_MAXNODE)
 /**
  * The maximum number of nodes a writable tree can hold is indicated with the `--maxnode=n` option.
@@ -77,6 +83,37 @@
 #define ENABLE_DEBUG_REWRITE 0
 #endif
 
+/*
+ * `rewriteNode()` walks `rewriteData[]` with a dependent load per transition.
+ * The compact engine caches the walk result per tree, keyed by the packed transitions of the whole Q/T/F neighbourhood.
+ * One probe replaces about 13 dependent loads into a table of several MB.
+ * Set to 0 to default to the plain walk, `baseTree_t::enableRewriteCompact()` can still select it at runtime.
+ * The cache is allocated on first use, trees that never rewrite do not pay for it.
+ */
+#ifndef ENABLE_REWRITE_COMPACT
+#define ENABLE_REWRITE_COMPACT 1
+#endif
+
+#if !defined(REWRITECOMPACT_BITS)
+/**
+ * Size of compact rewrite cache, 16 bytes per entry.
+ *
+ * @constant {number} REWRITECOMPACT_BITS
+ */
+#define REWRITECOMPACT_BITS 16
+#endif
+
+/**
+ * @date 2026-10-17 16:48:20
+ *
+ * Compact rewrite cache entry, direct mapped
+ */
+struct rewriteCompact_t {
+	uint64_t key;   // packed transitions, 0 if unused
+	uint32_t index; // index in `rewriteData[]`
+	uint32_t data;  // `rewriteData[index]`
+};
+
 struct baseNode_t {
 	uint32_t Q;                // the question
 	uint32_t T;                // the answer if true (may be inverted)
@@ -135,6 +172,27 @@ struct baseTreeHeader_t {
 	uint64_t offEnd;
 };
 
+/*
+ * @date 2026-10-17 18:05:12
+ *
+ * Header of `normaliseNode()` trace file, followed by the encoded calls.
+ *
+ * Each call is 4 varints for Q, T, F and the result.
+ * Id's are encoded relative to the highest id encountered so far, recent nodes are short.
+ */
+struct baseTraceHeader_t {
+	uint32_t magic;               // magic+version
+	uint32_t magic_flags;         // flags during recording
+	uint32_t kstart;              // tree layout
+	uint32_t ostart;
+	uint32_t estart;
+	uint32_t nstart;
+	uint32_t ncount;              // number of nodes when recording stopped
+	uint32_t unused1;
+	uint64_t numCalls;            // number of recorded calls
+	uint64_t numBytes;            // length of encoded calls
+};
+
 struct baseTree_t {
 
 	/*
@@ -156,6 +214,22 @@ struct baseTree_t {
 		//@formatter:on
 	};
 
+	/*
+	 * Cascade kinds and bottom reuse for `mergeCascade()`
+	 */
+	enum {
+		//@formatter:off
+		CASCADE_OR = 0,	// Q?!0:F
+		CASCADE_NE,	// Q?!F:F
+		CASCADE_AND,	// Q?T:0
+
+		PREFIX_LEFT = 0,	// merged cascade is bottom of left side
+		PREFIX_RIGHT,	// merged cascade is bottom of right side
+		PREFIX_ANY,	// nothing merged yet
+		PREFIX_NONE,	// merged cascade is new
+		//@formatter:on
+	};
+
 	//@formatter:off
 	// resources
 	context_t  &ctx;		// resource context
@@ -209,7 +283,21 @@ struct baseTree_t {
 	uint32_t   *rewriteMap;         // results of intermediate lookups
 	uint32_t   *rewriteVersion;     // versioned memory for rewrites
 	uint32_t   iVersionRewrite;     // active version number
+	bool       useRewriteCompact;   // select compact engine
+	rewriteCompact_t *rewriteCompact; // compact engine, NULL until first lookup or for plain walk
 	uint64_t   numRewrite;          // number of rewrites performed
+	uint32_t   lastRewriteIndex;    // last `rewriteData[]` index consulted
+	uint64_t   cntRewriteNo;        // rewrites not needed
+	uint64_t   cntRewriteYes;       // rewrites with available components
+	uint64_t   cntRewriteCollapse;  // rewrites collapsing to endpoint
+	uint64_t   cntRewriteTree;      // destructive rewrites
+	uint64_t   cntRewritePower[16]; // rewrites per power
+	// `normaliseNode()` trace
+	FILE       *traceFile;          // recording destination, NULL if not recording
+	uint32_t   traceDepth;          // recursion depth, only top-level calls are recorded
+	uint32_t   traceBase;           // highest id encountered + 1
+	uint64_t   traceNumCalls;       // number of recorded calls
+	uint64_t   traceNumBytes;       // length of encoded calls
 
 	// reserved for evaluator
 
@@ -280,7 +368,20 @@ struct baseTree_t {
 		rewriteMap(NULL),
 		rewriteVersion(NULL),
 		iVersionRewrite(1),
-		numRewrite(0)
+		useRewriteCompact(ENABLE_REWRITE_COMPACT),
+		rewriteCompact(NULL),
+		numRewrite(0),
+		lastRewriteIndex(0),
+		cntRewriteNo(0),
+		cntRewriteYes(0),
+		cntRewriteCollapse(0),
+		cntRewriteTree(0),
+		cntRewritePower(),
+		traceFile(NULL),
+		traceDepth(0),
+		traceBase(0),
+		traceNumCalls(0),
+		traceNumBytes(0)
 	//@formatter:on
 	{
 	}
@@ -341,7 +442,20 @@ struct baseTree_t {
 		rewriteMap(allocMap()),
 		rewriteVersion(allocMap()), // allocate as node-id map because of local version numbering
 		iVersionRewrite(1),
-		numRewrite(0)
+		useRewriteCompact(ENABLE_REWRITE_COMPACT),
+		rewriteCompact(NULL),
+		numRewrite(0),
+		lastRewriteIndex(0),
+		cntRewriteNo(0),
+		cntRewriteYes(0),
+		cntRewriteCollapse(0),
+		cntRewriteTree(0),
+		cntRewritePower(),
+		traceFile(NULL),
+		traceDepth(0),
+		traceBase(0),
+		traceNumCalls(0),
+		traceNumBytes(0)
 	//@formatter:on
 	{
 		if (this->N)
@@ -377,6 +491,9 @@ struct baseTree_t {
 	 * Release system resources
 	 */
 	~baseTree_t() {
+		if (traceFile)
+			stopTrace();
+
 		// release allocations if not mmapped
 		if (allocFlags & ALLOCMASK_NODES)
 			ctx.myFree("baseTree_t::N", this->N);
@@ -402,6 +519,8 @@ struct baseTree_t {
 			freeMap(compNodeL);
 		if (compNodeR)
 			freeMap(compNodeR);
+		if (rewriteCompact)
+			ctx.myFree("baseTree_t::rewriteCompact", rewriteCompact);
 
 		// release pools
 		while (numPoolMap > 0)
@@ -446,6 +565,23 @@ struct baseTree_t {
 		compVersionR     = NULL;
 		rewriteMap       = NULL;
 		rewriteVersion   = NULL;
+		rewriteCompact   = NULL;
+	}
+
+	/*
+	 * @date 2026-10-17 16:56:02
+	 *
+	 * Select compact (cached) or plain walk rewrite engine.
+	 * Both produce identical results.
+	 * The compact cache is allocated by the first `lookupRewrite()`.
+	 */
+	void enableRewriteCompact(bool enable) {
+		useRewriteCompact = enable;
+
+		if (!enable && rewriteCompact) {
+			ctx.myFree("baseTree_t::rewriteCompact", rewriteCompact);
+			rewriteCompact = NULL;
+		}
 	}
 
 	/*
@@ -558,6 +694,7 @@ struct baseTree_t {
 	 *      +3 structure leftHandSide GREATER rightHandSide
 	 */
 	static int compare(baseTree_t *treeL, uint32_t lhs, baseTree_t *treeR, uint32_t rhs) {
+		PERFTIMER(PERF_COMPARE);
 
 		context_t &ctx = treeL->ctx; // use resources from L
 
@@ -763,8 +900,10 @@ struct baseTree_t {
 	 * Lookup a node
 	 */
 	inline uint32_t lookupNode(uint32_t Q, uint32_t T, uint32_t F) {
+		PERFTIMER(PERF_LOOKUPNODE);
 
 		ctx.cntHash++;
+		const uint64_t cntCompare = ctx.cntCompare;
 
 		// starting position
 		uint32_t crc32 = 0;
@@ -781,12 +920,15 @@ struct baseTree_t {
 			if (this->nodeIndexVersion[ix] != this->nodeIndexVersionNr) {
 				// let caller finalise index
 				this->nodeIndex[ix] = 0;
+				NORMPROFILE_PROBE(NORMPROFILE_PROBE_MISSING, ctx.cntCompare - cntCompare);
 				return ix;
 			}
 
 			const baseNode_t *pNode = this->N + this->nodeIndex[ix];
-			if (pNode->Q == Q && pNode->T == T && pNode->F == F)
+			if (pNode->Q == Q && pNode->T == T && pNode->F == F) {
+				NORMPROFILE_PROBE(NORMPROFILE_PROBE_FOUND, ctx.cntCompare - cntCompare);
 				return ix;
+			}
 
 			ix += bump;
 			if (ix >= this->nodeIndexSize)
@@ -914,6 +1056,7 @@ struct baseTree_t {
 			// create
 			this->nodeIndex[ix]        = newNode(Q, T, F);
 			this->nodeIndexVersion[ix] = this->nodeIndexVersionNr;
+			NORMPROFILE_NEWNODE();
 		}
 
 		if ((this->flags & ctx.MAGICMASK_PARANOID) && (this->flags & ctx.MAGICMASK_CASCADE)) {
@@ -998,6 +1141,151 @@ struct baseTree_t {
 		return this->nodeIndex[ix];
 	}
 
+	/*
+	 * @date 2026-10-17 18:05:12
+	 *
+	 * Start recording top-level `normaliseNode()` calls.
+	 * The header is rewritten with totals by `stopTrace()`.
+	 *
+	 * @param {string} fileName - trace file
+	 */
+	void startTrace(const char *fileName) {
+		assert(traceFile == NULL);
+
+		traceFile = ::fopen(fileName, "w");
+		if (traceFile == NULL)
+			ctx.fatal("\n{\"error\":\"fopen() failed\",\"where\":\"%s:%s:%d\",\"name\":\"%s\",\"reason\":\"%m\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__, fileName);
+
+		traceDepth    = 0;
+		traceBase     = nstart;
+		traceNumCalls = 0;
+		traceNumBytes = 0;
+
+		// placeholder
+		baseTraceHeader_t header;
+		::memset(&header, 0, sizeof header);
+		::fwrite(&header, sizeof header, 1, traceFile);
+	}
+
+	/*
+	 * @date 2026-10-17 18:05:12
+	 *
+	 * Stop recording and finalise header
+	 */
+	void stopTrace(void) {
+		assert(traceFile != NULL);
+
+		baseTraceHeader_t header;
+		::memset(&header, 0, sizeof header);
+
+		header.magic       = BASETRACE_MAGIC;
+		header.magic_flags = flags;
+		header.kstart      = kstart;
+		header.ostart      = ostart;
+		header.estart      = estart;
+		header.nstart      = nstart;
+		header.ncount      = ncount;
+		header.numCalls    = traceNumCalls;
+		header.numBytes    = traceNumBytes;
+
+		::fseek(traceFile, 0, SEEK_SET);
+		::fwrite(&header, sizeof header, 1, traceFile);
+
+		if (::fclose(traceFile))
+			ctx.fatal("\n{\"error\":\"fclose() failed\",\"where\":\"%s:%s:%d\",\"reason\":\"%m\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__);
+
+		traceFile = NULL;
+	}
+
+	/*
+	 * @date 2026-10-17 18:05:12
+	 *
+	 * Encode id relative to highest id encountered, as varint.
+	 * Lowest bit is the invert, then the zigzag encoded distance.
+	 *
+	 * @param {number} base - highest id encountered + 1
+	 * @param {number} id - id to encode, can be inverted
+	 * @param {number[]} pBuf - output buffer, at least 10 bytes
+	 * @return {number} length of encoding
+	 */
+	static unsigned encodeTraceId(uint32_t base, uint32_t id, uint8_t *pBuf) {
+		int64_t  dist = (int64_t) base - (int64_t) (id & ~IBIT);
+		uint64_t v    = ((((uint64_t) dist << 1) ^ (uint64_t) (dist >> 63)) << 1) | ((id & IBIT) ? 1 : 0);
+		unsigned len  = 0;
+
+		while (v >= 0x80) {
+			pBuf[len++] = (uint8_t) (v | 0x80);
+			v >>= 7;
+		}
+		pBuf[len++] = (uint8_t) v;
+
+		return len;
+	}
+
+	/*
+	 * @date 2026-10-17 18:05:12
+	 *
+	 * Decode id written by `encodeTraceId()`
+	 *
+	 * @param {number} base - highest id encountered + 1
+	 * @param {number[]} pBuf - input buffer, updated
+	 * @return {number} decoded id, can be inverted
+	 */
+	static uint32_t decodeTraceId(uint32_t base, const uint8_t *&pBuf) {
+		uint64_t v     = 0;
+		unsigned shift = 0;
+
+		for (;;) {
+			uint8_t b = *pBuf++;
+			v |= (uint64_t) (b & 0x7f) << shift;
+			if (!(b & 0x80))
+				break;
+			shift += 7;
+		}
+
+		uint32_t ibit = (v & 1) ? IBIT : 0;
+		uint64_t z    = v >> 1;
+		int64_t  dist = (int64_t) (z >> 1) ^ -(int64_t) (z & 1);
+
+		return (uint32_t) ((int64_t) base - dist) ^ ibit;
+	}
+
+	/*
+	 * @date 2026-10-17 18:05:12
+	 *
+	 * Lookup/create and normalise, recording top-level calls when tracing.
+	 * See `normaliseNodeUntraced()`.
+	 */
+	inline uint32_t normaliseNode(uint32_t Q, uint32_t T, uint32_t F) {
+		if (__builtin_expect(traceFile == NULL, 1))
+			return normaliseNodeUntraced(Q, T, F);
+
+		traceDepth++;
+		uint32_t R = normaliseNodeUntraced(Q, T, F);
+		if (--traceDepth == 0) {
+			uint8_t  buf[4 * 10];
+			unsigned len = 0;
+
+			len += encodeTraceId(traceBase, Q, buf + len);
+			len += encodeTraceId(traceBase, T, buf + len);
+			len += encodeTraceId(traceBase, F, buf + len);
+			len += encodeTraceId(traceBase, R, buf + len);
+
+			::fwrite(buf, len, 1, traceFile);
+			traceNumCalls++;
+			traceNumBytes += len;
+
+			// raise base, keep in sync with replay
+			if ((Q & ~IBIT) >= traceBase) traceBase = (Q & ~IBIT) + 1;
+			if ((T & ~IBIT) >= traceBase) traceBase = (T & ~IBIT) + 1;
+			if ((F & ~IBIT) >= traceBase) traceBase = (F & ~IBIT) + 1;
+			if ((R & ~IBIT) >= traceBase) traceBase = (R & ~IBIT) + 1;
+		}
+		return R;
+	}
+
 	/*
 	 * @date  2021-05-12 18:08:34
 	 *
@@ -1008,7 +1296,9 @@ struct baseTree_t {
 	 * The workers of this function: invert no longer exists!! remove all the code and logic related.
 	 * Level 3 rewrites make `lookupNode()` lose it's meaning
 	 */
-	uint32_t normaliseNode(uint32_t Q, uint32_t T, uint32_t F) {
+	uint32_t normaliseNodeUntraced(uint32_t Q, uint32_t T, uint32_t F) {
+		PERFTIMER(PERF_NORMALISE);
+		NORMPROFILE_SCOPE();
 
 		assert ((Q & ~IBIT) < this->ncount);
 		assert ((T & ~IBIT) < this->ncount);
@@ -1075,6 +1365,9 @@ struct baseTree_t {
  		 *
 		 */
 
+		PERFCOUNT(PERF_NORMALISE_L2);
+		NORMPROFILE_STAGE(NORMPROFILE_LEVEL2);
+
 		if (this->flags & ctx.MAGICMASK_REWRITE) {
 
 			// perform a lookup
@@ -1197,11 +1490,15 @@ struct baseTree_t {
 		 * Level 3 normalisation: cascade OR/NE/AND
 		 */
 
+		PERFCOUNT(PERF_NORMALISE_L3);
+
 		static int xcnt;
 		xcnt++;
 
 		// OR
 		if (T == IBIT) {
+			NORMPROFILE_STAGE(NORMPROFILE_OR);
+
 			// test for slow path
 			if (this->flags & ctx.MAGICMASK_CASCADE) {
 				if (isOR(Q)) {
@@ -1241,6 +1538,8 @@ struct baseTree_t {
 
 		// NE
 		if ((T & ~IBIT) == F) {
+			NORMPROFILE_STAGE(NORMPROFILE_NE);
+
 			// test for slow path
 			if (this->flags & ctx.MAGICMASK_CASCADE) {
 				if (isNE(Q)) {
@@ -1281,6 +1580,8 @@ struct baseTree_t {
 
 		// AND
 		if (!(T & IBIT) && F == 0) {
+			NORMPROFILE_STAGE(NORMPROFILE_AND);
+
 			// test for slow path
 			if (this->flags & ctx.MAGICMASK_CASCADE) {
 				if (isAND(Q)) {
@@ -1318,253 +1619,330 @@ struct baseTree_t {
 			}
 		}
 
+		PERFCOUNT(PERF_NORMALISE_BASIC);
+		NORMPROFILE_STAGE(NORMPROFILE_BASIC);
+
 		return this->basicNode(Q, T, F) ^ ibit;
 	}
 
 	/*
-	 * @date 2021-06-13 10:28:49
+	 * @date 2026-10-17 16:58:41
 	 *
-	 * Rewrite Q/T/F based on top-level lookup tables.
-	 * If a rewrite found
+	 * Lookup part of `rewriteNode()`.
+	 * Map the Q/T/F neighbourhood to slots and find the matching `rewriteData[]` entry.
+	 * Separated so the lookup engines can be benchmarked without the tree changes of the response.
+	 *
+	 * @param {number} Q
+	 * @param {number} T
+	 * @param {number} F
+	 * @param {number[]} slots - output, node id's of the relative slots
+	 * @return {number} rewrite data, 0 if pattern unknown
 	 */
-	uint32_t rewriteNode(uint32_t Q, uint32_t T, uint32_t F) {
-		// test if symbols available while linking
-		if (rewriteMap == NULL) {
-			assert(!"MAGICMASK_REWRITE requested, include \"rewritedata.h\"");
-		} else {
-			uint32_t slots[16], nextSlot;
-			uint32_t Tu = T & ~IBIT;
-			uint32_t Ti = T & IBIT;
-			uint32_t ix = rewriteDataFirst;
-
-			if (this->flags & context_t::MAGICMASK_PARANOID) {
-				assert(!(Q & IBIT));          // Q not inverted
-				assert(Ti || !(this->flags & context_t::MAGICMASK_PURE));
-				assert(!(F & IBIT));          // F not inverted
-				assert(Q != 0);               // Q not zero
-
-				assert (Q < this->ncount);
-				assert (Tu < this->ncount);
-				assert (F < this->ncount);
-			}
+	uint32_t lookupRewrite(uint32_t Q, uint32_t T, uint32_t F, uint32_t *slots) {
+		uint32_t nextSlot;
+		uint32_t Tu = T & ~IBIT;
+		uint32_t Ti = T & IBIT;
+		uint64_t path = 0; // transitions, one nibble each
 
-			// versioning
-			uint32_t thisVersion = ++iVersionRewrite;
-			if (thisVersion == 0) {
-				// version overflow, clear
-				memset(rewriteVersion, 0, this->maxNodes * sizeof(*rewriteVersion));
+		if (this->flags & context_t::MAGICMASK_PARANOID) {
+			assert(!(Q & IBIT));          // Q not inverted
+			assert(Ti || !(this->flags & context_t::MAGICMASK_PURE));
+			assert(!(F & IBIT));          // F not inverted
+			assert(Q != 0);               // Q not zero
 
-				thisVersion = ++iVersionRewrite;
+			assert (Q < this->ncount);
+			assert (Tu < this->ncount);
+			assert (F < this->ncount);
+		}
+
+		// versioning
+		uint32_t thisVersion = ++iVersionRewrite;
+		if (thisVersion == 0) {
+			// version overflow, clear
+			memset(rewriteVersion, 0, this->maxNodes * sizeof(*rewriteVersion));
+
+			thisVersion = ++iVersionRewrite;
+		}
+		numRewrite++;
+
+		// setup slots
+		slots[0] = 0;
+		nextSlot = 0;
+		rewriteMap[nextSlot++] = 0;
+
+		if (ENABLE_DEBUG_REWRITE && (ctx.opt_debug & ctx.DEBUGMASK_REWRITE))
+			fprintf(stderr, "%d: Q=%d T=%s%d F=%d ", this->ncount, Q, Ti ? "~" : "", Tu, F);
+
+		/*
+		 * Pull Q through state table
+		 */
+		if (Q < this->nstart) {
+
+			if (Q && rewriteVersion[Q] != thisVersion) {
+				slots[nextSlot]   = Q;
+				rewriteVersion[Q] = thisVersion;
+				rewriteMap[Q]     = nextSlot++;
 			}
-			numRewrite++;
 
-			// setup slots
-			slots[0] = 0;
-			nextSlot = 0;
-			rewriteMap[nextSlot++] = 0;
+			// endpoint Q stores as 2 successive, no invert
+			path = path << 4 | rewriteMap[Q];
+			path = path << 4 | rewriteMap[Q];
 
-			if (ENABLE_DEBUG_REWRITE && (ctx.opt_debug & ctx.DEBUGMASK_REWRITE))
-				fprintf(stderr, "%d: Q=%d T=%s%d F=%d ", this->ncount, Q, Ti ? "~" : "", Tu, F);
+		} else {
 
-			/*
-			 * Pull Q through state table
-			 */
-			if (Q < this->nstart) {
+			const baseNode_t *pNode = this->N + Q;
+			const uint32_t   QQ     = pNode->Q;
+			const uint32_t   QTu    = pNode->T & ~IBIT;
+			const uint32_t   QTi    = pNode->T & IBIT;
+			const uint32_t   QF     = pNode->F;
 
-				if (Q && rewriteVersion[Q] != thisVersion) {
-					slots[nextSlot]   = Q;
-					rewriteVersion[Q] = thisVersion;
-					rewriteMap[Q]     = nextSlot++;
-				}
+			if (QQ && rewriteVersion[QQ] != thisVersion) {
+				slots[nextSlot]    = QQ;
+				rewriteVersion[QQ] = thisVersion;
+				rewriteMap[QQ]     = nextSlot++;
+			}
+			path = path << 4 | rewriteMap[QQ];
 
-				// endpoint Q stores as 2 successive, no invert
-				ix = rewriteData[ix + rewriteMap[Q]];
-				ix = rewriteData[ix + rewriteMap[Q]];
+			if (QTu && rewriteVersion[QTu] != thisVersion) {
+				slots[nextSlot]     = QTu;
+				rewriteVersion[QTu] = thisVersion;
+				rewriteMap[QTu]     = nextSlot++;
+			}
+			path = path << 4 | rewriteMap[QTu];
 
-			} else {
+			if (QF && rewriteVersion[QF] != thisVersion) {
+				slots[nextSlot]    = QF;
+				rewriteVersion[QF] = thisVersion;
+				rewriteMap[QF]     = nextSlot++;
+			}
+			path = path << 4 | rewriteMap[QF];
 
-				const baseNode_t *pNode = this->N + Q;
-				const uint32_t   QQ     = pNode->Q;
-				const uint32_t   QTu    = pNode->T & ~IBIT;
-				const uint32_t   QTi    = pNode->T & IBIT;
-				const uint32_t   QF     = pNode->F;
+			path = path << 4 | (QTi ? 1 : 0);
 
-				if (QQ && rewriteVersion[QQ] != thisVersion) {
-					slots[nextSlot]    = QQ;
-					rewriteVersion[QQ] = thisVersion;
-					rewriteMap[QQ]     = nextSlot++;
-				}
-				ix = rewriteData[ix + rewriteMap[QQ]];
+			// placeholder
+			if (rewriteVersion[Q] != thisVersion) {
+				slots[nextSlot]   = Q;
+				rewriteVersion[Q] = thisVersion;
+				rewriteMap[Q]     = nextSlot++;
+			}
+		}
 
-				if (QTu && rewriteVersion[QTu] != thisVersion) {
-					slots[nextSlot]     = QTu;
-					rewriteVersion[QTu] = thisVersion;
-					rewriteMap[QTu]     = nextSlot++;
-				}
-				ix = rewriteData[ix + rewriteMap[QTu]];
+		/*
+		 * Pull T through state table
+		 */
+		if (Tu < this->nstart || rewriteVersion[Tu] == thisVersion) {
 
-				if (QF && rewriteVersion[QF] != thisVersion) {
-					slots[nextSlot]    = QF;
-					rewriteVersion[QF] = thisVersion;
-					rewriteMap[QF]     = nextSlot++;
-				}
-				ix = rewriteData[ix + rewriteMap[QF]];
+			if (Tu && rewriteVersion[Tu] != thisVersion) {
+				slots[nextSlot]    = Tu;
+				rewriteVersion[Tu] = thisVersion;
+				rewriteMap[Tu]     = nextSlot++;
+			}
 
-				ix = rewriteData[ix + (QTi ? 1 : 0)];
+			// endpoint Tu stores as 2 successive, no invert
+			path = path << 4 | rewriteMap[Tu];
+			path = path << 4 | rewriteMap[Tu];
+		} else {
 
-				// placeholder
-				if (rewriteVersion[Q] != thisVersion) {
-					slots[nextSlot]   = Q;
-					rewriteVersion[Q] = thisVersion;
-					rewriteMap[Q]     = nextSlot++;
-				}
+			const baseNode_t *pNode = this->N + Tu;
+			const uint32_t   TQ     = pNode->Q;
+			const uint32_t   TTu    = pNode->T & ~IBIT;
+			const uint32_t   TTi    = pNode->T & IBIT;
+			const uint32_t   TF     = pNode->F;
+
+			if (TQ && rewriteVersion[TQ] != thisVersion) {
+				slots[nextSlot]    = TQ;
+				rewriteVersion[TQ] = thisVersion;
+				rewriteMap[TQ]     = nextSlot++;
 			}
+			path = path << 4 | rewriteMap[TQ];
 
-			/*
-			 * Pull T through state table
-			 */
-			if (Tu < this->nstart || rewriteVersion[Tu] == thisVersion) {
 
-				if (Tu && rewriteVersion[Tu] != thisVersion) {
-					slots[nextSlot]    = Tu;
-					rewriteVersion[Tu] = thisVersion;
-					rewriteMap[Tu]     = nextSlot++;
-				}
+			if (TTu && rewriteVersion[TTu] != thisVersion) {
+				slots[nextSlot]     = TTu;
+				rewriteVersion[TTu] = thisVersion;
+				rewriteMap[TTu]     = nextSlot++;
+			}
+			path = path << 4 | rewriteMap[TTu];
 
-				// endpoint Tu stores as 2 successive, no invert
-				ix = rewriteData[ix + rewriteMap[Tu]];
-				ix = rewriteData[ix + rewriteMap[Tu]];
-			} else {
 
-				const baseNode_t *pNode = this->N + Tu;
-				const uint32_t   TQ     = pNode->Q;
-				const uint32_t   TTu    = pNode->T & ~IBIT;
-				const uint32_t   TTi    = pNode->T & IBIT;
-				const uint32_t   TF     = pNode->F;
+			if (TF && rewriteVersion[TF] != thisVersion) {
+				slots[nextSlot]    = TF;
+				rewriteVersion[TF] = thisVersion;
+				rewriteMap[TF]     = nextSlot++;
+			}
+			path = path << 4 | rewriteMap[TF];
 
-				if (TQ && rewriteVersion[TQ] != thisVersion) {
-					slots[nextSlot]    = TQ;
-					rewriteVersion[TQ] = thisVersion;
-					rewriteMap[TQ]     = nextSlot++;
-				}
-				ix = rewriteData[ix + rewriteMap[TQ]];
 
+			path = path << 4 | (TTi ? 1 : 0);
 
-				if (TTu && rewriteVersion[TTu] != thisVersion) {
-					slots[nextSlot]     = TTu;
-					rewriteVersion[TTu] = thisVersion;
-					rewriteMap[TTu]     = nextSlot++;
-				}
-				ix = rewriteData[ix + rewriteMap[TTu]];
+			// placeholder
+			slots[nextSlot]    = Tu;
+			rewriteVersion[Tu] = thisVersion;
+			rewriteMap[Tu]     = nextSlot++;
+		}
 
+		/*
+		 * Pull F through state table
+		 */
+		if (F < this->nstart || rewriteVersion[F] == thisVersion) {
 
-				if (TF && rewriteVersion[TF] != thisVersion) {
-					slots[nextSlot]    = TF;
-					rewriteVersion[TF] = thisVersion;
-					rewriteMap[TF]     = nextSlot++;
-				}
-				ix = rewriteData[ix + rewriteMap[TF]];
+			if (F && rewriteVersion[F] != thisVersion) {
+				slots[nextSlot]   = F;
+				rewriteVersion[F] = thisVersion;
+				rewriteMap[F]     = nextSlot++;
+			}
 
+			// endpoint F stores as 2 successive, no invert
+			path = path << 4 | rewriteMap[F];
+			path = path << 4 | rewriteMap[F];
 
-				ix = rewriteData[ix + (TTi ? 1 : 0)];
+		} else {
 
-				// placeholder
-				slots[nextSlot]    = Tu;
-				rewriteVersion[Tu] = thisVersion;
-				rewriteMap[Tu]     = nextSlot++;
+			const baseNode_t *pNode = this->N + F;
+			const uint32_t   FQ     = pNode->Q;
+			const uint32_t   FTu    = pNode->T & ~IBIT;
+			const uint32_t   FTi    = pNode->T & IBIT;
+			const uint32_t   FF     = pNode->F;
+
+			if (FQ && rewriteVersion[FQ] != thisVersion) {
+				slots[nextSlot]    = FQ;
+				rewriteVersion[FQ] = thisVersion;
+				rewriteMap[FQ]     = nextSlot++;
 			}
+			path = path << 4 | rewriteMap[FQ];
 
-			/*
-			 * Pull F through state table
-			 */
-			if (F < this->nstart || rewriteVersion[F] == thisVersion) {
 
-				if (F && rewriteVersion[F] != thisVersion) {
-					slots[nextSlot]   = F;
-					rewriteVersion[F] = thisVersion;
-					rewriteMap[F]     = nextSlot++;
-				}
+			if (FTu && rewriteVersion[FTu] != thisVersion) {
+				slots[nextSlot]     = FTu;
+				rewriteVersion[FTu] = thisVersion;
+				rewriteMap[FTu]     = nextSlot++;
+			}
+			path = path << 4 | rewriteMap[FTu];
 
-				// endpoint F stores as 2 successive, no invert
-				ix = rewriteData[ix + rewriteMap[F]];
-				ix = rewriteData[ix + rewriteMap[F]];
 
-			} else {
+			if (FF && rewriteVersion[FF] != thisVersion) {
+				slots[nextSlot]    = FF;
+				rewriteVersion[FF] = thisVersion;
+				rewriteMap[FF]     = nextSlot++;
+			}
+			path = path << 4 | rewriteMap[FF];
 
-				const baseNode_t *pNode = this->N + F;
-				const uint32_t   FQ     = pNode->Q;
-				const uint32_t   FTu    = pNode->T & ~IBIT;
-				const uint32_t   FTi    = pNode->T & IBIT;
-				const uint32_t   FF     = pNode->F;
 
-				if (FQ && rewriteVersion[FQ] != thisVersion) {
-					slots[nextSlot]    = FQ;
-					rewriteVersion[FQ] = thisVersion;
-					rewriteMap[FQ]     = nextSlot++;
-				}
-				ix = rewriteData[ix + rewriteMap[FQ]];
+			path = path << 4 | (FTi ? 1 : 0);
 
+			// placeholder
+			slots[nextSlot]   = F;
+			rewriteVersion[F] = thisVersion;
+			rewriteMap[F]     = nextSlot++;
+		}
 
-				if (FTu && rewriteVersion[FTu] != thisVersion) {
-					slots[nextSlot]     = FTu;
-					rewriteVersion[FTu] = thisVersion;
-					rewriteMap[FTu]     = nextSlot++;
-				}
-				ix = rewriteData[ix + rewriteMap[FTu]];
+		if (ENABLE_DEBUG_REWRITE && ctx.opt_debug & ctx.DEBUGMASK_REWRITE)
+			fprintf(stderr, "-> [%d %d %d %d %d %d %d %d %d]",
+				nextSlot < 1 ? 0 : slots[0],
+				nextSlot < 2 ? 0 : slots[1],
+				nextSlot < 3 ? 0 : slots[2],
+				nextSlot < 4 ? 0 : slots[3],
+				nextSlot < 5 ? 0 : slots[4],
+				nextSlot < 6 ? 0 : slots[5],
+				nextSlot < 7 ? 0 : slots[6],
+				nextSlot < 8 ? 0 : slots[7],
+				nextSlot < 9 ? 0 : slots[8]);
 
+		/*
+		 * top level inverted T.
+		 * NOTE: Not an index but an offset
+		 */
+		//
+		path = path << 4 | (Ti ? 1 : 0);
 
-				if (FF && rewriteVersion[FF] != thisVersion) {
-					slots[nextSlot]    = FF;
-					rewriteVersion[FF] = thisVersion;
-					rewriteMap[FF]     = nextSlot++;
-				}
-				ix = rewriteData[ix + rewriteMap[FF]];
+		/*
+		 * Walk state table, or retrieve walk result from compact cache
+		 */
+		uint32_t ix, data;
 
+		if (__builtin_expect(useRewriteCompact && rewriteCompact == NULL, 0))
+			rewriteCompact = (rewriteCompact_t *) ctx.myAlloc("baseTree_t::rewriteCompact", 1 << REWRITECOMPACT_BITS, sizeof(*rewriteCompact));
 
-				ix = rewriteData[ix + (FTi ? 1 : 0)];
+		if (rewriteCompact) {
+			rewriteCompact_t *pEntry = rewriteCompact + ((path * 0x9e3779b97f4a7c15ULL) >> (64 - REWRITECOMPACT_BITS));
 
-				// placeholder
-				slots[nextSlot]   = F;
-				rewriteVersion[F] = thisVersion;
-				rewriteMap[F]     = nextSlot++;
+			if (pEntry->key != path) {
+				NORMPROFILE_PROBE(NORMPROFILE_PROBE_COMPACTMISS, (63 - __builtin_clzll(path)) / 4);
+				ix = walkRewrite(path);
+
+				pEntry->key   = path;
+				pEntry->index = ix;
+				pEntry->data  = rewriteData[ix];
+			} else {
+				NORMPROFILE_PROBE(NORMPROFILE_PROBE_COMPACTHIT, 1);
 			}
 
-			if (ENABLE_DEBUG_REWRITE && ctx.opt_debug & ctx.DEBUGMASK_REWRITE)
-				fprintf(stderr, "-> [%d %d %d %d %d %d %d %d %d]",
-					nextSlot < 1 ? 0 : slots[0],
-					nextSlot < 2 ? 0 : slots[1],
-					nextSlot < 3 ? 0 : slots[2],
-					nextSlot < 4 ? 0 : slots[3],
-					nextSlot < 5 ? 0 : slots[4],
-					nextSlot < 6 ? 0 : slots[5],
-					nextSlot < 7 ? 0 : slots[6],
-					nextSlot < 8 ? 0 : slots[7],
-					nextSlot < 9 ? 0 : slots[8]);
+			ix   = pEntry->index;
+			data = pEntry->data;
+		} else {
+			NORMPROFILE_PROBE(NORMPROFILE_PROBE_WALK, (63 - __builtin_clzll(path)) / 4);
+			ix   = walkRewrite(path);
+			data = rewriteData[ix];
+		}
 
-			/*
-			 * top level inverted T.
-			 * NOTE: Not an index but an offset
-			 */
-			//
-			assert(ix);
-			ix = ix + (Ti ? 1 : 0);
+		if (ENABLE_DEBUG_REWRITE && (ctx.opt_debug & ctx.DEBUGMASK_REWRITE))
+			fprintf(stderr, " -> ix=%x", ix);
 
-			if (ENABLE_DEBUG_REWRITE && (ctx.opt_debug & ctx.DEBUGMASK_REWRITE))
-				fprintf(stderr, " -> ix=%x", ix);
+		lastRewriteIndex = ix;
 
-			gLastRewriteIndex = ix;
+		return data;
+	}
+
+	/*
+	 * @date 2021-06-13 10:28:49
+	 *
+	 * Rewrite Q/T/F based on top-level lookup tables.
+	 * If a rewrite found
+	 */
+	/*
+	 * @date 2026-10-17 16:52:33
+	 *
+	 * Walk `rewriteData[]` along the transitions collected by `rewriteNode()`.
+	 * The first transition is in the highest non-zero nibble, it is never zero because `Q` is never zero.
+	 * The last nibble is the top-level `Ti`, which is an offset and not an index.
+	 * Every step is a dependent load, this is what `rewriteCompact` avoids.
+	 *
+	 * @param {number} path - transitions, one nibble each
+	 * @return {number} index into `rewriteData[]`
+	 */
+	static uint32_t walkRewrite(uint64_t path) {
+		int      shift = (63 - __builtin_clzll(path)) & ~3;
+		uint32_t ix    = rewriteDataFirst;
+
+		for (; shift > 0; shift -= 4)
+			ix = rewriteData[ix + ((path >> shift) & 15)];
+
+		assert(ix);
+		return ix + (path & 15);
+	}
+
+	uint32_t rewriteNode(uint32_t Q, uint32_t T, uint32_t F) {
+		PERFTIMER(PERF_REWRITENODE);
+
+		// test if symbols available while linking
+		if (rewriteMap == NULL) {
+			assert(!"MAGICMASK_REWRITE requested, include \"rewritedata.h\"");
+		} else {
+			uint32_t slots[16];
+			uint32_t data = lookupRewrite(Q, T, F, slots);
+			NORMPROFILE_RULE(lastRewriteIndex, data);
 
 			/*
 			 * Respond to rewrite
 			 */
-			uint32_t data = rewriteData[ix];
 			assert(data);
 
-			gCountRewritePower[(data >> REWRITEFLAG_POWER) & 0xf]++;
+			cntRewritePower[(data >> REWRITEFLAG_POWER) & 0xf]++;
 
 			if (data & REWRITEMASK_TREE) {
 				// destructive rewrite
-				gCountRewriteTree++;
+				cntRewriteTree++;
+				NORMPROFILE_STAGE(NORMPROFILE_TREE);
 
 				uint64_t treedata = rewriteTree[data & 0xffffff];
 				uint32_t temp[16];
@@ -1599,7 +1977,7 @@ struct baseTree_t {
 				if (ENABLE_DEBUG_REWRITE && (ctx.opt_debug & ctx.DEBUGMASK_REWRITE))
 					fprintf(stderr, "}\n");
 
-				gCountRewriteTree++;
+				cntRewriteTree++;
 				return r;
 
 			} else if (data & REWRITEMASK_COLLAPSE) {
@@ -1608,7 +1986,8 @@ struct baseTree_t {
 					fprintf(stderr, " -> collapse=%x\n", data);
 
 				// rewrite is a full collapse
-				gCountRewriteCollapse++;
+				cntRewriteCollapse++;
+				NORMPROFILE_STAGE(NORMPROFILE_COLLAPSE);
 				return slots[data & 0xf];
 
 			} else if (data & REWRITEMASK_FOUND) {
@@ -1617,7 +1996,7 @@ struct baseTree_t {
 					fprintf(stderr, " -> weak=%x\n", data);
 
 				// no rewrite needed
-				gCountRewriteNo++;
+				cntRewriteNo++;
 				return IBIT;
 
 			} else {
@@ -1626,6 +2005,7 @@ struct baseTree_t {
 					fprintf(stderr, " -> order=%x {\n", data);
 
 				// rewrite with available components
+				NORMPROFILE_STAGE(NORMPROFILE_ORDER);
 				uint32_t newF = slots[data & 15];
 				data >>= 4;
 				uint32_t newTu = slots[data & 15];
@@ -1641,7 +2021,7 @@ struct baseTree_t {
 				if (ENABLE_DEBUG_REWRITE && (ctx.opt_debug & ctx.DEBUGMASK_REWRITE))
 					fprintf(stderr, "}\n");
 
-				gCountRewriteYes++;
+				cntRewriteYes++;
 				return r;
 
 			}
@@ -1652,202 +2032,211 @@ struct baseTree_t {
 	}
 
 	/*
-	 * @date 2021-05-13 00:25:01
-	 *
-	 * Merge two OR chains by sort/merging lhs+rhs
-	 * Forks in chains are not allowed.
-	 * Duplicate nodes are merged into one (a OR a = a)
+	 * @date 2026-10-17 18:58:36
 	 */
-	uint32_t mergeOR(uint32_t lhs, uint32_t rhs) {
-		uint32_t *pStackL  = allocMap();
-		uint32_t *pStackR  = allocMap();
-		uint32_t numStackR = 0;
-		uint32_t numStackL = 0;
-
-		if (!isOR(rhs)) {
-			pStackR[numStackR++] = rhs;
-		} else {
-			for (;;) {
-				if (!isOR(N[rhs].F))
-					pStackR[numStackR++] = N[rhs].F;
-				if (!isOR(N[rhs].Q))
-					pStackR[numStackR++] = N[rhs].Q;
-
-				if (isOR(N[rhs].Q))
-					rhs = N[rhs].Q;
-				else if (isOR(N[rhs].F))
-					rhs = N[rhs].F;
-				else
-					break;
-			}
-		}
-
-		if (!isOR(lhs)) {
-			pStackL[numStackL++] = lhs;
-		} else {
-			for (;;) {
-				if (!isOR(N[lhs].F))
-					pStackL[numStackL++] = N[lhs].F;
-				if (!isOR(N[lhs].Q))
-					pStackL[numStackL++] = N[lhs].Q;
-
-				if (isOR(N[lhs].Q))
-					lhs = N[lhs].Q;
-				else if (isOR(N[lhs].F))
-					lhs = N[lhs].F;
-				else
-					break;
-			}
-		}
-
-
-		uint32_t Z = 0;
+	inline bool __attribute__((pure)) isCascade(unsigned kind, uint32_t id) const {
+		return kind == CASCADE_OR ? isOR(id) : kind == CASCADE_NE ? isNE(id) : isAND(id);
+	}
 
-		while (numStackL && numStackR) {
+	/*
+	 * @date 2026-10-17 18:58:36
+	 *
+	 * Flatten a cascade onto a stack, smallest term on top.
+	 *
+	 * Cascades are persistent sorted lists: the node holding term `i` also holds all smaller terms `i+1..`.
+	 * Only that node is recorded in `pChain[i]`, merging can reuse the untouched bottom part without rebuilding it.
+	 * The term itself follows from the node with `cascadeTerm()`, which keeps merging at two maps.
+	 *
+	 * @param {number} kind - `CASCADE_OR`, `CASCADE_NE` or `CASCADE_AND`
+	 * @param {number} id - cascade or single term
+	 * @param {number[]} pChain - (output) cascade holding term `i` and smaller
+	 * @param {boolean} canonical - (output) `false` if the cascade forks and `pChain[]` is unusable as sub-cascades
+	 * @return {number} number of terms
+	 */
+	uint32_t flattenCascade(unsigned kind, uint32_t id, uint32_t *pChain, bool &canonical) const {
+		uint32_t numStack = 0;
 
-			// two OR's merge to one
-			if (numStackL >= 2 && pStackL[numStackL - 1] == pStackL[numStackL - 2]) {
-				numStackL--;
-			} else if (numStackR >= 2 && pStackR[numStackR - 1] == pStackR[numStackR - 2]) {
-				numStackR--;
-			} else if (pStackL[numStackL - 1] == pStackR[numStackR - 1]) {
-				numStackL--;
-			} else if (compare(this, pStackL[numStackL - 1], this, pStackR[numStackR - 1]) < 0) {
+		canonical = true;
 
-				uint32_t C = pStackL[--numStackL];
+		if (!isCascade(kind, id)) {
+			pChain[numStack++] = id;
+			return numStack;
+		}
 
-				assert(!isOR(C));
-				Z = normaliseNode(C, IBIT, Z);
+		for (;;) {
+			// AND cascades are linked through `T`, OR/NE through `F`
+			uint32_t other = (kind == CASCADE_AND) ? N[id].T : N[id].F;
+
+			if (!isCascade(kind, other))
+				pChain[numStack++] = id;
+			if (!isCascade(kind, N[id].Q)) {
+				// bottom node holds two terms, the smaller is its own cascade
+				pChain[numStack++] = isCascade(kind, other) ? id : N[id].Q;
+			}
 
+			if (isCascade(kind, N[id].Q)) {
+				if (isCascade(kind, other))
+					canonical = false; // forks are not allowed
+				id = N[id].Q;
+			} else if (isCascade(kind, other)) {
+				id = other;
 			} else {
-
-				uint32_t C = pStackR[--numStackR];
-
-				assert(!isOR(C));
-				Z = normaliseNode(C, IBIT, Z);
+				break;
 			}
 		}
 
-		while (numStackL) {
-			uint32_t C = pStackL[--numStackL];
-
-			assert(!isOR(C));
-			Z = normaliseNode(C, IBIT, Z);
-		}
-		while (numStackR) {
-			uint32_t C = pStackR[--numStackR];
-
-			assert(!isOR(C));
-			Z = normaliseNode(C, IBIT, Z);
-		}
-
-		freeMap(pStackR);
-		freeMap(pStackL);
-		return Z;
+		return numStack;
 	}
 
 	/*
-	 * @date 2021-05-13 00:27:36
+	 * @date 2026-10-17 18:58:36
 	 *
-	 * Merge two NE chains by sort/merging lhs+rhs
-	 * Forks in chains are not allowed.
-	 * Duplicate nodes are removed (a NE a = 0)
+	 * Term of a `flattenCascade()` entry.
+	 * A node records its linked term, unless that is a cascade, then its `Q`. The bottom `Q` records itself.
+	 *
+	 * @param {number} kind - `CASCADE_OR`, `CASCADE_NE` or `CASCADE_AND`
+	 * @param {number} C - entry of `pChain[]`
+	 * @return {number} term
 	 */
-	uint32_t mergeNE(uint32_t lhs, uint32_t rhs) {
+	inline uint32_t __attribute__((pure)) cascadeTerm(unsigned kind, uint32_t C) const {
+		if (!isCascade(kind, C))
+			return C;
 
-		/*
-		 * setup starting position
-		 * NOTE: "current positions" are candidate for what gets pushed and is never NE
-		 * NOTE: nodes never have both Q/F being NE
-		 * NOTE: "compare(N[x].Q, N[x].F)" should always return <0
-		 */
+		uint32_t other = (kind == CASCADE_AND) ? N[C].T : N[C].F;
 
-		uint32_t *pStackL  = allocMap();
-		uint32_t *pStackR  = allocMap();
-		uint32_t numStackR = 0;
-		uint32_t numStackL = 0;
+		return isCascade(kind, other) ? N[C].Q : other;
+	}
 
-		if (!isNE(rhs)) {
-			pStackR[numStackR++] = rhs;
-		} else {
-			for (;;) {
-				if (!isNE(N[rhs].F))
-					pStackR[numStackR++] = N[rhs].F;
-				if (!isNE(N[rhs].Q))
-					pStackR[numStackR++] = N[rhs].Q;
-
-				if (isNE(N[rhs].Q))
-					rhs = N[rhs].Q;
-				else if (isNE(N[rhs].F))
-					rhs = N[rhs].F;
-				else
-					break;
-			}
-		}
+	/*
+	 * @date 2026-10-17 18:58:36
+	 *
+	 * Pop the smallest term of a side and append it to the merged cascade `Z`.
+	 *
+	 * As long as all terms so far came from one canonical side, `Z` is identical to that side's
+	 * existing sub-cascade, which is returned instead of rebuilding it with `normaliseNode()`.
+	 *
+	 * @param {number} kind - `CASCADE_OR`, `CASCADE_NE` or `CASCADE_AND`
+	 * @param {number[]} pChain - flattened side
+	 * @param {number} numStack - (input/output) number of terms of side
+	 * @param {number} side - 0 for left, 1 for right
+	 * @param {number} prefix - (input/output) side `Z` is a sub-cascade of, `PREFIX_ANY` or `PREFIX_NONE`
+	 * @param {number} Z - merged cascade so far
+	 * @return {number} merged cascade
+	 */
+	uint32_t popCascade(unsigned kind, const uint32_t *pChain, uint32_t &numStack, unsigned side, unsigned &prefix, uint32_t Z) {
+		--numStack;
+
+		if (prefix == PREFIX_ANY)
+			prefix = side;
+		if (prefix == side)
+			return pChain[numStack];
+		prefix = PREFIX_NONE;
+
+		uint32_t C = cascadeTerm(kind, pChain[numStack]);
+
+		assert(!isCascade(kind, C));
+
+		if (kind == CASCADE_OR)
+			return normaliseNode(C, IBIT, Z);
+		else if (kind == CASCADE_NE)
+			return normaliseNode(C, Z ^ IBIT, Z);
+		else if (Z == 0)
+			return C;
+		else
+			return normaliseNode(C, Z, 0);
+	}
 
-		if (!isNE(lhs)) {
-			pStackL[numStackL++] = lhs;
-		} else {
-			for (;;) {
-				if (!isNE(N[lhs].F))
-					pStackL[numStackL++] = N[lhs].F;
-				if (!isNE(N[lhs].Q))
-					pStackL[numStackL++] = N[lhs].Q;
-
-				if (isNE(N[lhs].Q))
-					lhs = N[lhs].Q;
-				else if (isNE(N[lhs].F))
-					lhs = N[lhs].F;
-				else
-					break;
-			}
-		}
+	/*
+	 * @date 2021-05-13 00:25:01
+	 *
+	 * Merge two cascade chains by sort/merging lhs+rhs
+	 * Forks in chains are not allowed.
+	 *
+	 * @date 2026-10-17 18:58:36
+	 *
+	 * Shared implementation for OR/NE/AND.
+	 * The bottom part of the result that is taken from one side only is reused instead of being rebuilt term by term,
+	 * only the terms above the first term of the other side create nodes.
+	 * Appending a term to a k-term cascade costs k compares but only one node per term that sorts above it.
+	 * Resulting nodes are identical to rebuilding the complete cascade.
+	 *
+	 * @param {number} lhs - cascade or term
+	 * @param {number} rhs - cascade or term
+	 * @param {number} kind - `CASCADE_OR`, `CASCADE_NE` or `CASCADE_AND`
+	 * @return {number} merged cascade
+	 */
+	uint32_t mergeCascade(uint32_t lhs, uint32_t rhs, unsigned kind) {
+		uint32_t *pChainL = allocMap();
+		uint32_t *pChainR = allocMap();
+		bool     canonicalL, canonicalR;
 
+		uint32_t numStackL = flattenCascade(kind, lhs, pChainL, canonicalL);
+		uint32_t numStackR = flattenCascade(kind, rhs, pChainR, canonicalR);
 
 		uint32_t Z = 0;
 
-		while (numStackL && numStackR) {
+		// side of which `Z` is an existing sub-cascade
+		unsigned prefix = PREFIX_ANY;
+		if (!canonicalL && !canonicalR)
+			prefix = PREFIX_NONE;
+		else if (!canonicalL)
+			prefix = PREFIX_RIGHT;
+		else if (!canonicalR)
+			prefix = PREFIX_LEFT;
 
-			// two NE's collapse
-			if (numStackL >= 2 && pStackL[numStackL - 1] == pStackL[numStackL - 2]) {
-				numStackL -= 2;
-			} else if (numStackR >= 2 && pStackR[numStackR - 1] == pStackR[numStackR - 2]) {
-				numStackR -= 2;
-			} else if (pStackL[numStackL - 1] == pStackR[numStackR - 1]) {
+		while (numStackL && numStackR) {
+			uint32_t L = cascadeTerm(kind, pChainL[numStackL - 1]);
+			uint32_t R = cascadeTerm(kind, pChainR[numStackR - 1]);
+
+			// two OR/AND's merge to one, two NE's collapse
+			if (numStackL >= 2 && L == cascadeTerm(kind, pChainL[numStackL - 2])) {
+				numStackL -= (kind == CASCADE_NE) ? 2 : 1;
+				prefix = PREFIX_NONE;
+			} else if (numStackR >= 2 && R == cascadeTerm(kind, pChainR[numStackR - 2])) {
+				numStackR -= (kind == CASCADE_NE) ? 2 : 1;
+				prefix = PREFIX_NONE;
+			} else if (L == R) {
 				numStackL--;
-				numStackR--;
-			} else if (compare(this, pStackL[numStackL - 1], this, pStackR[numStackR - 1]) < 0) {
-
-				uint32_t C = pStackL[--numStackL];
-
-				assert(!isNE(C));
-				Z = normaliseNode(C, Z ^ IBIT, Z);
-
+				if (kind == CASCADE_NE)
+					numStackR--;
+				prefix = PREFIX_NONE;
+			} else if (compare(this, L, this, R) < 0) {
+				Z = popCascade(kind, pChainL, numStackL, PREFIX_LEFT, prefix, Z);
 			} else {
-
-				uint32_t C = pStackR[--numStackR];
-
-				assert(!isNE(C));
-				Z = normaliseNode(C, Z ^ IBIT, Z);
+				Z = popCascade(kind, pChainR, numStackR, PREFIX_RIGHT, prefix, Z);
 			}
 		}
 
-		while (numStackL) {
-			uint32_t C = pStackL[--numStackL];
+		while (numStackL)
+			Z = popCascade(kind, pChainL, numStackL, PREFIX_LEFT, prefix, Z);
+		while (numStackR)
+			Z = popCascade(kind, pChainR, numStackR, PREFIX_RIGHT, prefix, Z);
 
-			assert(!isNE(C));
-			Z = normaliseNode(C, Z ^ IBIT, Z);
-		}
-		while (numStackR) {
-			uint32_t C = pStackR[--numStackR];
+		freeMap(pChainR);
+		freeMap(pChainL);
+		return Z;
+	}
 
-			assert(!isNE(C));
-			Z = normaliseNode(C, Z ^ IBIT, Z);
-		}
+	/*
+	 * @date 2021-05-13 00:25:01
+	 *
+	 * Merge two OR chains by sort/merging lhs+rhs
+	 * Forks in chains are not allowed.
+	 * Duplicate nodes are merged into one (a OR a = a)
+	 */
+	inline uint32_t mergeOR(uint32_t lhs, uint32_t rhs) {
+		return mergeCascade(lhs, rhs, CASCADE_OR);
+	}
 
-		freeMap(pStackR);
-		freeMap(pStackL);
-		return Z;
+	/*
+	 * @date 2021-05-13 00:27:36
+	 *
+	 * Merge two NE chains by sort/merging lhs+rhs
+	 * Forks in chains are not allowed.
+	 * Duplicate nodes are removed (a NE a = 0)
+	 */
+	inline uint32_t mergeNE(uint32_t lhs, uint32_t rhs) {
+		return mergeCascade(lhs, rhs, CASCADE_NE);
 	}
 
 	/*
@@ -1857,99 +2246,8 @@ struct baseTree_t {
 	 * Forks in chains are not allowed.
 	 * Duplicate nodes are merged into one (a AND a = a)
 	 */
-	uint32_t mergeAND(uint32_t lhs, uint32_t rhs) {
-		uint32_t *pStackL  = allocMap();
-		uint32_t *pStackR  = allocMap();
-		uint32_t numStackR = 0;
-		uint32_t numStackL = 0;
-
-		if (!isAND(rhs)) {
-			pStackR[numStackR++] = rhs;
-		} else {
-			for (;;) {
-				if (!isAND(N[rhs].T))
-					pStackR[numStackR++] = N[rhs].T;
-				if (!isAND(N[rhs].Q))
-					pStackR[numStackR++] = N[rhs].Q;
-
-				if (isAND(N[rhs].Q))
-					rhs = N[rhs].Q;
-				else if (isAND(N[rhs].T))
-					rhs = N[rhs].T;
-				else
-					break;
-			}
-		}
-
-		if (!isAND(lhs)) {
-			pStackL[numStackL++] = lhs;
-		} else {
-			for (;;) {
-				if (!isAND(N[lhs].T))
-					pStackL[numStackL++] = N[lhs].T;
-				if (!isAND(N[lhs].Q))
-					pStackL[numStackL++] = N[lhs].Q;
-
-				if (isAND(N[lhs].Q))
-					lhs = N[lhs].Q;
-				else if (isAND(N[lhs].T))
-					lhs = N[lhs].T;
-				else
-					break;
-			}
-		}
-
-
-		uint32_t Z = 0;
-
-		while (numStackL && numStackR) {
-
-			// two AND's merge to one
-			if (numStackL >= 2 && pStackL[numStackL - 1] == pStackL[numStackL - 2]) {
-				numStackL--;
-			} else if (numStackR >= 2 && pStackR[numStackR - 1] == pStackR[numStackR - 2]) {
-				numStackR--;
-			} else if (pStackL[numStackL - 1] == pStackR[numStackR - 1]) {
-				numStackL--;
-			} else if (compare(this, pStackL[numStackL - 1], this, pStackR[numStackR - 1]) < 0) {
-
-				uint32_t C = pStackL[--numStackL];
-
-				assert(!isAND(C));
-				if (Z == 0) Z = C;
-				else
-					Z = normaliseNode(C, Z, 0);
-
-			} else {
-
-				uint32_t C = pStackR[--numStackR];
-
-				assert(!isAND(C));
-				if (Z == 0) Z = C;
-				else
-					Z = normaliseNode(C, Z, 0);
-			}
-		}
-
-		while (numStackL) {
-			uint32_t C = pStackL[--numStackL];
-
-			assert(!isAND(C));
-			if (Z == 0) Z = C;
-			else
-				Z = normaliseNode(C, Z, 0);
-		}
-		while (numStackR) {
-			uint32_t C = pStackR[--numStackR];
-
-			if (Z == 0) Z = C;
-			else
-				Z = normaliseNode(C, Z, 0);
-		}
-
-		freeMap(pStackR);
-		freeMap(pStackL);
-		return Z;
+	inline uint32_t mergeAND(uint32_t lhs, uint32_t rhs) {
+		return mergeCascade(lhs, rhs, CASCADE_AND);
 	}
 
 	/*
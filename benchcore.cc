@@ -0,0 +1,932 @@
+//#pragma GCC optimize ("O0") // optimize on demand
+
+/*
+ * @date 2026-10-17 17:40:06
+ *
+ * `benchcore` microbenchmarks of core kernels.
+ *
+ * Each kernel runs on generated fixtures with a fixed seed.
+ * Results are JSON lines on stdout, one per kernel.
+ * Redirect to a file to create a baseline, pass the baseline with `--baseline` to detect regressions.
+ *
+ * Kernels are repeated `--repeat` times and the fastest run reported to filter out noise.
+ * Kernels that modify state (tree construction, `saveFile()`, `rewriteNode()`) run once.
+ * File kernels count bytes as operations.
+ *
+ * ```
+ * ./benchcore transform.db > baseline.json
+ * ./benchcore transform.db --baseline=baseline.json
+ * ```
+ */
+
+/*
+ *	This file is part of Untangle, Information in fractal structures.
+ *	Copyright (C) 2017-2026, xyzzy@rockingship.org
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <assert.h>
+#include <ctype.h>
+#include <errno.h>
+#include <getopt.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "config.h"
+#include "database.h"
+#include "metrics.h"
+#include "rewritedata.h" // include before basetree.h
+#include "basetree.h"
+#include "tinytree.h"
+
+/**
+ * @date 2026-10-17 17:40:06
+ *
+ * Number of trees in `tinyTree_t` fixture
+ *
+ * @constant {number} BENCH_NUMTINY
+ */
+#define BENCH_NUMTINY 1024
+
+/**
+ * @date 2026-10-17 17:40:06
+ *
+ * Maximum number of kernels in baseline
+ *
+ * @constant {number} BENCH_MAXBASELINE
+ */
+#define BENCH_MAXBASELINE 256
+
+/*
+ * Fixed layout of the `baseTree_t` fixture
+ */
+#define KSTART 1
+#define NSTART (KSTART+MAXSLOTS)
+
+/**
+ * @date 2026-10-17 17:40:06
+ *
+ * Main program logic as application context
+ * It is contained as an independent `struct` so it can be easily included into projects/code
+ *
+ * @typedef {object}
+ */
+struct benchcoreContext_t {
+
+	/*
+	 * User specified program arguments and options
+	 */
+
+	/// @var {context_t} I/O context
+	context_t &ctx;
+
+	/// @var {string} name of input database
+	const char *arg_inputDatabase;
+	/// @var {string} --baseline, results of previous run
+	const char *opt_baseline;
+	/// @var {number} --count, base number of operations per kernel
+	unsigned opt_count;
+	/// @var {number} header flags
+	uint32_t opt_flags;
+	/// @var {string} --kernel, only run kernels starting with this name
+	const char *opt_kernel;
+	/// @var {number} --nodes, number of nodes in `baseTree_t` fixture
+	unsigned opt_nodes;
+	/// @var {number} --repeat, number of runs per kernel, fastest counts
+	unsigned opt_repeat;
+	/// @global {number} --seed=n, Random seed to generate fixtures
+	uint32_t opt_seed;
+	/// @var {number} --tolerance, percentage slower than baseline that counts as regression
+	unsigned opt_tolerance;
+
+	/// @var {database_t} - Database store with transforms
+	database_t *pStore;
+	/// @var {footprint_t[]} - Evaluator for forward transforms
+	footprint_t *pEvalFwd;
+	/// @var {footprint_t[]} - Evaluator for reverse transforms
+	footprint_t *pEvalRev;
+
+	/// @var {tinyTree_t[]} - fixture of small trees
+	tinyTree_t *pTiny[BENCH_NUMTINY];
+	/// @var {string[]} - names of fixture trees
+	char tinyNames[BENCH_NUMTINY][tinyTree_t::TINYTREE_NAMELEN + 1];
+	/// @var {string[]} - skins of fixture trees
+	char tinySkins[BENCH_NUMTINY][MAXSLOTS + 1];
+
+	/// @var {number} - number of kernels in baseline
+	unsigned numBaseline;
+	/// @var {string[]} - kernel names in baseline
+	char baselineNames[BENCH_MAXBASELINE][64];
+	/// @var {number[]} - nanoseconds per operation in baseline
+	double baselineNsPerOp[BENCH_MAXBASELINE];
+
+	/// @var {number} - number of kernels slower than baseline
+	unsigned numRegression;
+
+	benchcoreContext_t(context_t &ctx) : ctx(ctx) {
+		arg_inputDatabase = NULL;
+		opt_baseline      = NULL;
+		opt_count         = 1000000;
+		opt_flags         = 0;
+		opt_kernel        = NULL;
+		opt_nodes         = 1000000;
+		opt_repeat        = 5;
+		opt_seed          = 0x20261017;
+		opt_tolerance     = 10;
+
+		pStore   = NULL;
+		pEvalFwd = NULL;
+		pEvalRev = NULL;
+
+		for (unsigned i = 0; i < BENCH_NUMTINY; i++)
+			pTiny[i] = NULL;
+
+		numBaseline   = 0;
+		numRegression = 0;
+	}
+
+	/**
+	 * @date 2026-10-17 17:40:06
+	 *
+	 * Elapsed monotonic time
+	 *
+	 * @return {number} seconds
+	 */
+	static double now(void) {
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return ts.tv_sec + ts.tv_nsec * 1e-9;
+	}
+
+	/**
+	 * @date 2026-10-17 17:40:06
+	 *
+	 * Test if kernel is selected with `--kernel`
+	 *
+	 * @param {string} name - kernel name
+	 * @return {boolean} `true` if kernel should run
+	 */
+	bool wanted(const char *name) {
+		return opt_kernel == NULL || ::strncmp(name, opt_kernel, ::strlen(opt_kernel)) == 0;
+	}
+
+	/**
+	 * @date 2026-10-17 17:40:06
+	 *
+	 * Seed random generator per kernel, so fixtures do not depend on which kernels run before
+	 *
+	 * @param {string} name - kernel name
+	 */
+	void reseed(const char *name) {
+		uint32_t hash = opt_seed;
+
+		while (*name)
+			hash = (hash ^ (uint8_t) *name++) * 16777619; // FNV-1a
+
+		srand(hash);
+	}
+
+	/**
+	 * @date 2026-10-17 17:42:51
+	 *
+	 * Load results of a previous run.
+	 * Each line is a JSON object as emitted by `report()`.
+	 *
+	 * @param {string} fileName - baseline file
+	 */
+	void loadBaseline(const char *fileName) {
+		FILE *f = ::fopen(fileName, "r");
+		if (f == NULL)
+			ctx.fatal("\n{\"error\":\"fopen() failed\",\"where\":\"%s:%s:%d\",\"name\":\"%s\",\"reason\":\"%m\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__, fileName);
+
+		char line[1024];
+		while (::fgets(line, sizeof(line), f)) {
+			json_error_t jErr;
+			json_t       *jLine = json_loads(line, 0, &jErr);
+			if (jLine == NULL)
+				continue; // not a result line
+
+			const char *pName   = json_string_value(json_object_get(jLine, "bench"));
+			json_t     *jNsPerOp = json_object_get(jLine, "nsPerOp");
+
+			if (pName != NULL && jNsPerOp != NULL && numBaseline < BENCH_MAXBASELINE) {
+				::strncpy(baselineNames[numBaseline], pName, sizeof(baselineNames[numBaseline]) - 1);
+				baselineNsPerOp[numBaseline] = json_number_value(jNsPerOp);
+				numBaseline++;
+			}
+
+			json_delete(jLine);
+		}
+
+		::fclose(f);
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "[%s] Loaded %u baseline results from \"%s\"\n", ctx.timeAsString(), numBaseline, fileName);
+	}
+
+	/**
+	 * @date 2026-10-17 17:42:51
+	 *
+	 * Emit result of a kernel and compare against baseline
+	 *
+	 * @param {string} name - kernel name
+	 * @param {number} numOps - operations per run
+	 * @param {number} seconds - duration of fastest run
+	 * @param {number} checksum - kernel dependent, keeps compiler from optimising work away
+	 */
+	void report(const char *name, uint64_t numOps, double seconds, uint64_t checksum) {
+		if (seconds <= 0)
+			seconds = 1e-9;
+
+		double nsPerOp = seconds * 1e9 / numOps;
+
+		printf("{\"bench\":\"%s\",\"ops\":%lu,\"seconds\":%.6f,\"perSecond\":%.0f,\"nsPerOp\":%.3f,\"checksum\":\"%016lx\"",
+		       name, numOps, seconds, numOps / seconds, nsPerOp, checksum);
+
+		for (unsigned i = 0; i < numBaseline; i++) {
+			if (::strcmp(baselineNames[i], name) == 0) {
+				double ratio = nsPerOp / baselineNsPerOp[i];
+				bool   isSlower = ratio > 1.0 + opt_tolerance / 100.0;
+
+				printf(",\"baseline\":%.3f,\"ratio\":%.3f,\"regression\":%s", baselineNsPerOp[i], ratio, isSlower ? "true" : "false");
+				if (isSlower)
+					numRegression++;
+				break;
+			}
+		}
+
+		printf("}\n");
+	}
+
+	/**
+	 * @date 2026-10-17 17:45:30
+	 *
+	 * Create fixture of random small trees.
+	 * Random postfix notations are normalised by `loadStringSafe()`, trees that collapse to an endpoint are dropped.
+	 */
+	void createTinyFixture(void) {
+		tinyTree_t tree(ctx);
+		char       name[tinyTree_t::TINYTREE_NAMELEN + 1];
+
+		reseed("tinyTree_t");
+
+		for (unsigned iTree = 0; iTree < BENCH_NUMTINY;) {
+			unsigned numOp    = 1 + rand() % 5;
+			unsigned stackPos = 0;
+			unsigned len      = 0;
+
+			while (numOp > 0 || stackPos > 1) {
+				if (stackPos < 2 || (numOp > 0 && stackPos < 3 && rand() % 2)) {
+					// endpoint
+					name[len++] = 'a' + rand() % MAXSLOTS;
+					stackPos++;
+				} else if (stackPos >= 3 && rand() % 2) {
+					// ternary
+					name[len++] = "?!"[rand() % 2];
+					stackPos -= 2;
+					if (numOp) numOp--;
+				} else {
+					// binary
+					name[len++] = "&+^>"[rand() % 4];
+					stackPos -= 1;
+					if (numOp) numOp--;
+				}
+			}
+			name[len] = 0;
+
+			if (tree.loadStringSafe(name) != 0)
+				continue; // too large
+			if ((tree.root & ~IBIT) < tinyTree_t::TINYTREE_NSTART)
+				continue; // collapsed
+
+			tree.saveString(tree.root, tinyNames[iTree], tinySkins[iTree]);
+
+			pTiny[iTree] = new tinyTree_t(ctx);
+			pTiny[iTree]->loadStringFast(tinyNames[iTree], tinySkins[iTree]);
+			iTree++;
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 17:48:14
+	 *
+	 * Kernels on `tinyTree_t`
+	 */
+	void benchTiny(void) {
+		unsigned numOps = opt_count * 4;
+
+		if (wanted("tinyEval")) {
+			double   best     = 1e99;
+			uint64_t checksum = 0;
+
+			for (unsigned iRepeat = 0; iRepeat < opt_repeat; iRepeat++) {
+				double tsStart = now();
+
+				checksum = 0;
+				for (unsigned i = 0; i < numOps; i++) {
+					const tinyTree_t *pTree = pTiny[i % BENCH_NUMTINY];
+
+					pTree->eval(pEvalFwd);
+					checksum += pEvalFwd[pTree->root & ~IBIT].bits[0];
+				}
+
+				double seconds = now() - tsStart;
+				if (seconds < best)
+					best = seconds;
+			}
+			report("tinyEval", numOps, best, checksum);
+		}
+
+		if (wanted("loadStringFast")) {
+			tinyTree_t tree(ctx);
+			double     best     = 1e99;
+			uint64_t   checksum = 0;
+
+			for (unsigned iRepeat = 0; iRepeat < opt_repeat; iRepeat++) {
+				double tsStart = now();
+
+				checksum = 0;
+				for (unsigned i = 0; i < numOps; i++) {
+					tree.loadStringFast(tinyNames[i % BENCH_NUMTINY], tinySkins[i % BENCH_NUMTINY]);
+					checksum += tree.root + tree.count;
+				}
+
+				double seconds = now() - tsStart;
+				if (seconds < best)
+					best = seconds;
+			}
+			report("loadStringFast", numOps, best, checksum);
+		}
+
+		if (wanted("saveString")) {
+			char     name[tinyTree_t::TINYTREE_NAMELEN + 1];
+			char     skin[MAXSLOTS + 1];
+			double   best     = 1e99;
+			uint64_t checksum = 0;
+
+			for (unsigned iRepeat = 0; iRepeat < opt_repeat; iRepeat++) {
+				double tsStart = now();
+
+				checksum = 0;
+				for (unsigned i = 0; i < numOps; i++) {
+					const tinyTree_t *pTree = pTiny[i % BENCH_NUMTINY];
+
+					pTree->saveString(pTree->root, name, skin);
+					checksum += name[0] + skin[0];
+				}
+
+				double seconds = now() - tsStart;
+				if (seconds < best)
+					best = seconds;
+			}
+			report("saveString", numOps, best, checksum);
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 17:52:37
+	 *
+	 * `lookupImprintAssociative()` for every practical interleave.
+	 * Like `selftest` the imprints are of a single tree with unique endpoints, lookups are random skins of it.
+	 * The number of lookups scales down with the runtime cost of the interleave.
+	 */
+	void benchImprint(void) {
+		const char *pBasename = "abc!defg!!hi!";
+		tinyTree_t tree(ctx);
+
+		for (const metricsInterleave_t *pInterleave = metricsInterleave; pInterleave->numSlot; pInterleave++) {
+			if (pInterleave->noauto & 2)
+				continue; // skip impractical
+			if (pInterleave->numSlot != MAXSLOTS)
+				continue; // only process settings that match `MAXSLOTS`
+
+			char kernelName[64];
+			sprintf(kernelName, "lookupImprintAssociative/%u", pInterleave->numStored);
+			if (!wanted(kernelName))
+				continue;
+
+			// setup database and erase imprints
+			pStore->interleave     = pInterleave->numStored;
+			pStore->interleaveStep = pInterleave->interleaveStep;
+
+			::memset(pStore->imprintIndex, 0, pStore->imprintIndexSize * sizeof(*pStore->imprintIndex));
+			pStore->clearImprintFilter();
+			pStore->numImprint = 1; // skip reserved entry
+
+			tree.loadStringFast(pBasename);
+			pStore->addImprintAssociative(&tree, pEvalFwd, pEvalRev, 1);
+
+			// lookups with the runtime cost of the interleave are about equal
+			unsigned numRuntime = MAXTRANSFORM / pInterleave->numStored;
+			unsigned numOps     = opt_count / numRuntime;
+			if (numOps < 1000)
+				numOps = 1000;
+
+			// pre-select skins, outside timing
+			reseed(kernelName);
+			uint32_t *pTid = (uint32_t *) ctx.myAlloc("pTid", numOps, sizeof(*pTid));
+			for (unsigned i = 0; i < numOps; i++)
+				pTid[i] = rand() % MAXTRANSFORM;
+
+			double   best     = 1e99;
+			uint64_t checksum = 0;
+
+			for (unsigned iRepeat = 0; iRepeat < opt_repeat; iRepeat++) {
+				double tsStart = now();
+
+				checksum = 0;
+				for (unsigned i = 0; i < numOps; i++) {
+					unsigned sid, tid;
+
+					tree.loadStringFast(pBasename, pStore->fwdTransformNames[pTid[i]]);
+
+					if (!pStore->lookupImprintAssociative(&tree, pEvalFwd, pEvalRev, &sid, &tid))
+						ctx.fatal("\n{\"error\":\"tree not found\",\"where\":\"%s:%s:%d\",\"interleave\":%u,\"tid\":\"%s\"}\n",
+							  __FUNCTION__, __FILE__, __LINE__, pStore->interleave, pStore->fwdTransformNames[pTid[i]]);
+
+					checksum += tid;
+				}
+
+				double seconds = now() - tsStart;
+				if (seconds < best)
+					best = seconds;
+			}
+			report(kernelName, numOps, best, checksum);
+
+			ctx.myFree("pTid", pTid);
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 17:56:02
+	 *
+	 * Construct `baseTree_t` fixture with random `normaliseNode()` calls referencing earlier nodes.
+	 * Nodes are added until `--nodes` is reached, construction is timed.
+	 *
+	 * @param {string} name - kernel name
+	 * @param {number} flags - tree flags
+	 * @param {number} maxNodes - tree capacity, headroom for rewrites
+	 * @return {baseTree_t} fixture
+	 */
+	baseTree_t *createBaseFixture(const char *name, uint32_t flags, unsigned maxNodes) {
+		baseTree_t *pTree = new baseTree_t(ctx, KSTART, NSTART, NSTART, NSTART, NSTART/*numRoots*/, maxNodes, flags);
+
+		// setup key/root names
+		for (unsigned iKey = 0; iKey < pTree->nstart; iKey++) {
+			char keyName[16];
+			sprintf(keyName, "k%u", iKey);
+			pTree->keyNames[iKey] = keyName;
+		}
+		for (unsigned iRoot = 0; iRoot < pTree->numRoots; iRoot++) {
+			char rootName[16];
+			sprintf(rootName, "o%u", iRoot);
+			pTree->rootNames[iRoot] = rootName;
+		}
+
+		reseed(name);
+
+		uint64_t numOps   = 0;
+		uint64_t checksum = 0;
+		double   tsStart  = now();
+
+		while (pTree->ncount < NSTART + opt_nodes) {
+			uint32_t Q = rand() % pTree->ncount;
+			uint32_t T = (rand() % pTree->ncount) ^ ((rand() & 1) ? IBIT : 0);
+			uint32_t F = rand() % pTree->ncount;
+
+			checksum += pTree->normaliseNode(Q, T, F);
+			numOps++;
+		}
+
+		double seconds = now() - tsStart;
+
+		// the last nodes become roots
+		for (unsigned iRoot = 0; iRoot < pTree->numRoots; iRoot++)
+			pTree->roots[iRoot] = pTree->ncount - 1 - iRoot;
+
+		if (wanted(name))
+			report(name, numOps, seconds, checksum);
+
+		return pTree;
+	}
+
+	/**
+	 * @date 2026-10-17 17:58:44
+	 *
+	 * Kernels on `baseTree_t`
+	 */
+	void benchBase(void) {
+		/*
+		 * Construction using `normaliseNode()`
+		 */
+		baseTree_t *pTree = createBaseFixture("normaliseNode", opt_flags, NSTART + opt_nodes + 100);
+
+		if (wanted("lookupNode")) {
+			unsigned numOps = opt_count * 4;
+
+			// pre-select existing nodes, outside timing
+			reseed("lookupNode");
+			uint32_t *pNid = (uint32_t *) ctx.myAlloc("pNid", numOps, sizeof(*pNid));
+			for (unsigned i = 0; i < numOps; i++)
+				pNid[i] = NSTART + rand() % (pTree->ncount - NSTART);
+
+			double   best     = 1e99;
+			uint64_t checksum = 0;
+
+			for (unsigned iRepeat = 0; iRepeat < opt_repeat; iRepeat++) {
+				double tsStart = now();
+
+				checksum = 0;
+				for (unsigned i = 0; i < numOps; i++) {
+					const baseNode_t *pNode = pTree->N + pNid[i];
+
+					checksum += pTree->lookupNode(pNode->Q, pNode->T, pNode->F);
+				}
+
+				double seconds = now() - tsStart;
+				if (seconds < best)
+					best = seconds;
+			}
+			report("lookupNode", numOps, best, checksum);
+
+			ctx.myFree("pNid", pNid);
+		}
+
+		if (wanted("compare")) {
+			unsigned numOps = opt_count;
+
+			reseed("compare");
+
+			uint32_t *pLhs = (uint32_t *) ctx.myAlloc("pLhs", numOps, sizeof(*pLhs));
+			uint32_t *pRhs = (uint32_t *) ctx.myAlloc("pRhs", numOps, sizeof(*pRhs));
+			for (unsigned i = 0; i < numOps; i++) {
+				pLhs[i] = NSTART + rand() % (pTree->ncount - NSTART);
+				pRhs[i] = NSTART + rand() % (pTree->ncount - NSTART);
+			}
+
+			double   best     = 1e99;
+			uint64_t checksum = 0;
+
+			for (unsigned iRepeat = 0; iRepeat < opt_repeat; iRepeat++) {
+				double tsStart = now();
+
+				checksum = 0;
+				for (unsigned i = 0; i < numOps; i++)
+					checksum = checksum * 7 + (unsigned) (baseTree_t::compare(pTree, pLhs[i], pTree, pRhs[i]) + 3);
+
+				double seconds = now() - tsStart;
+				if (seconds < best)
+					best = seconds;
+			}
+			report("compare", numOps, best, checksum);
+
+			ctx.myFree("pLhs", pLhs);
+			ctx.myFree("pRhs", pRhs);
+		}
+
+		if (wanted("saveFile") || wanted("loadFile")) {
+			char fileName[64];
+			sprintf(fileName, "/tmp/benchcore-XXXXXX");
+
+			int hndl = ::mkstemp(fileName);
+			if (hndl < 0)
+				ctx.fatal("\n{\"error\":\"mkstemp() failed\",\"where\":\"%s:%s:%d\",\"name\":\"%s\",\"reason\":\"%m\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__, fileName);
+			::close(hndl);
+
+			double tsStart = now();
+			pTree->saveFile(fileName, false);
+			double seconds = now() - tsStart;
+
+			// only nodes reachable from roots are saved, measure in bytes
+			struct stat sbuf;
+			if (::stat(fileName, &sbuf))
+				ctx.fatal("\n{\"error\":\"stat() failed\",\"where\":\"%s:%s:%d\",\"name\":\"%s\",\"reason\":\"%m\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__, fileName);
+
+			if (wanted("saveFile"))
+				report("saveFile", sbuf.st_size, seconds, sbuf.st_size);
+
+			if (wanted("loadFile")) {
+				double   best     = 1e99;
+				uint64_t checksum = 0;
+
+				for (unsigned iRepeat = 0; iRepeat < opt_repeat; iRepeat++) {
+					baseTree_t *pLoad = new baseTree_t(ctx);
+
+					tsStart = now();
+					pLoad->loadFile(fileName, false); // private copy, forces full read
+					seconds = now() - tsStart;
+
+					if (seconds < best)
+						best = seconds;
+
+					checksum = pLoad->ncount;
+
+					delete pLoad;
+				}
+				report("loadFile", sbuf.st_size, best, checksum);
+			}
+
+			::unlink(fileName);
+		}
+
+		delete pTree;
+
+		/*
+		 * Construction and rewrites with `MAGICMASK_REWRITE`
+		 */
+		// `rewritedata.c` placeholder leaves the weak symbols undefined
+		if (&rewriteDataFirst == NULL || !(wanted("normaliseNode/rewrite") || wanted("rewriteNode")))
+			return;
+
+		unsigned numRewrite = opt_count;
+
+		// rewrites create nodes
+		pTree = createBaseFixture("normaliseNode/rewrite", opt_flags | ctx.MAGICMASK_REWRITE, NSTART + opt_nodes + numRewrite * 8);
+
+		if (wanted("rewriteNode")) {
+			// random operands, only `Q != 0` and uninverted `Q`/`F` as `rewriteNode()` asserts
+			reseed("rewriteNode");
+
+			uint32_t *pQ = (uint32_t *) ctx.myAlloc("pQ", numRewrite, sizeof(*pQ));
+			uint32_t *pT = (uint32_t *) ctx.myAlloc("pT", numRewrite, sizeof(*pT));
+			uint32_t *pF = (uint32_t *) ctx.myAlloc("pF", numRewrite, sizeof(*pF));
+
+			for (unsigned i = 0; i < numRewrite; i++) {
+				pQ[i] = 1 + rand() % (pTree->ncount - 1);
+				pT[i] = (rand() % pTree->ncount) ^ ((rand() & 1) ? IBIT : 0);
+				pF[i] = rand() % pTree->ncount;
+			}
+
+			// runs once, later runs would find the nodes created by the first
+			uint64_t checksum = 0;
+			double   tsStart  = now();
+
+			for (unsigned i = 0; i < numRewrite; i++)
+				checksum += pTree->rewriteNode(pQ[i], pT[i], pF[i]);
+
+			report("rewriteNode", numRewrite, now() - tsStart, checksum);
+
+			ctx.myFree("pQ", pQ);
+			ctx.myFree("pT", pT);
+			ctx.myFree("pF", pF);
+		}
+
+		delete pTree;
+	}
+
+	void main(void) {
+		if (opt_baseline)
+			loadBaseline(opt_baseline);
+
+		/*
+		 * Open database, create store for imprints
+		 */
+
+		database_t db(ctx);
+
+		db.open(arg_inputDatabase);
+
+		if (db.numTransform == 0)
+			ctx.fatal("\n{\"error\":\"missing transform section\",\"where\":\"%s:%s:%d\",\"database\":\"%s\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__, arg_inputDatabase);
+
+		database_t store(ctx);
+
+		store.maxImprint       = MAXTRANSFORM + 10;
+		store.imprintIndexSize = ctx.nextPrime(store.maxImprint * 2);
+
+		store.create(0);
+		pStore = &store;
+
+		store.inheritSections(&db, arg_inputDatabase, database_t::ALLOCMASK_TRANSFORM);
+
+		pEvalFwd = (footprint_t *) ctx.myAlloc("benchcoreContext_t::pEvalFwd", tinyTree_t::TINYTREE_NEND * MAXTRANSFORM, sizeof(*pEvalFwd));
+		pEvalRev = (footprint_t *) ctx.myAlloc("benchcoreContext_t::pEvalRev", tinyTree_t::TINYTREE_NEND * MAXTRANSFORM, sizeof(*pEvalRev));
+
+		tinyTree_t::initialiseEvaluator(ctx, pEvalFwd, MAXTRANSFORM, store.fwdTransformData);
+		tinyTree_t::initialiseEvaluator(ctx, pEvalRev, MAXTRANSFORM, store.revTransformData);
+
+		/*
+		 * Run kernels
+		 */
+
+		createTinyFixture();
+
+		benchTiny();
+		benchImprint();
+		benchBase();
+
+		/*
+		 * Release
+		 */
+
+		for (unsigned i = 0; i < BENCH_NUMTINY; i++)
+			delete pTiny[i];
+
+		ctx.myFree("benchcoreContext_t::pEvalFwd", pEvalFwd);
+		ctx.myFree("benchcoreContext_t::pEvalRev", pEvalRev);
+
+		if (numRegression) {
+			if (ctx.opt_verbose >= ctx.VERBOSE_WARNING)
+				fprintf(stderr, "[%s] %u kernels slower than baseline by more than %u%%\n", ctx.timeAsString(), numRegression, opt_tolerance);
+			exit(1);
+		}
+	}
+
+};
+
+/*
+ * Resource context.
+ * Needs to be global to be accessible by signal handlers.
+ *
+ * @global {context_t} Application context
+ */
+context_t ctx;
+
+/*
+ * Application context.
+ * Needs to be global to be accessible by signal handlers.
+ *
+ * @global {benchcoreContext_t} Application context
+ */
+benchcoreContext_t app(ctx);
+
+void usage(char *argv[], bool verbose) {
+	fprintf(stderr, "usage: %s <input.db>\n", argv[0]);
+	if (verbose) {
+		fprintf(stderr, "\t   --baseline=<file>     Compare against results of previous run\n");
+		fprintf(stderr, "\t   --count=<number>      Base number of operations per kernel [default=%u]\n", app.opt_count);
+		fprintf(stderr, "\t   --kernel=<name>       Only run kernels starting with name\n");
+		fprintf(stderr, "\t   --nodes=<number>      Number of nodes in tree fixture [default=%u]\n", app.opt_nodes);
+		fprintf(stderr, "\t-q --quiet               Say less\n");
+		fprintf(stderr, "\t   --repeat=<number>     Runs per kernel, fastest counts [default=%u]\n", app.opt_repeat);
+		fprintf(stderr, "\t   --seed=<number>       Random seed for fixtures [default=%u]\n", app.opt_seed);
+		fprintf(stderr, "\t   --tolerance=<percent> Slowdown that counts as regression [default=%u]\n", app.opt_tolerance);
+		fprintf(stderr, "\t-v --verbose             Say more\n");
+		fprintf(stderr, "\t   --[no-]cascade        Tree fixture with cascading [default=%s]\n", app.opt_flags & ctx.MAGICMASK_CASCADE ? "enabled" : "disabled");
+		fprintf(stderr, "\t   --[no-]pure           Tree fixture with QnTF-only [default=%s]\n", app.opt_flags & ctx.MAGICMASK_PURE ? "enabled" : "disabled");
+	}
+}
+
+int main(int argc, char *argv[]) {
+	setlinebuf(stdout);
+
+	/*
+	 *  Process program options
+	 */
+	for (;;) {
+		// Long option shortcuts
+		enum {
+			// long-only opts
+			LO_BASELINE = 1,
+			LO_CASCADE,
+			LO_COUNT,
+			LO_DEBUG,
+			LO_KERNEL,
+			LO_NOCASCADE,
+			LO_NODES,
+			LO_NOPURE,
+			LO_PURE,
+			LO_REPEAT,
+			LO_SEED,
+			LO_TOLERANCE,
+			// short opts
+			LO_HELP    = 'h',
+			LO_QUIET   = 'q',
+			LO_VERBOSE = 'v',
+		};
+
+		// long option descriptions
+		static struct option long_options[] = {
+			/* name, has_arg, flag, val */
+			{"baseline",   1, 0, LO_BASELINE},
+			{"cascade",    0, 0, LO_CASCADE},
+			{"count",      1, 0, LO_COUNT},
+			{"debug",      1, 0, LO_DEBUG},
+			{"help",       0, 0, LO_HELP},
+			{"kernel",     1, 0, LO_KERNEL},
+			{"no-cascade", 0, 0, LO_NOCASCADE},
+			{"no-pure",    0, 0, LO_NOPURE},
+			{"nodes",      1, 0, LO_NODES},
+			{"pure",       0, 0, LO_PURE},
+			{"quiet",      2, 0, LO_QUIET},
+			{"repeat",     1, 0, LO_REPEAT},
+			{"seed",       1, 0, LO_SEED},
+			{"tolerance",  1, 0, LO_TOLERANCE},
+			{"verbose",    2, 0, LO_VERBOSE},
+			//
+			{NULL,         0, 0, 0}
+		};
+
+		char optstring[64];
+		char *cp                            = optstring;
+		int  option_index                   = 0;
+
+		/* construct optarg */
+		for (int i = 0; long_options[i].name; i++) {
+			if (isalpha(long_options[i].val)) {
+				*cp++ = (char) long_options[i].val;
+
+				if (long_options[i].has_arg != 0)
+					*cp++ = ':';
+				if (long_options[i].has_arg == 2)
+					*cp++ = ':';
+			}
+		}
+		*cp = '\0';
+
+		// parse long options
+		int c = getopt_long(argc, argv, optstring, long_options, &option_index);
+		if (c == -1)
+			break;
+
+		switch (c) {
+		case LO_BASELINE:
+			app.opt_baseline = optarg;
+			break;
+		case LO_CASCADE:
+			app.opt_flags |= ctx.MAGICMASK_CASCADE;
+			break;
+		case LO_COUNT:
+			app.opt_count = ::strtoul(optarg, NULL, 0);
+			break;
+		case LO_DEBUG:
+			ctx.opt_debug = ::strtoul(optarg, NULL, 8); // OCTAL!!
+			break;
+		case LO_HELP:
+			usage(argv, true);
+			exit(0);
+		case LO_KERNEL:
+			app.opt_kernel = optarg;
+			break;
+		case LO_NOCASCADE:
+			app.opt_flags &= ~ctx.MAGICMASK_CASCADE;
+			break;
+		case LO_NODES:
+			app.opt_nodes = ::strtoul(optarg, NULL, 0);
+			break;
+		case LO_NOPURE:
+			app.opt_flags &= ~ctx.MAGICMASK_PURE;
+			break;
+		case LO_PURE:
+			app.opt_flags |= ctx.MAGICMASK_PURE;
+			break;
+		case LO_QUIET:
+			ctx.opt_verbose = optarg ? ::strtoul(optarg, NULL, 0) : ctx.opt_verbose - 1;
+			break;
+		case LO_REPEAT:
+			app.opt_repeat = ::strtoul(optarg, NULL, 0);
+			break;
+		case LO_SEED:
+			app.opt_seed = ::strtoul(optarg, NULL, 0);
+			break;
+		case LO_TOLERANCE:
+			app.opt_tolerance = ::strtoul(optarg, NULL, 0);
+			break;
+		case LO_VERBOSE:
+			ctx.opt_verbose = optarg ? ::strtoul(optarg, NULL, 0) : ctx.opt_verbose + 1;
+			break;
+
+		case '?':
+			fprintf(stderr, "Try `%s --help' for more information.\n", argv[0]);
+			exit(1);
+		default:
+			fprintf(stderr, "getopt_long() returned character code %d\n", c);
+			exit(1);
+		}
+	}
+
+	/*
+	 * Program arguments
+	 */
+	if (argc - optind >= 1)
+		app.arg_inputDatabase = argv[optind++];
+
+	if (app.arg_inputDatabase == NULL || app.opt_count < 1 || app.opt_nodes < 1 || app.opt_repeat < 1) {
+		usage(argv, false);
+		exit(1);
+	}
+
+	app.main();
+
+	return 0;
+}
@@ -0,0 +1,319 @@
+//#pragma GCC optimize ("O0") // optimize on demand
+
+/*
+ * benchrewrite.cc
+ * 	Microbenchmark comparing `baseTree_t::lookupRewrite()` engines.
+ *
+ * 	The plain walk performs a dependent load into `rewriteData[]` per transition.
+ * 	The compact engine caches walk results per packed Q/T/F neighbourhood.
+ *
+ * 	Fixture is a pool of single-level nodes and a fixed-seed sequence of top-level Q/T/F combinations referencing them.
+ * 	The size of the pool determines locality. Each engine processes the identical sequence, results must match.
+ */
+
+/*
+ *	This file is part of Untangle, Information in fractal structures.
+ *	Copyright (C) 2017-2026, xyzzy@rockingship.org
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <assert.h>
+#include <ctype.h>
+#include <getopt.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "rewritedata.h" // include before basetree.h
+#include "basetree.h"
+
+#define KSTART 1
+#define NSTART (KSTART+MAXSLOTS)
+
+struct benchrewriteContext_t {
+
+	/// @var {context_t} I/O context
+	context_t &ctx;
+
+	/// @var {number} header flags
+	uint32_t opt_flags;
+	/// @var {number} --count, number of lookups in sequence
+	unsigned opt_count;
+	/// @var {number} --pool, number of distinct nodes to reference
+	unsigned opt_pool;
+	/// @var {number} --repeat, passes over sequence per engine
+	unsigned opt_repeat;
+	/// @global {number} --seed=n, Random seed to generate fixture
+	uint32_t opt_seed;
+
+	/// @var {number[]} Q/T/F sequence
+	uint32_t *pQ, *pT, *pF;
+
+	benchrewriteContext_t(context_t &ctx) : ctx(ctx) {
+		opt_flags  = ctx.MAGICMASK_REWRITE;
+		opt_count  = 1000000;
+		opt_pool   = 1000;
+		opt_repeat = 10;
+		opt_seed   = 0x20261017;
+
+		pQ = pT = pF = NULL;
+	}
+
+	/**
+	 * @date 2026-10-17 17:05:48
+	 *
+	 * Elapsed monotonic time
+	 *
+	 * @return {number} seconds
+	 */
+	static double now(void) {
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return ts.tv_sec + ts.tv_nsec * 1e-9;
+	}
+
+	/**
+	 * @date 2026-10-17 17:08:12
+	 *
+	 * Time one engine over the sequence
+	 *
+	 * @param {baseTree_t} tree - tree with fixture nodes
+	 * @param {string} name - engine name for report
+	 * @return {number} checksum over rewrite data
+	 */
+	uint64_t run(baseTree_t &tree, const char *name) {
+		uint32_t slots[16];
+		uint64_t checksum = 0;
+
+		// warm up, and fill cache when compact
+		for (unsigned i = 0; i < opt_count; i++)
+			checksum += tree.lookupRewrite(pQ[i], pT[i], pF[i], slots);
+
+		checksum        = 0;
+		double tsStart = now();
+
+		for (unsigned iRepeat = 0; iRepeat < opt_repeat; iRepeat++) {
+			for (unsigned i = 0; i < opt_count; i++)
+				checksum = checksum * 31 + tree.lookupRewrite(pQ[i], pT[i], pF[i], slots);
+		}
+
+		double seconds = now() - tsStart;
+		double total   = (double) opt_count * opt_repeat;
+
+		printf("{\"engine\":\"%s\",\"pool\":%u,\"count\":%u,\"repeat\":%u,\"seconds\":%.6f,\"perSecond\":%.0f,\"nsPerLookup\":%.2f,\"checksum\":\"%016lx\"}\n",
+		       name, opt_pool, opt_count, opt_repeat, seconds, total / seconds, seconds * 1e9 / total, checksum);
+
+		return checksum;
+	}
+
+	void main(void) {
+		baseTree_t tree(ctx, KSTART, NSTART, NSTART, NSTART, 1/*numRoots*/, NSTART + opt_pool + 100/*slack for rewrite intermediates*/, opt_flags);
+
+		/*
+		 * Pool of nodes, normalised so they are valid rewrite operands.
+		 * Nodes can reference pool nodes, `lookupRewrite()` only inspects two levels.
+		 */
+		srand(opt_seed);
+
+		while (tree.ncount < NSTART + opt_pool) {
+			uint32_t Q = rand() % tree.ncount;
+			uint32_t T = (rand() % tree.ncount) ^ ((rand() & 1) ? IBIT : 0);
+			uint32_t F = rand() % tree.ncount;
+
+			tree.normaliseNode(Q, T, F);
+		}
+
+		/*
+		 * Sequence of top-level combinations that level-1/level-2 would not fold, as `normaliseNode()` passes to `lookupRewrite()`
+		 */
+		pQ = (uint32_t *) ctx.myAlloc("pQ", opt_count, sizeof(*pQ));
+		pT = (uint32_t *) ctx.myAlloc("pT", opt_count, sizeof(*pT));
+		pF = (uint32_t *) ctx.myAlloc("pF", opt_count, sizeof(*pF));
+
+		for (unsigned i = 0; i < opt_count;) {
+			uint32_t Q = rand() % tree.ncount;
+			uint32_t T = (rand() % tree.ncount) ^ ((rand() & 1) ? IBIT : 0);
+			uint32_t F = rand() % tree.ncount;
+
+			// constants and collapses
+			if (Q == 0 || T == 0 || (T == IBIT && F == 0))
+				continue;
+			if ((T & ~IBIT) == Q || F == Q || T == F)
+				continue;
+
+			pQ[i] = Q;
+			pT[i] = T;
+			pF[i] = F;
+			i++;
+		}
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "[%s] Fixture pool=%u count=%u\n", ctx.timeAsString(), opt_pool, opt_count);
+
+		/*
+		 * Measure
+		 */
+		tree.enableRewriteCompact(false);
+		uint64_t walkChecksum = run(tree, "walk");
+
+		tree.enableRewriteCompact(true);
+		uint64_t compactChecksum = run(tree, "compact");
+
+		if (walkChecksum != compactChecksum)
+			ctx.fatal("\n{\"error\":\"engines disagree\",\"where\":\"%s:%s:%d\",\"walk\":\"%016lx\",\"compact\":\"%016lx\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__, walkChecksum, compactChecksum);
+
+		ctx.myFree("pQ", pQ);
+		ctx.myFree("pT", pT);
+		ctx.myFree("pF", pF);
+	}
+
+};
+
+/*
+ * Resource context.
+ * Needs to be global to be accessible by signal handlers.
+ *
+ * @global {context_t} Application context
+ */
+context_t ctx;
+
+/*
+ * Application context.
+ * Needs to be global to be accessible by signal handlers.
+ *
+ * @global {benchrewriteContext_t} Application context
+ */
+benchrewriteContext_t app(ctx);
+
+void usage(char *const *argv, bool verbose) {
+	fprintf(stderr, "usage: %s\n", argv[0]);
+	if (verbose) {
+		fprintf(stderr, "\t   --count=<number> [default=%u]\n", app.opt_count);
+		fprintf(stderr, "\t   --pool=<number> [default=%u]\n", app.opt_pool);
+		fprintf(stderr, "\t-q --quiet\n");
+		fprintf(stderr, "\t   --repeat=<number> [default=%u]\n", app.opt_repeat);
+		fprintf(stderr, "\t-n --seed=<seed> [default=%u]\n", app.opt_seed);
+		fprintf(stderr, "\t-v --verbose\n");
+
+		fprintf(stderr, "\t   --[no-]pure [default=%s]\n", app.opt_flags & ctx.MAGICMASK_PURE ? "enabled" : "disabled");
+	}
+}
+
+int main(int argc, char *argv[]) {
+	setlinebuf(stdout);
+
+	/*
+	 * scan options
+	 */
+
+	for (;;) {
+		enum {
+			LO_HELP     = 1, LO_DEBUG, LO_COUNT, LO_POOL, LO_REPEAT, LO_SEED,
+			LO_PURE, LO_NOPURE,
+			LO_QUIET = 'q', LO_VERBOSE = 'v'
+		};
+
+		static struct option long_options[] = {
+			/* name, has_arg, flag, val */
+			{"count",   1, 0, LO_COUNT},
+			{"debug",   1, 0, LO_DEBUG},
+			{"help",    0, 0, LO_HELP},
+			{"pool",    1, 0, LO_POOL},
+			{"quiet",   2, 0, LO_QUIET},
+			{"repeat",  1, 0, LO_REPEAT},
+			{"seed",    1, 0, LO_SEED},
+			{"verbose", 2, 0, LO_VERBOSE},
+			//
+			{"pure",    0, 0, LO_PURE},
+			{"no-pure", 0, 0, LO_NOPURE},
+			//
+			{NULL,      0, 0, 0}
+		};
+
+		char optstring[64];
+		char *cp                            = optstring;
+		int  option_index                   = 0;
+
+		for (int i = 0; long_options[i].name; i++) {
+			if (isalpha(long_options[i].val)) {
+				*cp++ = (char) long_options[i].val;
+
+				if (long_options[i].has_arg)
+					*cp++ = ':';
+				if (long_options[i].has_arg == 2)
+					*cp++ = ':';
+			}
+		}
+
+		*cp = '\0';
+
+		int c = getopt_long(argc, argv, optstring, long_options, &option_index);
+		if (c == -1)
+			break;
+
+		switch (c) {
+		case LO_COUNT:
+			app.opt_count = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_DEBUG:
+			ctx.opt_debug = (unsigned) strtoul(optarg, NULL, 8); // OCTAL!!
+			break;
+		case LO_HELP:
+			usage(argv, true);
+			exit(0);
+		case LO_POOL:
+			app.opt_pool = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_QUIET:
+			ctx.opt_verbose = optarg ? (unsigned) strtoul(optarg, NULL, 10) : ctx.opt_verbose - 1;
+			break;
+		case LO_REPEAT:
+			app.opt_repeat = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_SEED:
+			app.opt_seed = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_VERBOSE:
+			ctx.opt_verbose = optarg ? (unsigned) strtoul(optarg, NULL, 10) : ctx.opt_verbose + 1;
+			break;
+
+		case LO_PURE:
+			app.opt_flags |= ctx.MAGICMASK_PURE;
+			break;
+		case LO_NOPURE:
+			app.opt_flags &= ~ctx.MAGICMASK_PURE;
+			break;
+
+		case '?':
+			fprintf(stderr, "Try `%s --help' for more information.\n", argv[0]);
+			exit(1);
+		default:
+			fprintf(stderr, "getopt returned character code %d\n", c);
+			exit(1);
+		}
+	}
+
+	if (app.opt_count < 1 || app.opt_pool < 1 || app.opt_repeat < 1) {
+		usage(argv, false);
+		exit(1);
+	}
+
+	app.main();
+
+	return 0;
+}
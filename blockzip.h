@@ -0,0 +1,520 @@
+#ifndef _BLOCKZIP_H
+#define _BLOCKZIP_H
+
+/*
+ * @date 2026-10-17 19:52:14
+ *
+ * `blockzip.h` block-compressed container for database images.
+ *
+ * The database image (header plus sections, as written by `database_t::save()`) is split in fixed-size blocks.
+ * Each block is compressed independently with a small LZ77 codec (LZ4 block layout), which makes compression and decompression
+ * embarrassingly parallel and allows decompressing only the blocks covering selected sections.
+ *
+ * Container layout:
+ *
+ *   blockZipHeader_t     magic, sizes and a copy of the image header
+ *   block[0..numBlock)   compressed blocks, stored as-is when incompressible
+ *   index[numBlock+1]    file offsets of blocks, last entry is the end of the last block
+ *
+ * Blocks are compressed in batches of `BLOCKZIP_BATCH` per thread, so memory usage stays bounded while streaming.
+ */
+
+/*
+ *	This file is part of Untangle, Information in fractal structures.
+ *	Copyright (C) 2017-2026, xyzzy@rockingship.org
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "context.h"
+
+/// @constant {number} BLOCKZIP_MAGIC - Container magic, distinct from any `FILE_MAGIC`
+#define BLOCKZIP_MAGIC     0x5a4c4244 // "DBLZ"
+/// @constant {number} BLOCKZIP_BLOCKSIZE - Uncompressed size of a block
+#define BLOCKZIP_BLOCKSIZE (1 << 20)
+/// @constant {number} BLOCKZIP_BATCH - Blocks per thread buffered before compressing
+#define BLOCKZIP_BATCH     4
+/// @constant {number} BLOCKZIP_HASHLOG - Size of match finder hash table
+#define BLOCKZIP_HASHLOG   14
+
+/**
+ * @date 2026-10-17 19:52:14
+ *
+ * Container header
+ *
+ * @typedef {object} blockZipHeader_t
+ */
+struct blockZipHeader_t {
+	uint32_t magic;                  // BLOCKZIP_MAGIC
+	uint32_t blockSize;              // uncompressed size of block
+	uint64_t rawSize;                // size of uncompressed image
+	uint64_t numBlock;               // number of blocks
+	uint64_t offIndex;               // file offset of block index
+	uint32_t headerSize;             // number of bytes of `rawHeader[]`
+	uint32_t unused;
+	uint8_t  rawHeader[1024];        // copy of the image header, which is only final after the sections are written
+};
+
+/**
+ * @date 2026-10-17 19:54:40
+ *
+ * Upper bound of compressed size
+ *
+ * @param {number} length - uncompressed length
+ * @return {number} worst case compressed length
+ */
+static inline size_t blockZipBound(size_t length) {
+	return length + length / 255 + 16;
+}
+
+/**
+ * @date 2026-10-17 19:55:32
+ *
+ * Compress a block. Output uses LZ4 block layout:
+ *   token (literal length:4, match length-4:4), [extra literal length], literals, offset:16, [extra match length]
+ * The last sequence has literals only.
+ *
+ * @param {number[]} pSrc - uncompressed data
+ * @param {number} srcLen - length of uncompressed data
+ * @param {number[]} pDst - output, at least `blockZipBound(srcLen)` bytes
+ * @return {number} compressed length
+ */
+static size_t blockZipCompress(const uint8_t *pSrc, size_t srcLen, uint8_t *pDst) {
+	uint32_t      hashTable[1 << BLOCKZIP_HASHLOG];
+	const uint8_t *pIn      = pSrc;
+	const uint8_t *pEnd     = pSrc + srcLen;
+	const uint8_t *pLimit   = srcLen > 12 ? pEnd - 12 : pSrc; // no matches in last bytes
+	const uint8_t *pAnchor  = pSrc;
+	uint8_t       *pOut     = pDst;
+
+	::memset(hashTable, 0xff, sizeof(hashTable));
+
+	while (pIn < pLimit) {
+		uint32_t seq;
+		::memcpy(&seq, pIn, sizeof(seq));
+
+		uint32_t h    = (seq * 2654435761U) >> (32 - BLOCKZIP_HASHLOG);
+		uint32_t cand = hashTable[h];
+		hashTable[h] = (uint32_t) (pIn - pSrc);
+
+		uint32_t candSeq;
+		if (cand == 0xffffffff || (size_t) (pIn - pSrc) - cand > 0xffff || (::memcpy(&candSeq, pSrc + cand, sizeof(candSeq)), candSeq != seq)) {
+			pIn++;
+			continue;
+		}
+
+		/*
+		 * Match found, extend
+		 */
+		const uint8_t *pMatch = pSrc + cand;
+		const uint8_t *pScan  = pIn + 4;
+		const uint8_t *pRef   = pMatch + 4;
+		while (pScan < pEnd - 5 && *pScan == *pRef) {
+			pScan++;
+			pRef++;
+		}
+
+		size_t numLiteral = pIn - pAnchor;
+		size_t matchLen   = pScan - pIn - 4;
+
+		// token
+		uint8_t *pToken = pOut++;
+		*pToken = (uint8_t) (((numLiteral >= 15 ? 15 : numLiteral) << 4) | (matchLen >= 15 ? 15 : matchLen));
+
+		// literals
+		if (numLiteral >= 15) {
+			size_t n = numLiteral - 15;
+			for (; n >= 255; n -= 255)
+				*pOut++ = 255;
+			*pOut++ = (uint8_t) n;
+		}
+		::memcpy(pOut, pAnchor, numLiteral);
+		pOut += numLiteral;
+
+		// offset
+		uint16_t offset = (uint16_t) (pIn - pMatch);
+		*pOut++ = (uint8_t) offset;
+		*pOut++ = (uint8_t) (offset >> 8);
+
+		// match length
+		if (matchLen >= 15) {
+			size_t n = matchLen - 15;
+			for (; n >= 255; n -= 255)
+				*pOut++ = 255;
+			*pOut++ = (uint8_t) n;
+		}
+
+		pIn     = pScan;
+		pAnchor = pIn;
+	}
+
+	/*
+	 * Final literals
+	 */
+	size_t numLiteral = pEnd - pAnchor;
+	*pOut++ = (uint8_t) ((numLiteral >= 15 ? 15 : numLiteral) << 4);
+	if (numLiteral >= 15) {
+		size_t n = numLiteral - 15;
+		for (; n >= 255; n -= 255)
+			*pOut++ = 255;
+		*pOut++ = (uint8_t) n;
+	}
+	::memcpy(pOut, pAnchor, numLiteral);
+	pOut += numLiteral;
+
+	return pOut - pDst;
+}
+
+/**
+ * @date 2026-10-17 19:58:06
+ *
+ * Decompress a block
+ *
+ * @param {number[]} pSrc - compressed data
+ * @param {number} srcLen - length of compressed data
+ * @param {number[]} pDst - output
+ * @param {number} dstLen - expected uncompressed length
+ * @return {boolean} `false` if data is corrupt
+ */
+static bool blockZipDecompress(const uint8_t *pSrc, size_t srcLen, uint8_t *pDst, size_t dstLen) {
+	const uint8_t *pIn     = pSrc;
+	const uint8_t *pInEnd  = pSrc + srcLen;
+	uint8_t       *pOut    = pDst;
+	uint8_t       *pOutEnd = pDst + dstLen;
+
+	for (;;) {
+		if (pIn >= pInEnd)
+			return false;
+
+		unsigned token = *pIn++;
+
+		// literals
+		size_t numLiteral = token >> 4;
+		if (numLiteral == 15) {
+			unsigned b;
+			do {
+				if (pIn >= pInEnd)
+					return false;
+				b = *pIn++;
+				numLiteral += b;
+			} while (b == 255);
+		}
+		if (numLiteral > (size_t) (pInEnd - pIn) || numLiteral > (size_t) (pOutEnd - pOut))
+			return false;
+		::memcpy(pOut, pIn, numLiteral);
+		pIn += numLiteral;
+		pOut += numLiteral;
+
+		// last sequence
+		if (pIn == pInEnd)
+			return pOut == pOutEnd;
+
+		// match
+		if (pInEnd - pIn < 2)
+			return false;
+		size_t offset = pIn[0] | (pIn[1] << 8);
+		pIn += 2;
+		if (offset == 0 || offset > (size_t) (pOut - pDst))
+			return false;
+
+		size_t matchLen = token & 15;
+		if (matchLen == 15) {
+			unsigned b;
+			do {
+				if (pIn >= pInEnd)
+					return false;
+				b = *pIn++;
+				matchLen += b;
+			} while (b == 255);
+		}
+		matchLen += 4;
+		if (matchLen > (size_t) (pOutEnd - pOut))
+			return false;
+
+		// byte copy, source and destination may overlap
+		const uint8_t *pRef = pOut - offset;
+		for (size_t i = 0; i < matchLen; i++)
+			pOut[i] = pRef[i];
+		pOut += matchLen;
+	}
+}
+
+/**
+ * @date 2026-10-17 20:00:21
+ *
+ * Run a block job over all blocks with a pool of threads
+ *
+ * @typedef {object} blockZipPool_t
+ */
+struct blockZipPool_t {
+	/// @var {number} number of jobs
+	unsigned numJobs;
+	/// @var {number} next job to claim
+	unsigned nextJob;
+	/// @var {number} number of failed jobs
+	unsigned numFailed;
+	/// @var {function} job handler, returns `false` on failure
+	bool     (*handler)(blockZipPool_t *pPool, unsigned iJob);
+	/// @var {object} handler context
+	void     *arg;
+
+	static void *worker(void *arg) {
+		blockZipPool_t *pPool = (blockZipPool_t *) arg;
+
+		for (;;) {
+			unsigned iJob = __sync_fetch_and_add(&pPool->nextJob, 1);
+			if (iJob >= pPool->numJobs)
+				break;
+
+			if (!(*pPool->handler)(pPool, iJob))
+				__sync_fetch_and_add(&pPool->numFailed, 1);
+		}
+
+		return NULL;
+	}
+
+	/**
+	 * @date 2026-10-17 20:00:21
+	 *
+	 * Execute all jobs
+	 *
+	 * @param {context_t} ctx - I/O context
+	 * @param {number} numThreads - number of threads, 0 for serial
+	 * @return {number} number of failed jobs
+	 */
+	unsigned run(context_t &ctx, unsigned numThreads) {
+		nextJob   = 0;
+		numFailed = 0;
+
+		if (numThreads > numJobs)
+			numThreads = numJobs;
+
+		if (numThreads <= 1) {
+			worker(this);
+			return numFailed;
+		}
+
+		pthread_t *pThreads = (pthread_t *) ctx.myAlloc("blockZipPool_t::threads", numThreads, sizeof(*pThreads));
+
+		for (unsigned iThread = 0; iThread < numThreads; iThread++) {
+			int ret = pthread_create(&pThreads[iThread], NULL, worker, this);
+			if (ret)
+				ctx.fatal("\n{\"error\":\"pthread_create() failed\",\"where\":\"%s:%s:%d\",\"return\":%d}\n",
+					  __FUNCTION__, __FILE__, __LINE__, ret);
+		}
+		for (unsigned iThread = 0; iThread < numThreads; iThread++)
+			pthread_join(pThreads[iThread], NULL);
+
+		ctx.myFree("blockZipPool_t::threads", pThreads);
+
+		return numFailed;
+	}
+};
+
+/**
+ * @date 2026-10-17 20:02:47
+ *
+ * Streaming writer, collecting blocks and compressing them in parallel batches
+ *
+ * @typedef {object} blockZipWriter_t
+ */
+struct blockZipWriter_t {
+	/// @var {context_t} I/O context
+	context_t        &ctx;
+	/// @var {FILE} output
+	FILE             *outf;
+	/// @var {string} file to delete on error
+	const char       *fileName;
+	/// @var {number} number of compression threads
+	unsigned         numThreads;
+	/// @var {number} blocks per batch
+	unsigned         maxBatch;
+
+	/// @var {number[]} raw batch, `maxBatch` blocks
+	uint8_t          *pRaw;
+	/// @var {number[]} compressed batch, `maxBatch` bounds
+	uint8_t          *pZip;
+	/// @var {number[]} compressed lengths
+	size_t           *pZipLen;
+	/// @var {number} bytes in raw batch
+	size_t           rawLen;
+
+	/// @var {number} container header
+	blockZipHeader_t header;
+	/// @var {number[]} block index
+	uint64_t         *pIndex;
+	/// @var {number} allocated index entries
+	uint64_t         maxIndex;
+	/// @var {number} current file position
+	uint64_t         fpos;
+
+	/**
+	 * @date 2026-10-17 20:02:47
+	 *
+	 * Constructor, writes placeholder header
+	 *
+	 * @param {context_t} ctx - I/O context
+	 * @param {FILE} outf - output
+	 * @param {string} fileName - file to delete on error
+	 * @param {number} numThreads - number of compression threads
+	 */
+	blockZipWriter_t(context_t &ctx, FILE *outf, const char *fileName, unsigned numThreads) : ctx(ctx), outf(outf), fileName(fileName) {
+		this->numThreads = numThreads ? numThreads : 1;
+		this->maxBatch   = this->numThreads * BLOCKZIP_BATCH;
+
+		pRaw    = (uint8_t *) ctx.myAlloc("blockZipWriter_t::pRaw", maxBatch, BLOCKZIP_BLOCKSIZE);
+		pZip    = (uint8_t *) ctx.myAlloc("blockZipWriter_t::pZip", maxBatch, blockZipBound(BLOCKZIP_BLOCKSIZE));
+		pZipLen = (size_t *) ctx.myAlloc("blockZipWriter_t::pZipLen", maxBatch, sizeof(*pZipLen));
+		rawLen  = 0;
+
+		::memset(&header, 0, sizeof(header));
+		maxIndex = 1024;
+		pIndex   = (uint64_t *) ctx.myAlloc("blockZipWriter_t::pIndex", maxIndex, sizeof(*pIndex));
+
+		fpos = 0;
+		writeFile(&header, sizeof(header));
+	}
+
+	~blockZipWriter_t() {
+		ctx.myFree("blockZipWriter_t::pRaw", pRaw);
+		ctx.myFree("blockZipWriter_t::pZip", pZip);
+		ctx.myFree("blockZipWriter_t::pZipLen", pZipLen);
+		ctx.myFree("blockZipWriter_t::pIndex", pIndex);
+	}
+
+	/**
+	 * @date 2026-10-17 20:04:10
+	 *
+	 * Write to output, delete output on error
+	 */
+	void writeFile(const void *data, size_t length) {
+		if (::fwrite(data, 1, length, outf) != length) {
+			int savErrno = errno;
+			::remove(fileName);
+			errno        = savErrno;
+			ctx.fatal("\n{\"error\":\"fwrite(%lu)\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n", length, __FUNCTION__, __FILE__, __LINE__);
+		}
+		fpos += length;
+	}
+
+	static bool compressJob(blockZipPool_t *pPool, unsigned iJob) {
+		blockZipWriter_t *pWriter = (blockZipWriter_t *) pPool->arg;
+		size_t           rawLen   = pWriter->rawLen - (size_t) iJob * BLOCKZIP_BLOCKSIZE;
+
+		if (rawLen > BLOCKZIP_BLOCKSIZE)
+			rawLen = BLOCKZIP_BLOCKSIZE;
+
+		pWriter->pZipLen[iJob] = blockZipCompress(pWriter->pRaw + (size_t) iJob * BLOCKZIP_BLOCKSIZE, rawLen, pWriter->pZip + (size_t) iJob * blockZipBound(BLOCKZIP_BLOCKSIZE));
+		return true;
+	}
+
+	/**
+	 * @date 2026-10-17 20:05:33
+	 *
+	 * Compress and write buffered blocks
+	 */
+	void flush(void) {
+		if (rawLen == 0)
+			return;
+
+		blockZipPool_t pool;
+		pool.numJobs = (unsigned) ((rawLen + BLOCKZIP_BLOCKSIZE - 1) / BLOCKZIP_BLOCKSIZE);
+		pool.handler = compressJob;
+		pool.arg     = this;
+		pool.run(ctx, numThreads);
+
+		for (unsigned iBlock = 0; iBlock < pool.numJobs; iBlock++) {
+			size_t blockLen = rawLen - (size_t) iBlock * BLOCKZIP_BLOCKSIZE;
+			if (blockLen > BLOCKZIP_BLOCKSIZE)
+				blockLen = BLOCKZIP_BLOCKSIZE;
+
+			if (header.numBlock + 2 > maxIndex) {
+				pIndex   = (uint64_t *) ctx.myRealloc("blockZipWriter_t::pIndex", pIndex, maxIndex, maxIndex * 2, sizeof(*pIndex));
+				maxIndex *= 2;
+			}
+			pIndex[header.numBlock++] = fpos;
+
+			// store incompressible blocks as-is
+			if (pZipLen[iBlock] >= blockLen)
+				writeFile(pRaw + (size_t) iBlock * BLOCKZIP_BLOCKSIZE, blockLen);
+			else
+				writeFile(pZip + (size_t) iBlock * blockZipBound(BLOCKZIP_BLOCKSIZE), pZipLen[iBlock]);
+		}
+
+		header.rawSize += rawLen;
+		rawLen = 0;
+	}
+
+	/**
+	 * @date 2026-10-17 20:06:48
+	 *
+	 * Append data to image
+	 *
+	 * @param {number[]} data - data
+	 * @param {number} length - length of data
+	 */
+	void write(const void *data, size_t length) {
+		const uint8_t *pData = (const uint8_t *) data;
+
+		while (length > 0) {
+			size_t n = (size_t) maxBatch * BLOCKZIP_BLOCKSIZE - rawLen;
+			if (n > length)
+				n = length;
+
+			::memcpy(pRaw + rawLen, pData, n);
+			rawLen += n;
+			pData += n;
+			length -= n;
+
+			if (rawLen == (size_t) maxBatch * BLOCKZIP_BLOCKSIZE)
+				flush();
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 20:08:02
+	 *
+	 * Flush, write block index and final header
+	 *
+	 * @param {number[]} pRawHeader - final image header
+	 * @param {number} rawHeaderSize - size of image header
+	 */
+	void finish(const void *pRawHeader, size_t rawHeaderSize) {
+		flush();
+
+		assert(rawHeaderSize <= sizeof(header.rawHeader));
+
+		pIndex[header.numBlock] = fpos;
+		header.offIndex = fpos;
+		writeFile(pIndex, (header.numBlock + 1) * sizeof(*pIndex));
+
+		header.magic      = BLOCKZIP_MAGIC;
+		header.blockSize  = BLOCKZIP_BLOCKSIZE;
+		header.headerSize = (uint32_t) rawHeaderSize;
+		::memcpy(header.rawHeader, pRawHeader, rawHeaderSize);
+
+		// header rewrite does not extend file
+		uint64_t fileSize = fpos;
+		fseek(outf, 0, SEEK_SET);
+		writeFile(&header, sizeof(header));
+		fpos = fileSize;
+	}
+};
+
+#endif
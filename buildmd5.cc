@@ -124,6 +124,8 @@ struct buildmd5Context_t {
 	unsigned opt_force;
 	/// @var {number} --maxnode, Maximum number of nodes for `baseTree_t`.
 	unsigned opt_maxNode;
+	/// @var {string} --trace, record `normaliseNode()` calls for `replaytrace`
+	const char *opt_trace;
 	/// @var {NODE} variables referencing zero/false and nonZero/true
 	NODE     vFalse, vTrue;
 
@@ -131,6 +133,7 @@ struct buildmd5Context_t {
 		opt_flags   = 0;
 		opt_force   = 0;
 		opt_maxNode = DEFAULT_MAXNODE;
+		opt_trace   = NULL;
 		vFalse.id = 0;
 		vTrue.id  = IBIT;
 	}
@@ -512,8 +515,14 @@ struct buildmd5Context_t {
 		}
 
 		// build. Uses gBuild
+		if (opt_trace)
+			gTree->startTrace(opt_trace);
+
 		build(V);
 
+		if (opt_trace)
+			gTree->stopTrace();
+
 		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
 			fprintf(stderr, "\r\e[K");
 
@@ -590,6 +599,7 @@ void usage(char *argv[], bool verbose) {
 		fprintf(stderr, "\t   --maxnode=<number> [default=%d]\n", app.opt_maxNode);
 		fprintf(stderr, "\t-q --quiet\n");
 		fprintf(stderr, "\t   --timer=<seconds> [default=%d]\n", ctx.opt_timer);
+		fprintf(stderr, "\t   --trace=<file>\n");
 		fprintf(stderr, "\t-v --verbose\n");
 		fprintf(stderr, "\t   --[no-]paranoid [default=%s]\n", app.opt_flags & ctx.MAGICMASK_PARANOID ? "enabled" : "disabled");
 		fprintf(stderr, "\t   --[no-]pure [default=%s]\n", app.opt_flags & ctx.MAGICMASK_PURE ? "enabled" : "disabled");
@@ -616,7 +626,7 @@ int main(int argc, char *argv[]) {
 
 	for (;;) {
 		enum {
-			LO_HELP  = 1, LO_DEBUG, LO_TIMER, LO_FORCE, LO_MAXNODE,
+			LO_HELP  = 1, LO_DEBUG, LO_TIMER, LO_FORCE, LO_MAXNODE, LO_TRACE,
 			LO_PARANOID, LO_NOPARANOID, LO_PURE, LO_NOPURE, LO_REWRITE, LO_NOREWRITE, LO_CASCADE, LO_NOCASCADE, LO_SHRINK, LO_NOSHRINK, LO_PIVOT3, LO_NOPIVOT3,
 			LO_QUIET = 'q', LO_VERBOSE = 'v'
 		};
@@ -629,6 +639,7 @@ int main(int argc, char *argv[]) {
 			{"maxnode",     1, 0, LO_MAXNODE},
 			{"quiet",       2, 0, LO_QUIET},
 			{"timer",       1, 0, LO_TIMER},
+			{"trace",       1, 0, LO_TRACE},
 			{"verbose",     2, 0, LO_VERBOSE},
 			//
 			{"paranoid",    0, 0, LO_PARANOID},
@@ -687,6 +698,9 @@ int main(int argc, char *argv[]) {
 		case LO_TIMER:
 			ctx.opt_timer = (unsigned) strtoul(optarg, NULL, 10);
 			break;
+		case LO_TRACE:
+			app.opt_trace = optarg;
+			break;
 		case LO_VERBOSE:
 			ctx.opt_verbose = optarg ? (unsigned) strtoul(optarg, NULL, 10) : ctx.opt_verbose + 1;
 			break;
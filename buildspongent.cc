@@ -102,11 +102,14 @@ struct buildspongentContext_t {
 	unsigned opt_force;
 	/// @var {number} --maxnode, Maximum number of nodes for `baseTree_t`.
 	unsigned opt_maxNode;
+	/// @var {string} --trace, record `normaliseNode()` calls for `replaytrace`
+	const char *opt_trace;
 
 	buildspongentContext_t() {
 		opt_flags   = 0;
 		opt_force   = 0;
 		opt_maxNode = DEFAULT_MAXNODE;
+		opt_trace   = NULL;
 	}
 
 	void __attribute__((optimize("O0"))) Permute(NODE value[11][8], NODE *V, uint32_t kstart, uint32_t ostart) {
@@ -362,8 +365,14 @@ struct buildspongentContext_t {
 		}
 
 		// build. Uses gBuild
+		if (opt_trace)
+			gTree->startTrace(opt_trace);
+
 		build(V);
 
+		if (opt_trace)
+			gTree->stopTrace();
+
 		/*
 		 * Assign the roots/entrypoints.
 		 */
@@ -437,6 +446,7 @@ void usage(char *argv[], bool verbose) {
 		fprintf(stderr, "\t   --maxnode=<number> [default=%d]\n", app.opt_maxNode);
 		fprintf(stderr, "\t-q --quiet\n");
 		fprintf(stderr, "\t   --timer=<seconds> [default=%d]\n", ctx.opt_timer);
+		fprintf(stderr, "\t   --trace=<file>\n");
 		fprintf(stderr, "\t-v --verbose\n");
 		fprintf(stderr, "\t   --[no-]paranoid [default=%s]\n", app.opt_flags & ctx.MAGICMASK_PARANOID ? "enabled" : "disabled");
 		fprintf(stderr, "\t   --[no-]pure [default=%s]\n", app.opt_flags & ctx.MAGICMASK_PURE ? "enabled" : "disabled");
@@ -463,7 +473,7 @@ int main(int argc, char *argv[]) {
 
 	for (;;) {
 		enum {
-			LO_HELP  = 1, LO_DEBUG, LO_TIMER, LO_FORCE, LO_MAXNODE,
+			LO_HELP  = 1, LO_DEBUG, LO_TIMER, LO_FORCE, LO_MAXNODE, LO_TRACE,
 			LO_PARANOID, LO_NOPARANOID, LO_PURE, LO_NOPURE, LO_REWRITE, LO_NOREWRITE, LO_CASCADE, LO_NOCASCADE, LO_SHRINK, LO_NOSHRINK, LO_PIVOT3, LO_NOPIVOT3,
 			LO_QUIET = 'q', LO_VERBOSE = 'v'
 		};
@@ -476,6 +486,7 @@ int main(int argc, char *argv[]) {
 			{"maxnode",     1, 0, LO_MAXNODE},
 			{"quiet",       2, 0, LO_QUIET},
 			{"timer",       1, 0, LO_TIMER},
+			{"trace",       1, 0, LO_TRACE},
 			{"verbose",     2, 0, LO_VERBOSE},
 			//
 			{"paranoid",    0, 0, LO_PARANOID},
@@ -534,6 +545,9 @@ int main(int argc, char *argv[]) {
 		case LO_TIMER:
 			ctx.opt_timer = (unsigned) strtoul(optarg, NULL, 10);
 			break;
+		case LO_TRACE:
+			app.opt_trace = optarg;
+			break;
 		case LO_VERBOSE:
 			ctx.opt_verbose = optarg ? (unsigned) strtoul(optarg, NULL, 10) : ctx.opt_verbose + 1;
 			break;
@@ -26,6 +26,7 @@
  */
 
 #include <assert.h>
+#include <fcntl.h>
 #include <signal.h>
 #include <stdarg.h>
 #include <stdint.h>
@@ -56,6 +57,157 @@
  */
 #define MAXTRANSFORM (1*2*3*4*5*6*7*8*9)
 
+/*
+ * @date 2026-10-17 17:20:14
+ *
+ * Hot-path performance counters.
+ * When disabled (default) `PERFCOUNT()` and `PERFTIMER()` expand to nothing.
+ * Enable with `./configure --enable-perfcount` or `-DENABLE_PERFCOUNT=1`.
+ */
+#ifndef ENABLE_PERFCOUNT
+#define ENABLE_PERFCOUNT 0
+#endif
+
+/**
+ * Timers measure one in `2^PERFCOUNT_SAMPLEBITS` calls
+ *
+ * @constant {number} PERFCOUNT_SAMPLEBITS
+ */
+#ifndef PERFCOUNT_SAMPLEBITS
+#define PERFCOUNT_SAMPLEBITS 10
+#endif
+
+/**
+ * Number of per-thread counter slots. Threads beyond count into a private slot that is not reported.
+ *
+ * @constant {number} PERFCOUNT_MAXTHREADS
+ */
+#ifndef PERFCOUNT_MAXTHREADS
+#define PERFCOUNT_MAXTHREADS 256
+#endif
+
+/*
+ * @date 2026-10-17 17:20:14
+ *
+ * Counter id's. Keep in sync with `perfNames[]`
+ */
+enum {
+	// @formatter:off
+	PERF_LOOKUPNODE = 0,            // `baseTree_t::lookupNode()`
+	PERF_NORMALISE,                 // `baseTree_t::normaliseNode()`, timer is inclusive of recursion
+	PERF_NORMALISE_L2,              // passed level 1, entering level-2 or rewrite
+	PERF_NORMALISE_L3,              // passed level 2, entering level-3 cascade
+	PERF_NORMALISE_BASIC,           // passed level 3, entering `basicNode()`
+	PERF_REWRITENODE,               // `baseTree_t::rewriteNode()`
+	PERF_COMPARE,                   // `baseTree_t::compare()`
+	PERF_LOOKUPIMPRINT,             // `database_t::lookupImprintAssociative()`
+	PERF_TINYEVAL,                  // `tinyTree_t::eval()`
+	PERF_LAST
+	// @formatter:on
+};
+
+#if ENABLE_PERFCOUNT
+
+struct normProfileSlot_t;
+
+/*
+ * @date 2026-10-17 17:20:14
+ *
+ * Counters of a single thread. Aligned so threads never share a cache line.
+ */
+struct perfSlot_t {
+	/// @var {number[]} number of calls
+	uint64_t calls[PERF_LAST];
+	/// @var {number[]} number of timed calls
+	uint64_t samples[PERF_LAST];
+	/// @var {number[]} nanoseconds spent in timed calls
+	uint64_t nsec[PERF_LAST];
+	/// @var {normProfileSlot_t} normalisation profile, allocated by `normprofile.h` on first use
+	normProfileSlot_t *pNormProfile;
+} __attribute__((aligned(64)));
+
+/*
+ * @date 2026-10-17 17:20:14
+ *
+ * Process wide registry, one instance shared by all translation units
+ */
+struct perfRegistry_t {
+	/// @var {number} number of claimed slots, including threads beyond `PERFCOUNT_MAXTHREADS`
+	unsigned   numSlot;
+	/// @var {perfSlot_t[]} per-thread counters
+	perfSlot_t slots[PERFCOUNT_MAXTHREADS];
+	/// @var {function} async-signal-safe appender of extra report sections to `perfDump()`
+	unsigned   (*appendHook)(char *buffer, unsigned len, unsigned size);
+
+	static perfRegistry_t &get(void) {
+		static perfRegistry_t registry;
+		return registry;
+	}
+
+	/*
+	 * Counters of the calling thread, claimed on first use.
+	 * Threads beyond `PERFCOUNT_MAXTHREADS` get a private slot, sharing would mix per-thread state.
+	 */
+	static inline perfSlot_t *slot(void) {
+		static __thread perfSlot_t *pSlot;
+		static __thread perfSlot_t overflowSlot;
+
+		if (__builtin_expect(pSlot == NULL, 0)) {
+			perfRegistry_t &r = get();
+			unsigned ix = __sync_fetch_and_add(&r.numSlot, 1);
+			pSlot = (ix < PERFCOUNT_MAXTHREADS) ? r.slots + ix : &overflowSlot;
+		}
+		return pSlot;
+	}
+
+	/*
+	 * Test if slot is reported by `perfDump()`
+	 */
+	static inline bool isRegistered(const perfSlot_t *pSlot) {
+		perfRegistry_t &r = get();
+		return pSlot >= r.slots && pSlot < r.slots + PERFCOUNT_MAXTHREADS;
+	}
+
+	static inline uint64_t now(void) {
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+	}
+};
+
+/*
+ * @date 2026-10-17 17:20:14
+ *
+ * Count call and, when sampled, time the enclosing scope
+ */
+struct perfTimer_t {
+	perfSlot_t *pSlot;
+	unsigned   id;
+	uint64_t   start;
+
+	inline perfTimer_t(unsigned id) : pSlot(perfRegistry_t::slot()), id(id), start(0) {
+		if (__builtin_expect((pSlot->calls[id]++ & ((1 << PERFCOUNT_SAMPLEBITS) - 1)) == 0, 0))
+			start = perfRegistry_t::now();
+	}
+
+	inline ~perfTimer_t() {
+		if (__builtin_expect(start != 0, 0)) {
+			pSlot->nsec[id] += perfRegistry_t::now() - start;
+			pSlot->samples[id]++;
+		}
+	}
+};
+
+#define PERFCOUNT(ID) do { perfRegistry_t::slot()->calls[ID]++; } while (0)
+#define PERFTIMER(ID) perfTimer_t perfTimer(ID)
+
+#else
+
+#define PERFCOUNT(ID) do { } while (0)
+#define PERFTIMER(ID) do { } while (0)
+
+#endif
+
 /**
  * @date 2020-03-12 13:19:24
  *
@@ -193,8 +345,136 @@ struct context_t {
 		progressCoefMultiplier = 0.9072878562; //  #seconds as #th root of (end/start). set for 20 second training
 		progressLast = 0;
 		progressSpeed = 0;
+
+#if ENABLE_PERFCOUNT
+		static bool perfInstalled;
+		if (!perfInstalled) {
+			perfInstalled = true;
+			::atexit(perfAtExit);
+			::signal(SIGUSR1, perfSignal);
+		}
+#endif
+	}
+
+#if ENABLE_PERFCOUNT
+	/*
+	 * @date 2026-10-17 17:27:45
+	 *
+	 * Write counters of all threads as single line of JSON.
+	 * Only formats with `perfAppend*()` and writes with `write()` so it can be called from a signal handler.
+	 * Counters of running threads are read without locking, values are indicative.
+	 *
+	 * Output goes to the file named by `UNTANGLE_PERFCOUNT` (appended) or stderr.
+	 *
+	 * `"estNsec"` extrapolates the sampled timers to all calls.
+	 * Sections of `perfRegistry_t::appendHook` (the normalisation profile) are appended to the same object.
+	 */
+	static void perfDump(const char *reason) {
+		static const char *perfNames[PERF_LAST] = {
+			"lookupNode", "normaliseNode", "normaliseLevel2", "normaliseLevel3", "normaliseBasic",
+			"rewriteNode", "compare", "lookupImprintAssociative", "tinyEval"
+		};
+		static char buffer[16384];
+
+		perfRegistry_t &r = perfRegistry_t::get();
+		unsigned numSlot = r.numSlot < PERFCOUNT_MAXTHREADS ? r.numSlot : PERFCOUNT_MAXTHREADS;
+		unsigned len     = 0;
+
+		len = perfAppendString(buffer, len, sizeof(buffer), "{\"perfcount\":\"");
+		len = perfAppendString(buffer, len, sizeof(buffer), reason);
+		len = perfAppendString(buffer, len, sizeof(buffer), "\",\"pid\":");
+		len = perfAppendNumber(buffer, len, sizeof(buffer), (uint64_t) ::getpid());
+		len = perfAppendString(buffer, len, sizeof(buffer), ",\"threads\":");
+		len = perfAppendNumber(buffer, len, sizeof(buffer), r.numSlot);
+		len = perfAppendString(buffer, len, sizeof(buffer), ",\"sampleBits\":");
+		len = perfAppendNumber(buffer, len, sizeof(buffer), PERFCOUNT_SAMPLEBITS);
+
+		for (unsigned id = 0; id < PERF_LAST; id++) {
+			uint64_t calls = 0, samples = 0, nsec = 0;
+
+			for (unsigned iSlot = 0; iSlot < numSlot; iSlot++) {
+				calls += r.slots[iSlot].calls[id];
+				samples += r.slots[iSlot].samples[id];
+				nsec += r.slots[iSlot].nsec[id];
+			}
+
+			uint64_t estNsec = samples ? nsec / samples * calls : 0;
+
+			len = perfAppendString(buffer, len, sizeof(buffer), ",\"");
+			len = perfAppendString(buffer, len, sizeof(buffer), perfNames[id]);
+			len = perfAppendString(buffer, len, sizeof(buffer), "\":{\"calls\":");
+			len = perfAppendNumber(buffer, len, sizeof(buffer), calls);
+			len = perfAppendString(buffer, len, sizeof(buffer), ",\"samples\":");
+			len = perfAppendNumber(buffer, len, sizeof(buffer), samples);
+			len = perfAppendString(buffer, len, sizeof(buffer), ",\"nsec\":");
+			len = perfAppendNumber(buffer, len, sizeof(buffer), nsec);
+			len = perfAppendString(buffer, len, sizeof(buffer), ",\"estNsec\":");
+			len = perfAppendNumber(buffer, len, sizeof(buffer), estNsec);
+			len = perfAppendString(buffer, len, sizeof(buffer), "}");
+		}
+
+		if (r.appendHook)
+			len = r.appendHook(buffer, len, sizeof(buffer));
+
+		len = perfAppendString(buffer, len, sizeof(buffer), "}\n");
+
+		int        fd    = 2;
+		const char *name = ::getenv("UNTANGLE_PERFCOUNT");
+		if (name != NULL) {
+			fd = ::open(name, O_WRONLY | O_CREAT | O_APPEND, 0664);
+			if (fd < 0)
+				fd = 2;
+		}
+
+		if (::write(fd, buffer, len) != (ssize_t) len) {
+			// nothing sensible to do
+		}
+
+		if (fd != 2)
+			::close(fd);
 	}
 
+	/*
+	 * @date 2026-10-17 17:27:45
+	 *
+	 * Async-signal-safe append of string, truncates at `size`
+	 */
+	static unsigned perfAppendString(char *buffer, unsigned len, unsigned size, const char *str) {
+		while (*str && len < size - 1)
+			buffer[len++] = *str++;
+		buffer[len] = 0;
+		return len;
+	}
+
+	/*
+	 * @date 2026-10-17 17:27:45
+	 *
+	 * Async-signal-safe append of unsigned decimal, truncates at `size`
+	 */
+	static unsigned perfAppendNumber(char *buffer, unsigned len, unsigned size, uint64_t value) {
+		char     digits[24];
+		unsigned numDigit = 0;
+
+		do {
+			digits[numDigit++] = (char) ('0' + value % 10);
+			value /= 10;
+		} while (value);
+
+		while (numDigit && len < size - 1)
+			buffer[len++] = digits[--numDigit];
+		buffer[len] = 0;
+		return len;
+	}
+
+	static void perfAtExit(void) {
+		perfDump("exit");
+	}
+
+	static void perfSignal(int sig) {
+		perfDump("signal");
+	}
+#endif
+
 	/*
 	 * @date 2021-05-14 22:15:31
 	 *
@@ -334,6 +614,30 @@ struct context_t {
 		::free(ptr);
 	}
 
+	/**
+	 * @date 2026-10-17 19:10:42
+	 *
+	 * Resize memory allocated by `myAlloc()`, preserving contents and clearing the extension.
+	 *
+	 * @param {string} name - Name associated to memory area. Should match that of `myAlloc()`
+	 * @param {void[]} ptr - Pointer to memory area to be resized
+	 * @param {number} oldNmemb - Current number of elements
+	 * @param {number} newNmemb - New number of elements
+	 * @param {number} size - Size of element
+	 * @return {void[]} Pointer to resized memory area
+	 */
+	void *myRealloc(const char *name, void *ptr, size_t oldNmemb, size_t newNmemb, size_t size) {
+		// `aligned_alloc()` has no `realloc()` counterpart that preserves alignment
+		void *ret = myAlloc(name, newNmemb, size);
+
+		if (ptr) {
+			::memcpy(ret, ptr, (oldNmemb < newNmemb ? oldNmemb : newNmemb) * size);
+			myFree(name, ptr);
+		}
+
+		return ret;
+	}
+
         /*
          * Prime numbers
          */
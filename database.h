@@ -68,6 +68,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <jansson.h>
+#include <pthread.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -75,11 +76,31 @@
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include "config.h"
+#include "blockzip.h"
 #include "datadef.h"
 #include "tinytree.h"
 
 /// @constant {number} FILE_MAGIC - Database version. Update this when either the file header or one of the structures change
-#define FILE_MAGIC        0x20210715
+#define FILE_MAGIC        0x20261018
+
+/// @constant {number} DATABASE_MAXSECTION - Number of section checksums in file header
+#define DATABASE_MAXSECTION 16
+/// @constant {number} DATABASE_MAXRANGE - Maximum number of memory ranges per section
+#define DATABASE_MAXRANGE   8
+/// @constant {number} DATABASE_CRCCHUNK - Unit of parallel checksumming
+#define DATABASE_CRCCHUNK   (1 << 20)
+/// @constant {number} DATABASE_PAGESIZE - Granularity of `madvise()` and prefetching
+#define DATABASE_PAGESIZE   4096
+/// @constant {number} DATABASE_MAXPREFETCH - Maximum number of concurrent prefetch threads
+#define DATABASE_MAXPREFETCH 4
+
+/// @constant {number} DATABASE_GROWPERCENT - Percentage a full data section grows when permitted by `growSections`
+#define DATABASE_GROWPERCENT 50
+/// @constant {number} DATABASE_GROWLOAD - Index fill percentage that doubles the index when permitted by `growSections`
+#define DATABASE_GROWLOAD    75
+
+/// @constant {number} DATABASE_FILTERRATIO - Imprint index entries per 64-bit word of the imprint filter
+#define DATABASE_FILTERRATIO 32
 
 /*
  *  All components contributing and using the database should share the same dimensions
@@ -123,6 +144,7 @@ struct fileHeader_t {
 	uint32_t hintIndexSize;
 	uint32_t numImprint;
 	uint32_t imprintIndexSize;
+	uint32_t imprintFilterSize;
 	uint32_t numPair;
 	uint32_t pairIndexSize;
 	uint32_t numMember;
@@ -152,6 +174,7 @@ struct fileHeader_t {
 	uint64_t offHintIndex;
 	uint64_t offImprints;
 	uint64_t offImprintIndex;
+	uint64_t offImprintFilter;
 	uint64_t offpairs;
 	uint64_t offPairIndex;
 	uint64_t offMember;
@@ -164,6 +187,11 @@ struct fileHeader_t {
 	uint64_t offGrowIndex;
 
 	uint64_t offEnd;
+
+	// section checksums
+	uint32_t crcSections;                          // sections with checksum
+	uint32_t crcChunkSize;                         // `DATABASE_CRCCHUNK`
+	uint32_t crcSection[DATABASE_MAXSECTION];      // indexed by `database_t::ALLOCFLAG_*`
 };
 
 
@@ -213,6 +241,17 @@ struct database_t {
 		// @formatter:on
 	};
 
+	/**
+	 * @date 2026-10-17 19:40:12
+	 *
+	 * Section access profiles for `adviseSections()`
+	 */
+	enum {
+		ACCESS_RANDOM = 0,
+		ACCESS_SEQUENTIAL,
+		ACCESS_WILLNEED,
+	};
+
 	// I/O context
 	context_t &ctx;
 
@@ -222,6 +261,7 @@ struct database_t {
 	fileHeader_t       fileHeader;                  // file header
 	uint32_t           creationFlags;               // creation constraints
 	uint32_t           allocFlags;                  // memory constraints
+	uint32_t           growSections;                // allocated sections that may grow on demand
 	// transforms
 	uint32_t           numTransform;                // number of elements in collection
 	uint32_t           maxTransform;                // maximum size of collection
@@ -264,6 +304,14 @@ struct database_t {
 	imprint_t          *imprints;                   // imprint collection
 	uint32_t           imprintIndexSize;            // index size (must be prime)
 	uint32_t           *imprintIndex;               // index
+	uint32_t           imprintFilterSize;           // filter size in words
+	uint64_t           *imprintFilter;              // blocked bloom filter in front of `imprintIndex`
+	uint32_t           imprintInvariantLog;         // log2 of invariant filter size in bits, zero if disabled
+	uint32_t           imprintInvariantInterleave;  // `interleave` of row map
+	uint32_t           imprintInvariantStep;        // `interleaveStep` of row map
+	uint64_t           *imprintInvariant;           // filter of cofactor weight vectors of `imprints` [IN-MEMORY]
+	uint8_t            *imprintInvariantMap;        // variable permutation of every associative row [IN-MEMORY]
+	uint64_t           imprintInvariantSeed[MAXSLOTS + 1]; // weight multipliers
 	// pair store
 	uint32_t           numPair;                     // number of sid/tid pairs
 	uint32_t           maxPair;                     // maximum size of collection
@@ -280,6 +328,18 @@ struct database_t {
 	uint32_t           iVersion;                    // version current incarnation
 	uint32_t           *imprintVersion;             // versioned memory for `imprintIndex`
 	uint32_t           *signatureVersion;           // versioned memory for `signatureIndex`
+	// background prefetch
+	unsigned           numPrefetch;                 // number of active prefetch threads
+	void               *prefetchThreads[DATABASE_MAXPREFETCH]; // `prefetch_t` of active threads
+	// block-compressed container
+	unsigned           saveCompressed;              // `save()` writes a block-compressed container
+	blockZipWriter_t   *pZipWriter;                 // active writer during `save()`
+	const uint8_t      *zipData;                    // compressed container, while sections are not loaded
+	size_t             zipSize;                     // size of container
+	uint8_t            *zipImage;                   // writable alias of `rawDatabase`
+	uint8_t            *zipLoaded;                  // blocks that are decompressed
+	uint64_t           *zipJobs;                    // block numbers for `loadBlocks()`
+	mutable pthread_mutex_t zipMutex;               // serialise `loadBlocks()`
 	// @formatter:on
 
 	/**
@@ -293,6 +353,16 @@ struct database_t {
 		rawDatabase = NULL;
 		::memset(&fileHeader, 0, sizeof(fileHeader));
 		allocFlags = 0;
+		growSections = 0;
+		numPrefetch = 0;
+		saveCompressed = 0;
+		pZipWriter = NULL;
+		zipData = NULL;
+		zipSize = 0;
+		zipImage = NULL;
+		zipLoaded = NULL;
+		zipJobs = NULL;
+		pthread_mutex_init(&zipMutex, NULL);
 
 		// transform store
 		numTransform          = 0;
@@ -338,6 +408,20 @@ struct database_t {
 		imprints         = NULL;
 		imprintIndexSize = 0;
 		imprintIndex     = NULL;
+		imprintFilterSize = 0;
+		imprintFilter     = NULL;
+		imprintInvariantLog        = 0;
+		imprintInvariantInterleave = 0;
+		imprintInvariantStep       = 0;
+		imprintInvariant           = NULL;
+		imprintInvariantMap        = NULL;
+		for (unsigned k = 0; k <= MAXSLOTS; k++) {
+			// splitmix64 finaliser, odd and well spread
+			uint64_t z = (k + 1) * 0x9e3779b97f4a7c15ULL;
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+			imprintInvariantSeed[k] = (z ^ (z >> 31)) | 1;
+		}
 
 		// sid/tid store
 		numPair = 0;
@@ -395,8 +479,15 @@ struct database_t {
 			ctx.myFree("database_t::hintIndex", hintIndex);
 		if (allocFlags & ALLOCMASK_IMPRINT)
 			ctx.myFree("database_t::imprints", imprints);
-		if (allocFlags & ALLOCMASK_IMPRINTINDEX)
+		if (allocFlags & ALLOCMASK_IMPRINTINDEX) {
 			ctx.myFree("database_t::imprintIndex", imprintIndex);
+			if (imprintFilter)
+				ctx.myFree("database_t::imprintFilter", imprintFilter);
+		}
+		if (imprintInvariant) {
+			ctx.myFree("database_t::imprintInvariant", imprintInvariant);
+			ctx.myFree("database_t::imprintInvariantMap", imprintInvariantMap);
+		}
 		if (allocFlags & ALLOCMASK_PAIR)
 			ctx.myFree("database_t::pairs", pairs);
 		if (allocFlags & ALLOCMASK_PAIRINDEX)
@@ -409,6 +500,15 @@ struct database_t {
 		// release versioned memory
 		disableVersioned();
 
+		// prefetching must finish before unmapping
+		stopPrefetch(true);
+
+		// compressed container
+		releaseZip();
+		if (zipJobs)
+			ctx.myFree("database_t::zipJobs", zipJobs);
+		pthread_mutex_destroy(&zipMutex);
+
 		/*
 		 * Release resources
 		 */
@@ -481,6 +581,126 @@ struct database_t {
 		iVersion++;
 	}
 
+	/**
+	 * @date 2026-10-17 19:14:05
+	 *
+	 * Extend a full data section by `DATABASE_GROWPERCENT`.
+	 * Element id's stay valid, pointers into the section do not.
+	 *
+	 * @param {string} pName - section name, should match that of `create()`
+	 * @param {void[]} pData - section
+	 * @param {number} maxData - (input/output) section capacity
+	 * @param {number} size - size of element
+	 * @return {void[]} relocated section
+	 */
+	void *growData(const char *pName, void *pData, uint32_t &maxData, size_t size) {
+		uint32_t newMax = ctx.raisePercent(maxData, DATABASE_GROWPERCENT);
+		if (newMax <= maxData)
+			ctx.fatal("\n{\"error\":\"storage full\",\"where\":\"%s:%s:%d\",\"name\":\"%s\",\"max\":%u}\n", __FUNCTION__, __FILE__, __LINE__, pName, maxData);
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_VERBOSE)
+			fprintf(stderr, "[%s] Growing %s from %u to %u\n", ctx.timeAsString(), pName, maxData, newMax);
+
+		pData   = ctx.myRealloc(pName, pData, maxData, newMax, size);
+		maxData = newMax;
+		return pData;
+	}
+
+	/**
+	 * @date 2026-10-17 19:14:05
+	 *
+	 * Test if an index should grow before its load exceeds `DATABASE_GROWLOAD` percent.
+	 * Versioned indices never grow.
+	 *
+	 * @param {number} section - `ALLOCMASK_*INDEX`
+	 * @param {number} numData - number of entries (to be) indexed
+	 * @param {number} indexSize - current index size
+	 * @return {boolean} `true` if `growIndex()` should be called
+	 */
+	inline bool mustGrowIndex(unsigned section, uint64_t numData, uint32_t indexSize) const {
+		return (growSections & allocFlags & section) && imprintVersion == NULL && signatureVersion == NULL &&
+		       numData * 100 >= (uint64_t) indexSize * DATABASE_GROWLOAD;
+	}
+
+	/**
+	 * @date 2026-10-17 19:14:05
+	 *
+	 * Double the size of an index and rehash its data section.
+	 *
+	 * NOTE: Index positions returned by `lookup*()` are invalidated.
+	 *       Only call when none are pending, which is why growing is tested on entry of a lookup.
+	 *
+	 * @param {number} section - `ALLOCMASK_*INDEX`
+	 */
+	void growIndex(unsigned section) {
+		switch (section) {
+		case ALLOCMASK_SIGNATUREINDEX:
+			ctx.myFree("database_t::signatureIndex", signatureIndex);
+			signatureIndexSize = ctx.nextPrime((uint64_t) signatureIndexSize * 2);
+			signatureIndex     = (uint32_t *) ctx.myAlloc("database_t::signatureIndex", signatureIndexSize, sizeof(*signatureIndex));
+
+			for (unsigned iSid = 1; iSid < numSignature; iSid++)
+				signatureIndex[lookupSignature(signatures[iSid].name)] = iSid;
+			break;
+		case ALLOCMASK_SWAPINDEX:
+			ctx.myFree("database_t::swapIndex", swapIndex);
+			swapIndexSize = ctx.nextPrime((uint64_t) swapIndexSize * 2);
+			swapIndex     = (uint32_t *) ctx.myAlloc("database_t::swapIndex", swapIndexSize, sizeof(*swapIndex));
+
+			for (unsigned iSwap = 1; iSwap < numSwap; iSwap++)
+				swapIndex[lookupSwap(swaps + iSwap)] = iSwap;
+			break;
+		case ALLOCMASK_HINTINDEX:
+			ctx.myFree("database_t::hintIndex", hintIndex);
+			hintIndexSize = ctx.nextPrime((uint64_t) hintIndexSize * 2);
+			hintIndex     = (uint32_t *) ctx.myAlloc("database_t::hintIndex", hintIndexSize, sizeof(*hintIndex));
+
+			for (unsigned iHint = 1; iHint < numHint; iHint++)
+				hintIndex[lookupHint(hints + iHint)] = iHint;
+			break;
+		case ALLOCMASK_IMPRINTINDEX:
+			ctx.myFree("database_t::imprintIndex", imprintIndex);
+			imprintIndexSize = ctx.nextPrime((uint64_t) imprintIndexSize * 2);
+			imprintIndex     = (uint32_t *) ctx.myAlloc("database_t::imprintIndex", imprintIndexSize, sizeof(*imprintIndex));
+
+			for (unsigned iImprint = 1; iImprint < numImprint; iImprint++)
+				imprintIndex[lookupImprint(imprints[iImprint].footprint)] = iImprint;
+
+			// filter is sized to index
+			if (imprintFilter) {
+				ctx.myFree("database_t::imprintFilter", imprintFilter);
+				imprintFilterSize = imprintFilterSizeFor(imprintIndexSize);
+				imprintFilter     = (uint64_t *) ctx.myAlloc("database_t::imprintFilter", imprintFilterSize, sizeof(*imprintFilter));
+				rebuildImprintFilter();
+			}
+			break;
+		case ALLOCMASK_PAIRINDEX:
+			ctx.myFree("database_t::pairIndex", pairIndex);
+			pairIndexSize = ctx.nextPrime((uint64_t) pairIndexSize * 2);
+			pairIndex     = (uint32_t *) ctx.myAlloc("database_t::pairIndex", pairIndexSize, sizeof(*pairIndex));
+
+			for (unsigned iPair = 1; iPair < numPair; iPair++)
+				pairIndex[lookupPair(pairs[iPair].sidmid, pairs[iPair].tid)] = iPair;
+			break;
+		case ALLOCMASK_MEMBERINDEX:
+			ctx.myFree("database_t::memberIndex", memberIndex);
+			memberIndexSize = ctx.nextPrime((uint64_t) memberIndexSize * 2);
+			memberIndex     = (uint32_t *) ctx.myAlloc("database_t::memberIndex", memberIndexSize, sizeof(*memberIndex));
+
+			// skip released members, they are zeroed
+			for (unsigned iMid = 1; iMid < numMember; iMid++) {
+				if (members[iMid].sid != 0)
+					memberIndex[lookupMember(members[iMid].name)] = iMid;
+			}
+			break;
+		default:
+			assert(0);
+		}
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_VERBOSE)
+			fprintf(stderr, "[%s] Grown index %s\n", ctx.timeAsString(), sectionToText(section));
+	}
+
 	/**
 	 * @date 2020-03-15 22:25:41
 	 *
@@ -609,8 +829,10 @@ struct database_t {
 
 			if (inheritSections & ALLOCMASK_IMPRINTINDEX) {
 				assert(!(allocFlags & ALLOCMASK_IMPRINTINDEX));
-				this->imprintIndexSize = pFrom->imprintIndexSize;
-				this->imprintIndex     = pFrom->imprintIndex;
+				this->imprintIndexSize  = pFrom->imprintIndexSize;
+				this->imprintIndex      = pFrom->imprintIndex;
+				this->imprintFilterSize = pFrom->imprintFilterSize;
+				this->imprintFilter     = pFrom->imprintFilter;
 			}
 		}
 
@@ -705,8 +927,10 @@ struct database_t {
 		// imprint store
 		if (maxImprint && !(excludeSections & ALLOCMASK_IMPRINT))
 			memUsage += maxImprint * sizeof(*imprints); // increase with 5%
-		if (imprintIndexSize && !(excludeSections & ALLOCMASK_IMPRINTINDEX))
+		if (imprintIndexSize && !(excludeSections & ALLOCMASK_IMPRINTINDEX)) {
 			memUsage += imprintIndexSize * sizeof(*imprintIndex);
+			memUsage += imprintFilterSizeFor(imprintIndexSize) * sizeof(*imprintFilter);
+		}
 
 		// sid/tid store
 		if (maxPair && !(excludeSections & ALLOCMASK_PAIR))
@@ -807,6 +1031,8 @@ struct database_t {
 		if (imprintIndexSize && !(excludeSections & ALLOCMASK_IMPRINTINDEX)) {
 			assert(ctx.isPrime(imprintIndexSize));
 			imprintIndex = (uint32_t *) ctx.myAlloc("database_t::imprintIndex", imprintIndexSize, sizeof(*imprintIndex));
+			imprintFilterSize = imprintFilterSizeFor(imprintIndexSize);
+			imprintFilter     = (uint64_t *) ctx.myAlloc("database_t::imprintFilter", imprintFilterSize, sizeof(*imprintFilter));
 			allocFlags |= ALLOCMASK_IMPRINTINDEX;
 		}
 
@@ -849,10 +1075,15 @@ struct database_t {
 	 *
 	 * To reduce need to copy large chunks of data from input to output, make pages writable and enable copy-on-write
 	 *
+	 * @date 2026-10-17 20:20:03
+	 *
+	 * Block-compressed containers are inflated into memory.
+	 * Sections in `lazySections` are decompressed on demand by `loadSections()`.
+	 *
          * @param {string} fileName - database filename
-         * @param {boolean} writable - Set access to R/W
+         * @param {number} lazySections - `ALLOCMASK_*` of sections not to decompress yet
 	 */
-	void open(const char *fileName) {
+	void open(const char *fileName, unsigned lazySections = 0) {
 
 		/*
 		 * Open file
@@ -902,13 +1133,19 @@ struct database_t {
 		hndl = 0;
 #endif
 
+		uint64_t imageSize = (uint64_t) sbuf.st_size;
+		if (imageSize >= sizeof(blockZipHeader_t) && *(const uint32_t *) rawDatabase == BLOCKZIP_MAGIC)
+			imageSize = inflateDatabase(fileName, (size_t) sbuf.st_size);
+
 		::memcpy(&fileHeader, rawDatabase, sizeof(fileHeader));
 		if (fileHeader.magic != FILE_MAGIC)
 			ctx.fatal("\n{\"error\":\"db version mismatch\",\"where\":\"%s:%s:%d\",\"encountered\":\"%08x\",\"expected\":\"%08x\"}\n", __FUNCTION__, __FILE__, __LINE__, fileHeader.magic, FILE_MAGIC);
 		if (fileHeader.magic_maxSlots != MAXSLOTS)
 			ctx.fatal("\n{\"error\":\"db magic_maxslots\",\"where\":\"%s:%s:%d\",\"encountered\":%u,\"expected\":%u}\n", __FUNCTION__, __FILE__, __LINE__, fileHeader.magic_maxSlots, MAXSLOTS);
-		if (fileHeader.offEnd != (uint64_t) sbuf.st_size)
-			ctx.fatal("\n{\"error\":\"db size mismatch\",\"where\":\"%s:%s:%d\",\"encountered\":\"%lu\",\"expected\":\"%lu\"}\n", __FUNCTION__, __FILE__, __LINE__, fileHeader.offEnd, sbuf.st_size);
+		if (fileHeader.crcSections && fileHeader.crcChunkSize != DATABASE_CRCCHUNK)
+			ctx.fatal("\n{\"error\":\"db crcChunkSize\",\"where\":\"%s:%s:%d\",\"encountered\":%u,\"expected\":%u}\n", __FUNCTION__, __FILE__, __LINE__, fileHeader.crcChunkSize, DATABASE_CRCCHUNK);
+		if (fileHeader.offEnd != imageSize)
+			ctx.fatal("\n{\"error\":\"db size mismatch\",\"where\":\"%s:%s:%d\",\"encountered\":\"%lu\",\"expected\":\"%lu\"}\n", __FUNCTION__, __FILE__, __LINE__, fileHeader.offEnd, imageSize);
 		if (fileHeader.magic_sizeofSignature != sizeof(signature_t) && fileHeader.numSignature > 0)
 			ctx.fatal("\n{\"error\":\"db magic_sizeofSignature\",\"where\":\"%s:%s:%d\",\"encountered\":%u,\"expected\":%u}\n", __FUNCTION__, __FILE__, __LINE__, fileHeader.magic_sizeofSignature, (unsigned) sizeof(signature_t));
 		if (fileHeader.magic_sizeofSwap != sizeof(swap_t) && fileHeader.numSwap > 0)
@@ -974,6 +1211,8 @@ struct database_t {
 		imprints         = (imprint_t *) (rawDatabase + fileHeader.offImprints);
 		imprintIndexSize = fileHeader.imprintIndexSize;
 		imprintIndex     = (uint32_t *) (rawDatabase + fileHeader.offImprintIndex);
+		imprintFilterSize = fileHeader.imprintFilterSize;
+		imprintFilter     = fileHeader.imprintFilterSize ? (uint64_t *) (rawDatabase + fileHeader.offImprintFilter) : NULL;
 
 		// sid/tid
 		maxPair       = fileHeader.numPair;
@@ -988,6 +1227,15 @@ struct database_t {
 		members         = (member_t *) (rawDatabase + fileHeader.offMember);
 		memberIndexSize = fileHeader.memberIndexSize;
 		memberIndex     = (uint32_t *) (rawDatabase + fileHeader.offMemberIndex);
+
+		/*
+		 * Decompress container
+		 */
+		if (zipData) {
+			loadSections(~lazySections);
+			if (!lazySections)
+				releaseZip();
+		}
 	};
 
 	/**
@@ -1047,6 +1295,7 @@ struct database_t {
 		ctx.progressHi += align32(sizeof(*this->hintIndex) * this->hintIndexSize);
 		ctx.progressHi += align32(sizeof(*this->imprints) * this->numImprint);
 		ctx.progressHi += align32(sizeof(*this->imprintIndex) * this->imprintIndexSize);
+		ctx.progressHi += align32(sizeof(*this->imprintFilter) * this->imprintFilterSize);
 		ctx.progressHi += align32(sizeof(*this->pairs) * this->numPair);
 		ctx.progressHi += align32(sizeof(*this->pairIndex) * this->pairIndexSize);
 		ctx.progressHi += align32(sizeof(*this->members) * this->numMember);
@@ -1068,6 +1317,10 @@ struct database_t {
 		if (!outf)
 			ctx.fatal("\n{\"error\":\"fopen('w','%s')\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n", fileName, __FUNCTION__, __FILE__, __LINE__);
 
+		// image is compressed while writing
+		if (this->saveCompressed)
+			pZipWriter = new blockZipWriter_t(ctx, outf, fileName, (unsigned) sysconf(_SC_NPROCESSORS_ONLN));
+
 		/*
 		 * Write empty header (overwritten later)
 		 */
@@ -1207,6 +1460,12 @@ struct database_t {
 				fileHeader.offImprintIndex  = flen;
 				flen += writeData(outf, this->imprintIndex, sizeof(*this->imprintIndex) * this->imprintIndexSize, fileName);
 			}
+			if (this->imprintFilterSize) {
+				// Filter
+				fileHeader.imprintFilterSize = this->imprintFilterSize;
+				fileHeader.offImprintFilter  = flen;
+				flen += writeData(outf, this->imprintFilter, sizeof(*this->imprintFilter) * this->imprintFilterSize, fileName);
+			}
 		}
 
 		/*
@@ -1269,9 +1528,22 @@ struct database_t {
 		fileHeader.magic_sizeofMember  = sizeof(member_t);
 		fileHeader.offEnd                = flen;
 
+		// checksum sections in parallel
+		fileHeader.crcChunkSize = DATABASE_CRCCHUNK;
+		fileHeader.crcSections  = checksumSections(~0U, fileHeader.crcSection, (unsigned) sysconf(_SC_NPROCESSORS_ONLN));
+
 		// rewrite header
-		fseek(outf, 0, SEEK_SET);
-		fwrite(&fileHeader, sizeof(fileHeader), 1, outf);
+		uint64_t fileSize = flen;
+		if (pZipWriter) {
+			pZipWriter->finish(&fileHeader, sizeof(fileHeader));
+			fileSize = pZipWriter->fpos;
+
+			delete pZipWriter;
+			pZipWriter = NULL;
+		} else {
+			fseek(outf, 0, SEEK_SET);
+			fwrite(&fileHeader, sizeof(fileHeader), 1, outf);
+		}
 
 		// test for errors, most likely disk-full
 		if (feof(outf) || ferror(outf)) {
@@ -1293,201 +1565,827 @@ struct database_t {
 			fprintf(stderr, "\r\e[K"); // erase progress
 
 		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY)
-			fprintf(stderr, "[%s] Written %s, %lu bytes\n", ctx.timeAsString(), fileName, fileHeader.offEnd);
+			fprintf(stderr, "[%s] Written %s, %lu bytes\n", ctx.timeAsString(), fileName, fileSize);
 	}
 
+	/*
+	 * Section checksums
+	 */
+
 	/**
-	 * @date 2020-03-12 15:54:57
+	 * @date 2026-10-17 19:24:10
 	 *
-	 * Read data from database file
+	 * Unit of work for checksumming, one chunk of a section
 	 *
-	 * @param {number} hndl - OS file handle
-	 * @param {void[]} data - Buffer to read to
-	 * @param {number} dataLength - how much to read
-	 * @return {number} total number of bytes read
+	 * @typedef {object} crcJob_t
 	 */
-	uint64_t readData(int hndl, void *data, size_t dataLength) {
+	struct crcJob_t {
+		/// @var {number} data to checksum
+		const uint8_t *pData;
+		/// @var {number} length of data
+		size_t        length;
+		/// @var {number} resulting crc
+		uint32_t      crc;
+	};
 
-		// read in chunks of 1024*1024 bytes
-		uint64_t sumRead = 0;
-		while (dataLength > 0) {
-			if (ctx.opt_verbose >= ctx.VERBOSE_TICK && ctx.tick) {
-				fprintf(stderr, "\r\e[K%.5f%%", ctx.progress * 100.0 / ctx.progressHi);
-				ctx.tick = 0;
-			}
+	/**
+	 * @date 2026-10-17 19:24:10
+	 *
+	 * Shared state of checksum workers
+	 *
+	 * @typedef {object} crcPool_t
+	 */
+	struct crcPool_t {
+		/// @var {crcJob_t[]} chunks
+		crcJob_t *pJobs;
+		/// @var {number} number of chunks
+		unsigned numJobs;
+		/// @var {number} next chunk to claim
+		unsigned nextJob;
+	};
 
-			/*
-			 * Determine bytes to write
-			 */
-			size_t sliceLength = dataLength;
-			if (sliceLength > 1024 * 1024)
-				sliceLength = 1024 * 1024;
+	/**
+	 * @date 2026-10-17 19:25:37
+	 *
+	 * `crc32c` over a memory range
+	 *
+	 * @param {number} pData - data
+	 * @param {number} length - length of data
+	 * @return {number} crc
+	 */
+	static uint32_t crcData(const uint8_t *pData, size_t length) {
+		uint64_t crc = 0;
 
-			/*
-			 * Write
-			 */
-			size_t ret = ::read(hndl, data, sliceLength);
-			if (ret != sliceLength)
-				ctx.fatal("\n{\"error\":\"read(%lu)\",\"where\":\"%s:%s:%d\",\"return\":\"%lu\"}\n", sliceLength, __FUNCTION__, __FILE__, __LINE__, ret);
+		for (; length >= 8; pData += 8, length -= 8)
+			__asm__ __volatile__ ("crc32q %1, %0" : "+r"(crc) : "rm"(*(const uint64_t *) pData));
+		for (; length > 0; pData++, length--)
+			__asm__ __volatile__ ("crc32b %1, %k0" : "+r"(crc) : "rm"(*pData));
 
-			/*
-			 * Update
-			 */
-			data = (void *) ((char *) data + sliceLength);
-			dataLength -= sliceLength;
-			ctx.progress += sliceLength;
-			sumRead += sliceLength;
+		return (uint32_t) crc;
+	}
+
+	/**
+	 * @date 2026-10-17 19:25:37
+	 *
+	 * Worker claiming and checksumming chunks until exhausted
+	 *
+	 * @param {crcPool_t} arg - shared state
+	 * @return {null}
+	 */
+	static void *crcWorker(void *arg) {
+		crcPool_t *pPool = (crcPool_t *) arg;
+
+		for (;;) {
+			unsigned iJob = __sync_fetch_and_add(&pPool->nextJob, 1);
+			if (iJob >= pPool->numJobs)
+				break;
+
+			crcJob_t *pJob = pPool->pJobs + iJob;
+			pJob->crc = crcData(pJob->pData, pJob->length);
 		}
 
-		return sumRead;
+		return NULL;
 	}
 
 	/**
-	 * @date 2020-03-12 15:56:46
+	 * @date 2026-10-17 19:27:02
 	 *
-	 * Write data to database file
+	 * Get the memory ranges of a section, as they are written by `save()`
 	 *
-	 * @param {number} hndl - OS file handle
-	 * @param {void[]} data - Buffer to read to
-	 * @param {number} dataLength - how much to write
-	 * @param {string} fileName - file to delete on error
-	 * @return {number} total number of bytes written
+	 * @param {number} iFlag - `ALLOCFLAG_*`
+	 * @param {void[]} ppData - (output) start of ranges
+	 * @param {number[]} pLength - (output) length of ranges
+	 * @return {number} number of ranges, at most `DATABASE_MAXRANGE`
 	 */
-	uint64_t writeData(FILE *outf, const void *data, size_t dataLength, const char *fileName) {
+	unsigned sectionRanges(unsigned iFlag, const void **ppData, size_t *pLength) const {
+		unsigned numRange = 0;
+
+#define ADDRANGE(PTR, NUM) do { if ((NUM) > 0) { ppData[numRange] = (PTR); pLength[numRange] = sizeof(*(PTR)) * (NUM); numRange++; } } while (0)
+		switch (iFlag) {
+		case ALLOCFLAG_TRANSFORM:
+			ADDRANGE(fwdTransformData, numTransform);
+			ADDRANGE(revTransformData, numTransform);
+			ADDRANGE(fwdTransformNames, numTransform);
+			ADDRANGE(revTransformNames, numTransform);
+			ADDRANGE(revTransformIds, numTransform);
+			if (numTransform) {
+				ADDRANGE(fwdTransformNameIndex, transformIndexSize);
+				ADDRANGE(revTransformNameIndex, transformIndexSize);
+			}
+			break;
+		case ALLOCFLAG_EVALUATOR:
+			ADDRANGE(fwdEvaluator, numEvaluator);
+			ADDRANGE(revEvaluator, numEvaluator);
+			break;
+		case ALLOCFLAG_SIGNATURE:
+			ADDRANGE(signatures, numSignature);
+			break;
+		case ALLOCFLAG_SIGNATUREINDEX:
+			if (numSignature)
+				ADDRANGE(signatureIndex, signatureIndexSize);
+			break;
+		case ALLOCFLAG_SWAP:
+			ADDRANGE(swaps, numSwap);
+			break;
+		case ALLOCFLAG_SWAPINDEX:
+			if (numSwap)
+				ADDRANGE(swapIndex, swapIndexSize);
+			break;
+		case ALLOCFLAG_HINT:
+			ADDRANGE(hints, numHint);
+			break;
+		case ALLOCFLAG_HINTINDEX:
+			if (numHint)
+				ADDRANGE(hintIndex, hintIndexSize);
+			break;
+		case ALLOCFLAG_IMPRINT:
+			ADDRANGE(imprints, numImprint);
+			break;
+		case ALLOCFLAG_IMPRINTINDEX:
+			if (numImprint) {
+				ADDRANGE(imprintIndex, imprintIndexSize);
+				ADDRANGE(imprintFilter, imprintFilterSize);
+			}
+			break;
+		case ALLOCFLAG_PAIR:
+			ADDRANGE(pairs, numPair);
+			break;
+		case ALLOCFLAG_PAIRINDEX:
+			if (numPair)
+				ADDRANGE(pairIndex, pairIndexSize);
+			break;
+		case ALLOCFLAG_MEMBER:
+			ADDRANGE(members, numMember);
+			break;
+		case ALLOCFLAG_MEMBERINDEX:
+			if (numMember)
+				ADDRANGE(memberIndex, memberIndexSize);
+			break;
+		}
+#undef ADDRANGE
 
-		// write in chunks of 1024*1024 bytes
+		return numRange;
+	}
 
-		size_t written = 0;
-		while (dataLength > 0) {
-			if (ctx.opt_verbose >= ctx.VERBOSE_TICK && ctx.tick) {
-				fprintf(stderr, "\r\e[K%.5f%%", ctx.progress * 100.0 / ctx.progressHi);
-				ctx.tick = 0;
+	/**
+	 * @date 2026-10-17 19:29:45
+	 *
+	 * Calculate section checksums.
+	 *
+	 * Sections are split in chunks of `DATABASE_CRCCHUNK` bytes that are checksummed in parallel.
+	 * The section checksum is the `crc32c` of the chunk checksums, independent of the number of threads.
+	 *
+	 * @param {number} sections - `ALLOCMASK_*` of sections to checksum
+	 * @param {number[]} pCrc - (output) checksums indexed by `ALLOCFLAG_*`
+	 * @param {number} numThreads - number of worker threads, 0 for serial
+	 * @return {number} `ALLOCMASK_*` of sections that are non-empty
+	 */
+	unsigned checksumSections(unsigned sections, uint32_t *pCrc, unsigned numThreads) const {
+		const void *pRangeData[DATABASE_MAXSECTION][DATABASE_MAXRANGE];
+		size_t     rangeLength[DATABASE_MAXSECTION][DATABASE_MAXRANGE];
+		unsigned   numRange[DATABASE_MAXSECTION];
+		unsigned   nonEmpty = 0;
+
+		/*
+		 * Split sections into chunks
+		 */
+		unsigned numJobs = 0;
+		for (unsigned iFlag = 0; iFlag <= ALLOCFLAG_MEMBERINDEX; iFlag++) {
+			numRange[iFlag] = 0;
+			if (sections & (1 << iFlag))
+				numRange[iFlag] = sectionRanges(iFlag, pRangeData[iFlag], rangeLength[iFlag]);
+
+			for (unsigned iRange = 0; iRange < numRange[iFlag]; iRange++)
+				numJobs += (rangeLength[iFlag][iRange] + DATABASE_CRCCHUNK - 1) / DATABASE_CRCCHUNK;
+		}
+
+		crcPool_t pool;
+		pool.pJobs   = (crcJob_t *) ctx.myAlloc("database_t::crcJobs", numJobs + 1, sizeof(*pool.pJobs));
+		pool.numJobs = 0;
+		pool.nextJob = 0;
+
+		for (unsigned iFlag = 0; iFlag <= ALLOCFLAG_MEMBERINDEX; iFlag++) {
+			for (unsigned iRange = 0; iRange < numRange[iFlag]; iRange++) {
+				const uint8_t *pData = (const uint8_t *) pRangeData[iFlag][iRange];
+
+				for (size_t ofs = 0; ofs < rangeLength[iFlag][iRange]; ofs += DATABASE_CRCCHUNK) {
+					crcJob_t *pJob = pool.pJobs + pool.numJobs++;
+
+					pJob->pData  = pData + ofs;
+					pJob->length = rangeLength[iFlag][iRange] - ofs;
+					if (pJob->length > DATABASE_CRCCHUNK)
+						pJob->length = DATABASE_CRCCHUNK;
+				}
 			}
+		}
+		assert(pool.numJobs == numJobs);
 
-			/*
-			 * Determine bytes to write
-			 */
-			uint64_t sliceLength = dataLength;
-			if (sliceLength > 1024 * 1024)
-				sliceLength = 1024 * 1024;
+		/*
+		 * Checksum chunks
+		 */
+		if (numThreads > numJobs)
+			numThreads = numJobs;
 
-			/*
-			 * Write
-			 */
-			size_t ret = ::fwrite(data, 1, sliceLength, outf);
-			if (ret != sliceLength) {
-				int savErrno = errno;
-				::remove(fileName);
-				errno        = savErrno;
-				ctx.fatal("\n{\"error\":\"fwrite(%lu)\",\"where\":\"%s:%s:%d\",\"return\":\"%lu\"}\n", sliceLength, __FUNCTION__, __FILE__, __LINE__, ret);
+		if (numThreads <= 1) {
+			crcWorker(&pool);
+		} else {
+			pthread_t *pThreads = (pthread_t *) ctx.myAlloc("database_t::crcThreads", numThreads, sizeof(*pThreads));
+
+			for (unsigned iThread = 0; iThread < numThreads; iThread++) {
+				int ret = pthread_create(&pThreads[iThread], NULL, crcWorker, &pool);
+				if (ret)
+					ctx.fatal("\n{\"error\":\"pthread_create() failed\",\"where\":\"%s:%s:%d\",\"return\":%d}\n",
+						  __FUNCTION__, __FILE__, __LINE__, ret);
 			}
+			for (unsigned iThread = 0; iThread < numThreads; iThread++)
+				pthread_join(pThreads[iThread], NULL);
 
-			/*
-			 * Update
-			 */
-			data = (void *) ((char *) data + sliceLength);
-			dataLength -= sliceLength;
-			written += sliceLength;
-			ctx.progress += sliceLength;
+			ctx.myFree("database_t::crcThreads", pThreads);
 		}
 
 		/*
-		 * 32-byte align for SIMD
+		 * Combine chunks into sections
 		 */
-		dataLength = 32U - (written & 31U);
-		if (dataLength > 0) {
-			uint8_t zero32[32] = {0};
+		crcJob_t *pJob = pool.pJobs;
+		for (unsigned iFlag = 0; iFlag <= ALLOCFLAG_MEMBERINDEX; iFlag++) {
+			uint64_t crc = 0;
 
-			fwrite(zero32, dataLength, 1, outf);
-			written += dataLength;
+			for (unsigned iRange = 0; iRange < numRange[iFlag]; iRange++) {
+				for (size_t ofs = 0; ofs < rangeLength[iFlag][iRange]; ofs += DATABASE_CRCCHUNK, pJob++)
+					__asm__ __volatile__ ("crc32l %1, %k0" : "+r"(crc) : "rm"(pJob->crc));
+			}
+
+			if (sections & (1 << iFlag))
+				pCrc[iFlag] = (uint32_t) crc;
+			if (numRange[iFlag])
+				nonEmpty |= 1 << iFlag;
 		}
 
-		return written;
-	}
+		ctx.myFree("database_t::crcJobs", pool.pJobs);
 
-	/*
-	 * Transform store
-	 */
+		return nonEmpty;
+	}
 
 	/**
-	 * @date 2020-03-12 10:28:05
-	 *
-	 * Lookup a transform name and return its matching enumeration id.
-	 * Transform names can be short meaning that trailing endpoints which are in sync can be omitted.
-	 * Example: For `"bdacefghi"`, `"bdac"` is the minimum transform name and `"efghi"` is the "long" part.
+	 * @date 2026-10-17 19:31:18
 	 *
-	 * NOTE: Transform names must be syntactically correct:
-	 *  - No longer than `MAXSLOTS` characters
-	 *  - Consisting of exclusively the lowercase letters `'a'` to `'i'` (for `MAXSLOTS`==9)
+	 * Verify section checksums stored by `save()`.
+	 * Sections without stored checksum are silently accepted.
 	 *
-	 * @param {string} pName - Transform name
-	 * @param {number[MAXTRANSFORMINDEX]} pIndex - output name lookup index
-	 * @return {number} - Transform enumeration id or `IBIT` if "not-found"
+	 * @param {number} sections - `ALLOCMASK_*` of sections to verify
+	 * @param {number} numThreads - number of worker threads, 0 for serial
 	 */
-	inline unsigned lookupTransform(const char *pName, uint32_t *pIndex) {
-		assert(pIndex);
+	void verifySections(unsigned sections, unsigned numThreads) const {
+		uint32_t crc[DATABASE_MAXSECTION];
 
-		// starting position in index
-		unsigned pos = MAXSLOTS + 1;
+		// compressed containers decompress on demand
+		loadSections(sections);
 
-		// walk through states
-		while (*pName) {
-			pos = pIndex[pos + *pName - 'a'];
-			pName++;
+		sections &= fileHeader.crcSections;
+		if (!sections)
+			return;
+
+		checksumSections(sections, crc, numThreads);
+
+		for (unsigned iFlag = 0; iFlag <= ALLOCFLAG_MEMBERINDEX; iFlag++) {
+			if ((sections & (1 << iFlag)) && crc[iFlag] != fileHeader.crcSection[iFlag])
+				ctx.fatal("\n{\"error\":\"section checksum mismatch\",\"where\":\"%s:%s:%d\",\"section\":\"%s\",\"encountered\":\"%08x\",\"expected\":\"%08x\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__, sectionToText(1 << iFlag), crc[iFlag], fileHeader.crcSection[iFlag]);
 		}
 
-		// what to return
-		if (pos == 0)
-			return IBIT; // "not-found"
-		else if (!(pos & IBIT))
-			return pIndex[pos + MAXSLOTS] & ~IBIT; // short names
-		else
-			return pos & ~IBIT; // long name
+		if (ctx.opt_verbose >= ctx.VERBOSE_VERBOSE)
+			fprintf(stderr, "[%s] Verified sections [%s]\n", ctx.timeAsString(), sectionToText(sections));
 	}
 
+	/*
+	 * Section prefetch
+	 */
 
 	/**
-	 * @date 2020-05-04 10:06:58
+	 * @date 2026-10-17 19:41:26
 	 *
-	 * Lookup a name after applying a transform and return its matching enumeration id.
+	 * Background prefetch of mmapped sections
 	 *
-	 * @param {string} pName - Transform name
-	 * @param {string} pSkin - Apply transform to pName
-	 * @param {number[MAXTRANSFORMINDEX]} pIndex - output name lookup index
-	 * @return {number} - Transform enumeration id or `IBIT` if "not-found"
+	 * @typedef {object} prefetch_t
 	 */
-	inline unsigned lookupTransformName(const char *pName, const char *pSkin, uint32_t *pIndex) {
-		assert(pIndex);
+	struct prefetch_t {
+		/// @var {pthread_t} thread handle
+		pthread_t      thread;
+		/// @var {number} set to abort prefetching
+		volatile int   abort;
+		/// @var {number} number of ranges
+		unsigned       numRange;
+		/// @var {number[]} page aligned start of ranges
+		const uint8_t  *pStart[DATABASE_MAXSECTION * DATABASE_MAXRANGE];
+		/// @var {number[]} page aligned end of ranges
+		const uint8_t  *pEnd[DATABASE_MAXSECTION * DATABASE_MAXRANGE];
+	};
 
-		// starting position in index
-		unsigned pos = MAXSLOTS + 1;
+	/**
+	 * @date 2026-10-17 19:42:55
+	 *
+	 * Touch every page of the prefetch ranges.
+	 * Page table entries are shared by all threads, the main thread will find them already mapped.
+	 *
+	 * @param {prefetch_t} arg - ranges
+	 * @return {null}
+	 */
+	static void *prefetchWorker(void *arg) {
+		prefetch_t *pPrefetch = (prefetch_t *) arg;
+		uint8_t    sum        = 0;
 
-		// walk through states
-		while (*pName) {
-			pos = pIndex[pos + pSkin[*pName - 'a'] - 'a'];
-			pName++;
+		for (unsigned iRange = 0; iRange < pPrefetch->numRange && !pPrefetch->abort; iRange++) {
+			for (const uint8_t *p = pPrefetch->pStart[iRange]; p < pPrefetch->pEnd[iRange] && !pPrefetch->abort; p += DATABASE_PAGESIZE)
+				sum += *(const volatile uint8_t *) p;
 		}
 
-		// what to return
-		if (pos == 0)
-			return IBIT; // "not-found"
-		else if (!(pos & IBIT))
-			return pIndex[pos + MAXSLOTS] & ~IBIT; // short names
-		else
-			return pos & ~IBIT; // long name
+		return (void *) (uintptr_t) sum;
 	}
 
 	/**
-	 * @date 2020-05-04 10:06:58
+	 * @date 2026-10-17 19:44:31
 	 *
-	 * Lookup a name after applying transform to slot indices and return its matching enumeration id.
+	 * Declare how a tool is going to access sections.
+	 * Only affects sections that are mmapped by `open()`, allocated sections are already resident.
 	 *
-	 * Example, for `transform="cab"`: "{slots[2],slots[0],slots[1]}"
+	 *  - `ACCESS_RANDOM`: sparse probes like indices, no readahead. Default after `open()`.
+	 *  - `ACCESS_SEQUENTIAL`: scanned front to back, aggressive readahead and background prefetch.
+	 *  - `ACCESS_WILLNEED`: randomly accessed but (nearly) all pages will be touched, background prefetch.
 	 *
-	 * @param {string} pName - Transform name
-	 * @param {string} pSkin - Apply transform to pName
-	 * @param {number[MAXTRANSFORMINDEX]} pIndex - output name lookup index
-	 * @return {number} - Transform enumeration id or `IBIT` if "not-found"
+	 * Prefetching runs in a background thread so cold-cache startup overlaps computation.
+	 *
+	 * @param {number} sections - `ALLOCMASK_*` of sections
+	 * @param {number} access - `ACCESS_*`
+	 */
+	void adviseSections(unsigned sections, unsigned access) {
+#if defined(HAVE_MMAP)
+		if (!hndl)
+			return;
+
+		int advice = (access == ACCESS_SEQUENTIAL) ? MADV_SEQUENTIAL : MADV_RANDOM;
+
+		prefetch_t *pPrefetch = NULL;
+		if (access != ACCESS_RANDOM) {
+			// make room
+			if (numPrefetch >= DATABASE_MAXPREFETCH)
+				stopPrefetch(false);
+
+			pPrefetch = (prefetch_t *) ctx.myAlloc("database_t::prefetch", 1, sizeof(*pPrefetch));
+			pPrefetch->abort    = 0;
+			pPrefetch->numRange = 0;
+		}
+
+		for (unsigned iFlag = 0; iFlag <= ALLOCFLAG_MEMBERINDEX; iFlag++) {
+			if (!(sections & (1 << iFlag)) || (allocFlags & (1 << iFlag)))
+				continue;
+
+			const void *pData[DATABASE_MAXRANGE];
+			size_t     length[DATABASE_MAXRANGE];
+			unsigned   numRange = sectionRanges(iFlag, pData, length);
+
+			for (unsigned iRange = 0; iRange < numRange; iRange++) {
+				const uint8_t *pStart = (const uint8_t *) pData[iRange];
+				const uint8_t *pEnd   = pStart + length[iRange];
+
+				// only the mapping, sections could have been replaced
+				if (pStart < rawDatabase || pEnd > rawDatabase + fileHeader.offEnd)
+					continue;
+
+				// page align
+				pStart = (const uint8_t *) ((uintptr_t) pStart & ~(uintptr_t) (DATABASE_PAGESIZE - 1));
+
+				if (::madvise((void *) pStart, pEnd - pStart, advice))
+					ctx.fatal("\n{\"error\":\"madvise(%d)\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n", advice, __FUNCTION__, __FILE__, __LINE__);
+
+				if (pPrefetch) {
+					// kernel readahead
+					if (::madvise((void *) pStart, pEnd - pStart, MADV_WILLNEED))
+						ctx.fatal("\n{\"error\":\"madvise(MADV_WILLNEED)\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n", __FUNCTION__, __FILE__, __LINE__);
+
+					pPrefetch->pStart[pPrefetch->numRange] = pStart;
+					pPrefetch->pEnd[pPrefetch->numRange]   = pEnd;
+					pPrefetch->numRange++;
+				}
+			}
+		}
+
+		if (!pPrefetch)
+			return;
+
+		if (pPrefetch->numRange == 0) {
+			ctx.myFree("database_t::prefetch", pPrefetch);
+			return;
+		}
+
+		int ret = pthread_create(&pPrefetch->thread, NULL, prefetchWorker, pPrefetch);
+		if (ret)
+			ctx.fatal("\n{\"error\":\"pthread_create() failed\",\"where\":\"%s:%s:%d\",\"return\":%d}\n", __FUNCTION__, __FILE__, __LINE__, ret);
+
+		prefetchThreads[numPrefetch++] = pPrefetch;
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_VERBOSE)
+			fprintf(stderr, "[%s] Prefetching sections [%s]\n", ctx.timeAsString(), sectionToText(sections & ~allocFlags));
+#else
+		// sections are already read into memory
+		(void) sections;
+		(void) access;
+#endif
+	}
+
+	/**
+	 * @date 2026-10-17 19:46:03
+	 *
+	 * Wait for, or abort, background prefetching
+	 *
+	 * @param {boolean} abort - `true` to stop as soon as possible
+	 */
+	void stopPrefetch(bool abort) {
+		for (unsigned iPrefetch = 0; iPrefetch < numPrefetch; iPrefetch++) {
+			prefetch_t *pPrefetch = (prefetch_t *) prefetchThreads[iPrefetch];
+
+			if (abort)
+				pPrefetch->abort = 1;
+			pthread_join(pPrefetch->thread, NULL);
+
+			ctx.myFree("database_t::prefetch", pPrefetch);
+		}
+		numPrefetch = 0;
+	}
+
+	/*
+	 * Block-compressed container
+	 */
+
+	/**
+	 * @date 2026-10-17 20:12:36
+	 *
+	 * Inflate the header of a block-compressed container, replacing `rawDatabase` with an in-memory image.
+	 * Sections are decompressed by `loadSections()`.
+	 *
+	 * @param {string} fileName - database filename
+	 * @param {number} fileSize - size of container
+	 * @return {number} size of image
+	 */
+	uint64_t inflateDatabase(const char *fileName, size_t fileSize) {
+		const blockZipHeader_t *pHeader = (const blockZipHeader_t *) rawDatabase;
+
+		if (pHeader->blockSize != BLOCKZIP_BLOCKSIZE || pHeader->headerSize != sizeof(fileHeader_t) ||
+		    pHeader->numBlock != (pHeader->rawSize + BLOCKZIP_BLOCKSIZE - 1) / BLOCKZIP_BLOCKSIZE ||
+		    pHeader->offIndex + (pHeader->numBlock + 1) * sizeof(uint64_t) > fileSize)
+			ctx.fatal("\n{\"error\":\"corrupt container header\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\"}\n", __FUNCTION__, __FILE__, __LINE__, fileName);
+
+		zipData   = rawDatabase;
+		zipSize   = fileSize;
+		zipImage  = (uint8_t *) ctx.myAlloc("database_t::rawDatabase", 1, pHeader->rawSize);
+		zipLoaded = (uint8_t *) ctx.myAlloc("database_t::zipLoaded", pHeader->numBlock, sizeof(*zipLoaded));
+		zipJobs   = (uint64_t *) ctx.myAlloc("database_t::zipJobs", pHeader->numBlock, sizeof(*zipJobs));
+
+		rawDatabase = zipImage;
+
+#if defined(HAVE_MMAP)
+		// blocks are mostly read in order
+		if (::madvise((void *) zipData, zipSize, MADV_SEQUENTIAL))
+			ctx.fatal("\n{\"error\":\"madvise(MADV_SEQUENTIAL,'%s')\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n", fileName, __FUNCTION__, __FILE__, __LINE__);
+
+		// mapping stays valid, continue as if loaded with `read()`
+		::close(hndl);
+		hndl = 0;
+#endif
+
+		// the final image header is stored separately
+		loadBlocks(0, sizeof(fileHeader_t));
+		::memcpy(zipImage, pHeader->rawHeader, sizeof(fileHeader_t));
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "[%s] Inflating %s, %lu blocks\n", ctx.timeAsString(), fileName, pHeader->numBlock);
+
+		return pHeader->rawSize;
+	}
+
+	/**
+	 * @date 2026-10-17 20:14:02
+	 *
+	 * Decompress a single block
+	 */
+	static bool inflateJob(blockZipPool_t *pPool, unsigned iJob) {
+		const database_t       *pDb     = (const database_t *) pPool->arg;
+		const blockZipHeader_t *pHeader = (const blockZipHeader_t *) pDb->zipData;
+		const uint64_t         *pIndex  = (const uint64_t *) (pDb->zipData + pHeader->offIndex);
+		uint64_t               iBlock   = pDb->zipJobs[iJob];
+
+		uint64_t rawOfs = iBlock * BLOCKZIP_BLOCKSIZE;
+		size_t   rawLen = pHeader->rawSize - rawOfs;
+		if (rawLen > BLOCKZIP_BLOCKSIZE)
+			rawLen = BLOCKZIP_BLOCKSIZE;
+
+		if (pIndex[iBlock] > pIndex[iBlock + 1] || pIndex[iBlock + 1] > pHeader->offIndex)
+			return false;
+		size_t zipLen = pIndex[iBlock + 1] - pIndex[iBlock];
+
+		if (zipLen == rawLen) {
+			// stored
+			::memcpy(pDb->zipImage + rawOfs, pDb->zipData + pIndex[iBlock], rawLen);
+			return true;
+		}
+
+		return blockZipDecompress(pDb->zipData + pIndex[iBlock], zipLen, pDb->zipImage + rawOfs, rawLen);
+	}
+
+	/**
+	 * @date 2026-10-17 20:15:40
+	 *
+	 * Decompress, in parallel, the blocks covering an image range that are not yet loaded
+	 * Locked, `zipJobs[]` and `zipLoaded[]` are shared by all callers.
+	 *
+	 * @param {number} ofs - start of range in image
+	 * @param {number} length - length of range
+	 */
+	void loadBlocks(uint64_t ofs, uint64_t length) const {
+		if (!zipData || length == 0)
+			return;
+
+		uint64_t iFirst = ofs / BLOCKZIP_BLOCKSIZE;
+		uint64_t iLast  = (ofs + length - 1) / BLOCKZIP_BLOCKSIZE;
+
+		pthread_mutex_lock(&zipMutex);
+
+		unsigned numJobs = 0;
+		for (uint64_t iBlock = iFirst; iBlock <= iLast; iBlock++) {
+			if (!zipLoaded[iBlock])
+				zipJobs[numJobs++] = iBlock;
+		}
+		if (!numJobs) {
+			pthread_mutex_unlock(&zipMutex);
+			return;
+		}
+
+		blockZipPool_t pool;
+		pool.numJobs = numJobs;
+		pool.handler = inflateJob;
+		pool.arg     = (void *) this;
+
+		if (pool.run(ctx, (unsigned) sysconf(_SC_NPROCESSORS_ONLN)))
+			ctx.fatal("\n{\"error\":\"corrupt container block\",\"where\":\"%s:%s:%d\"}\n", __FUNCTION__, __FILE__, __LINE__);
+
+		for (unsigned iJob = 0; iJob < numJobs; iJob++)
+			zipLoaded[zipJobs[iJob]] = 1;
+
+		pthread_mutex_unlock(&zipMutex);
+	}
+
+	/**
+	 * @date 2026-10-17 20:17:18
+	 *
+	 * Decompress sections of a block-compressed container.
+	 * Sections passed as `lazySections` to `open()` must be loaded before use.
+	 *
+	 * @param {number} sections - `ALLOCMASK_*` of sections to load
+	 */
+	void loadSections(unsigned sections) const {
+		if (!zipData)
+			return;
+
+		for (unsigned iFlag = 0; iFlag <= ALLOCFLAG_MEMBERINDEX; iFlag++) {
+			if (!(sections & (1 << iFlag)) || (allocFlags & (1 << iFlag)))
+				continue;
+
+			const void *pData[DATABASE_MAXRANGE];
+			size_t     length[DATABASE_MAXRANGE];
+			unsigned   numRange = sectionRanges(iFlag, pData, length);
+
+			for (unsigned iRange = 0; iRange < numRange; iRange++) {
+				const uint8_t *pStart = (const uint8_t *) pData[iRange];
+
+				// only the image, sections could have been replaced
+				if (pStart >= zipImage && pStart + length[iRange] <= zipImage + fileHeader.offEnd)
+					loadBlocks(pStart - zipImage, length[iRange]);
+			}
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 20:18:45
+	 *
+	 * Release the compressed container when everything is loaded
+	 */
+	void releaseZip(void) {
+		if (!zipData)
+			return;
+
+#if defined(HAVE_MMAP)
+		if (::munmap((void *) zipData, zipSize))
+			ctx.fatal("\n{\"error\":\"munmap()\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n", __FUNCTION__, __FILE__, __LINE__);
+#else
+		ctx.myFree("database_t::zipData", (void *) zipData);
+#endif
+		ctx.myFree("database_t::zipLoaded", zipLoaded);
+
+		zipData   = NULL;
+		zipLoaded = NULL;
+	}
+
+	/**
+	 * @date 2020-03-12 15:54:57
+	 *
+	 * Read data from database file
+	 *
+	 * @param {number} hndl - OS file handle
+	 * @param {void[]} data - Buffer to read to
+	 * @param {number} dataLength - how much to read
+	 * @return {number} total number of bytes read
+	 */
+	uint64_t readData(int hndl, void *data, size_t dataLength) {
+
+		// read in chunks of 1024*1024 bytes
+		uint64_t sumRead = 0;
+		while (dataLength > 0) {
+			if (ctx.opt_verbose >= ctx.VERBOSE_TICK && ctx.tick) {
+				fprintf(stderr, "\r\e[K%.5f%%", ctx.progress * 100.0 / ctx.progressHi);
+				ctx.tick = 0;
+			}
+
+			/*
+			 * Determine bytes to write
+			 */
+			size_t sliceLength = dataLength;
+			if (sliceLength > 1024 * 1024)
+				sliceLength = 1024 * 1024;
+
+			/*
+			 * Write
+			 */
+			size_t ret = ::read(hndl, data, sliceLength);
+			if (ret != sliceLength)
+				ctx.fatal("\n{\"error\":\"read(%lu)\",\"where\":\"%s:%s:%d\",\"return\":\"%lu\"}\n", sliceLength, __FUNCTION__, __FILE__, __LINE__, ret);
+
+			/*
+			 * Update
+			 */
+			data = (void *) ((char *) data + sliceLength);
+			dataLength -= sliceLength;
+			ctx.progress += sliceLength;
+			sumRead += sliceLength;
+		}
+
+		return sumRead;
+	}
+
+	/**
+	 * @date 2020-03-12 15:56:46
+	 *
+	 * Write data to database file
+	 *
+	 * @param {number} hndl - OS file handle
+	 * @param {void[]} data - Buffer to read to
+	 * @param {number} dataLength - how much to write
+	 * @param {string} fileName - file to delete on error
+	 * @return {number} total number of bytes written
+	 */
+	uint64_t writeData(FILE *outf, const void *data, size_t dataLength, const char *fileName) {
+
+		if (pZipWriter) {
+			// same padding as uncompressed, image offsets must match
+			uint8_t zero32[32] = {0};
+
+			pZipWriter->write(data, dataLength);
+			pZipWriter->write(zero32, 32U - (dataLength & 31U));
+			ctx.progress += dataLength;
+			return dataLength + 32U - (dataLength & 31U);
+		}
+
+		// write in chunks of 1024*1024 bytes
+
+		size_t written = 0;
+		while (dataLength > 0) {
+			if (ctx.opt_verbose >= ctx.VERBOSE_TICK && ctx.tick) {
+				fprintf(stderr, "\r\e[K%.5f%%", ctx.progress * 100.0 / ctx.progressHi);
+				ctx.tick = 0;
+			}
+
+			/*
+			 * Determine bytes to write
+			 */
+			uint64_t sliceLength = dataLength;
+			if (sliceLength > 1024 * 1024)
+				sliceLength = 1024 * 1024;
+
+			/*
+			 * Write
+			 */
+			size_t ret = ::fwrite(data, 1, sliceLength, outf);
+			if (ret != sliceLength) {
+				int savErrno = errno;
+				::remove(fileName);
+				errno        = savErrno;
+				ctx.fatal("\n{\"error\":\"fwrite(%lu)\",\"where\":\"%s:%s:%d\",\"return\":\"%lu\"}\n", sliceLength, __FUNCTION__, __FILE__, __LINE__, ret);
+			}
+
+			/*
+			 * Update
+			 */
+			data = (void *) ((char *) data + sliceLength);
+			dataLength -= sliceLength;
+			written += sliceLength;
+			ctx.progress += sliceLength;
+		}
+
+		/*
+		 * 32-byte align for SIMD
+		 */
+		dataLength = 32U - (written & 31U);
+		if (dataLength > 0) {
+			uint8_t zero32[32] = {0};
+
+			fwrite(zero32, dataLength, 1, outf);
+			written += dataLength;
+		}
+
+		return written;
+	}
+
+	/*
+	 * Transform store
+	 */
+
+	/**
+	 * @date 2020-03-12 10:28:05
+	 *
+	 * Lookup a transform name and return its matching enumeration id.
+	 * Transform names can be short meaning that trailing endpoints which are in sync can be omitted.
+	 * Example: For `"bdacefghi"`, `"bdac"` is the minimum transform name and `"efghi"` is the "long" part.
+	 *
+	 * NOTE: Transform names must be syntactically correct:
+	 *  - No longer than `MAXSLOTS` characters
+	 *  - Consisting of exclusively the lowercase letters `'a'` to `'i'` (for `MAXSLOTS`==9)
+	 *
+	 * @param {string} pName - Transform name
+	 * @param {number[MAXTRANSFORMINDEX]} pIndex - output name lookup index
+	 * @return {number} - Transform enumeration id or `IBIT` if "not-found"
+	 */
+	inline unsigned lookupTransform(const char *pName, uint32_t *pIndex) {
+		assert(pIndex);
+
+		// starting position in index
+		unsigned pos = MAXSLOTS + 1;
+
+		// walk through states
+		while (*pName) {
+			pos = pIndex[pos + *pName - 'a'];
+			pName++;
+		}
+
+		// what to return
+		if (pos == 0)
+			return IBIT; // "not-found"
+		else if (!(pos & IBIT))
+			return pIndex[pos + MAXSLOTS] & ~IBIT; // short names
+		else
+			return pos & ~IBIT; // long name
+	}
+
+
+	/**
+	 * @date 2020-05-04 10:06:58
+	 *
+	 * Lookup a name after applying a transform and return its matching enumeration id.
+	 *
+	 * @param {string} pName - Transform name
+	 * @param {string} pSkin - Apply transform to pName
+	 * @param {number[MAXTRANSFORMINDEX]} pIndex - output name lookup index
+	 * @return {number} - Transform enumeration id or `IBIT` if "not-found"
+	 */
+	inline unsigned lookupTransformName(const char *pName, const char *pSkin, uint32_t *pIndex) {
+		assert(pIndex);
+
+		// starting position in index
+		unsigned pos = MAXSLOTS + 1;
+
+		// walk through states
+		while (*pName) {
+			pos = pIndex[pos + pSkin[*pName - 'a'] - 'a'];
+			pName++;
+		}
+
+		// what to return
+		if (pos == 0)
+			return IBIT; // "not-found"
+		else if (!(pos & IBIT))
+			return pIndex[pos + MAXSLOTS] & ~IBIT; // short names
+		else
+			return pos & ~IBIT; // long name
+	}
+
+	/**
+	 * @date 2020-05-04 10:06:58
+	 *
+	 * Lookup a name after applying transform to slot indices and return its matching enumeration id.
+	 *
+	 * Example, for `transform="cab"`: "{slots[2],slots[0],slots[1]}"
+	 *
+	 * @param {string} pName - Transform name
+	 * @param {string} pSkin - Apply transform to pName
+	 * @param {number[MAXTRANSFORMINDEX]} pIndex - output name lookup index
+	 * @return {number} - Transform enumeration id or `IBIT` if "not-found"
 	 */
 	inline unsigned lookupTransformSlot(const char *pName, const char *pSkin, uint32_t *pIndex) {
 		assert(pIndex);
@@ -1574,6 +2472,9 @@ struct database_t {
 	 * @return {number} offset into index
 	 */
 	inline unsigned lookupSignature(const char *name) {
+		if (mustGrowIndex(ALLOCMASK_SIGNATUREINDEX, numSignature, signatureIndexSize))
+			growIndex(ALLOCMASK_SIGNATUREINDEX);
+
 		ctx.cntHash++;
 
 		// calculate starting position
@@ -1636,10 +2537,15 @@ struct database_t {
 	 * @return {number} signatureId
 	 */
 	inline unsigned addSignature(const char *name) {
-		signature_t *pSignature = this->signatures + this->numSignature++;
+		unsigned signatureId = this->numSignature++;
+
+		if (this->numSignature > this->maxSignature) {
+			if (!(growSections & allocFlags & ALLOCMASK_SIGNATURE))
+				ctx.fatal("\n{\"error\":\"storage full\",\"where\":\"%s:%s:%d\",\"maxSignature\":%u}\n", __FUNCTION__, __FILE__, __LINE__, this->maxSignature);
+			this->signatures = (signature_t *) growData("database_t::signatures", this->signatures, this->maxSignature, sizeof(*this->signatures));
+		}
 
-		if (this->numSignature > this->maxSignature)
-			ctx.fatal("\n{\"error\":\"storage full\",\"where\":\"%s:%s:%d\",\"maxSignature\":%u}\n", __FUNCTION__, __FILE__, __LINE__, this->maxSignature);
+		signature_t *pSignature = this->signatures + signatureId;
 
 		// clear before use
 		::memset(pSignature, 0, sizeof(*pSignature));
@@ -1667,6 +2573,9 @@ struct database_t {
 	 * @return {number} offset into index
 	 */
 	inline unsigned lookupSwap(const swap_t *pSwap) {
+		if (mustGrowIndex(ALLOCMASK_SWAPINDEX, numSwap, swapIndexSize))
+			growIndex(ALLOCMASK_SWAPINDEX);
+
 		ctx.cntHash++;
 
 		// calculate starting position
@@ -1707,8 +2616,11 @@ struct database_t {
 	inline unsigned addSwap(swap_t *pSwap) {
 		unsigned swapId = this->numSwap++;
 
-		if (this->numSwap > this->maxSwap)
-			ctx.fatal("\n{\"error\":\"storage full\",\"where\":\"%s:%s:%d\",\"maxSwap\":%u}\n", __FUNCTION__, __FILE__, __LINE__, this->maxSwap);
+		if (this->numSwap > this->maxSwap) {
+			if (!(growSections & allocFlags & ALLOCMASK_SWAP))
+				ctx.fatal("\n{\"error\":\"storage full\",\"where\":\"%s:%s:%d\",\"maxSwap\":%u}\n", __FUNCTION__, __FILE__, __LINE__, this->maxSwap);
+			this->swaps = (swap_t *) growData("database_t::swaps", this->swaps, this->maxSwap, sizeof(*this->swaps));
+		}
 
 		::memcpy(&this->swaps[swapId], pSwap, sizeof(*pSwap));
 
@@ -1732,6 +2644,9 @@ struct database_t {
 	 * @return {number} offset into index
 	 */
 	inline unsigned lookupHint(const hint_t *pHint) {
+		if (mustGrowIndex(ALLOCMASK_HINTINDEX, numHint, hintIndexSize))
+			growIndex(ALLOCMASK_HINTINDEX);
+
 		ctx.cntHash++;
 
 		// calculate starting position
@@ -1772,8 +2687,11 @@ struct database_t {
 	inline unsigned addHint(hint_t *pHint) {
 		unsigned hintId = this->numHint++;
 
-		if (this->numHint > this->maxHint)
-			ctx.fatal("\n{\"error\":\"storage full\",\"where\":\"%s:%s:%d\",\"maxHint\":%u}\n", __FUNCTION__, __FILE__, __LINE__, this->maxHint);
+		if (this->numHint > this->maxHint) {
+			if (!(growSections & allocFlags & ALLOCMASK_HINT))
+				ctx.fatal("\n{\"error\":\"storage full\",\"where\":\"%s:%s:%d\",\"maxHint\":%u}\n", __FUNCTION__, __FILE__, __LINE__, this->maxHint);
+			this->hints = (hint_t *) growData("database_t::hints", this->hints, this->maxHint, sizeof(*this->hints));
+		}
 
 		::memcpy(&this->hints[hintId], pHint, sizeof(*pHint));
 
@@ -1797,12 +2715,38 @@ struct database_t {
 	 * @return {number} offset into index
 	 */
 	inline unsigned lookupImprint(const footprint_t &v) const {
+		return lookupImprint(v, v.crc32());
+	}
 
-		ctx.cntHash++;
+	/**
+	 * @date 2026-10-17 22:17:50
+	 *
+	 * `lookupImprint()` with the footprint crc already calculated for `testImprintFilter()`
+	 *
+	 * @param v {footprint_t} v - key value
+	 * @param {number} crc - `v.crc32()`
+	 * @return {number} offset into index
+	 */
+	inline unsigned lookupImprint(const footprint_t &v, unsigned crc) const {
+		return lookupImprint(v, crc, ctx.cntHash, ctx.cntCompare);
+	}
 
-		// starting position
-		unsigned crc = v.crc32();
+	/**
+	 * @date 2026-10-17 23:12:40
+	 *
+	 * `lookupImprint()` with caller supplied statistics, concurrent readers must not share `ctx.cntHash`/`ctx.cntCompare`
+	 *
+	 * @param v {footprint_t} v - key value
+	 * @param {number} crc - `v.crc32()`
+	 * @param {number} cntHash - (modified) number of lookups
+	 * @param {number} cntCompare - (modified) number of index probes
+	 * @return {number} offset into index
+	 */
+	inline unsigned lookupImprint(const footprint_t &v, unsigned crc, uint64_t &cntHash, uint64_t &cntCompare) const {
+
+		cntHash++;
 
+		// starting position
 		unsigned ix = crc % imprintIndexSize;
 
 		// increment when overflowing
@@ -1814,7 +2758,7 @@ struct database_t {
 
 		if (imprintVersion == NULL) {
 			for (;;) {
-				ctx.cntCompare++;
+				cntCompare++;
 				if (this->imprintIndex[ix] == 0)
 					return ix; // "not-found"
 
@@ -1831,7 +2775,7 @@ struct database_t {
 			}
 		} else {
 			for (;;) {
-				ctx.cntCompare++;
+				cntCompare++;
 				if (this->imprintVersion[ix] != iVersion)
 					return ix; // "not-found"
 
@@ -1858,17 +2802,315 @@ struct database_t {
 	 * @return {number} imprintId
 	 */
 	inline unsigned addImprint(const footprint_t &v) {
-		imprint_t *pImprint = this->imprints + this->numImprint++;
+		unsigned imprintId = this->numImprint++;
+
+		if (this->numImprint > this->maxImprint) {
+			if (!(growSections & allocFlags & ALLOCMASK_IMPRINT))
+				ctx.fatal("\n{\"error\":\"storage full\",\"where\":\"%s:%s:%d\",\"maxImprint\":%u}\n", __FUNCTION__, __FILE__, __LINE__, this->maxImprint);
+			this->imprints = (imprint_t *) growData("database_t::imprints", this->imprints, this->maxImprint, sizeof(*this->imprints));
+		}
 
-		if (this->numImprint > this->maxImprint)
-			ctx.fatal("\n{\"error\":\"storage full\",\"where\":\"%s:%s:%d\",\"maxImprint\":%u}\n", __FUNCTION__, __FILE__, __LINE__, this->maxImprint);
+		imprint_t *pImprint = this->imprints + imprintId;
 
 		// only populate key fields
 		pImprint->footprint = v;
 
+		addImprintFilter(v.crc32());
+		addImprintInvariant(v);
+
 		return (unsigned) (pImprint - this->imprints);
 	}
 
+	/**
+	 * @date 2026-10-17 22:17:50
+	 *
+	 * Imprint filter
+	 *
+	 * Associative lookups probe `imprintIndex` for every row or column and nearly all probes miss.
+	 * The filter is a blocked bloom filter over footprint crc's, one 64-bit word per key with 4 bits set.
+	 * With 2 bits per index entry it is 1/16th the size of the index and a probe touches a single word.
+	 * Only filter hits need to probe the index.
+	 *
+	 * Bits are never removed. After clearing or versioning `imprintIndex` stale bits only result in extra index probes.
+	 */
+
+	/**
+	 * @date 2026-10-17 22:17:50
+	 *
+	 * Size of imprint filter in words
+	 *
+	 * @param {number} indexSize - imprint index size
+	 * @return {number} number of 64-bit words
+	 */
+	static inline uint32_t imprintFilterSizeFor(uint32_t indexSize) {
+		return indexSize / DATABASE_FILTERRATIO + 1;
+	}
+
+	/**
+	 * @date 2026-10-17 22:17:50
+	 *
+	 * Word and bits of filter for footprint crc
+	 *
+	 * @param {number} crc - `footprint_t::crc32()`
+	 * @param {number} pMask - (output) bits to test/set
+	 * @return {number} word offset
+	 */
+	inline uint32_t imprintFilterWord(uint32_t crc, uint64_t *pMask) const {
+		// spread crc over 64 bits for bit positions, high crc bits select the word
+		uint64_t h = crc * 0x9e3779b97f4a7c15ULL;
+
+		*pMask = (1ULL << (h >> 58)) | (1ULL << ((h >> 52) & 63)) | (1ULL << ((h >> 46) & 63)) | (1ULL << ((h >> 40) & 63));
+		return ((uint64_t) crc * imprintFilterSize) >> 32;
+	}
+
+	/**
+	 * @date 2026-10-17 22:17:50
+	 *
+	 * Test if a footprint might be present in `imprintIndex`
+	 *
+	 * @param {number} crc - `footprint_t::crc32()`
+	 * @return {boolean} `false` if definitely not present
+	 */
+	inline bool testImprintFilter(uint32_t crc) const {
+		if (!this->imprintFilter)
+			return true;
+
+		uint64_t mask;
+		uint32_t ix = imprintFilterWord(crc, &mask);
+
+		return (this->imprintFilter[ix] & mask) == mask;
+	}
+
+	/**
+	 * @date 2026-10-17 22:17:50
+	 *
+	 * Add footprint to filter
+	 *
+	 * @param {number} crc - `footprint_t::crc32()`
+	 */
+	inline void addImprintFilter(uint32_t crc) {
+		if (!this->imprintFilter)
+			return;
+
+		uint64_t mask;
+		uint32_t ix = imprintFilterWord(crc, &mask);
+
+		this->imprintFilter[ix] |= mask;
+	}
+
+	/**
+	 * @date 2026-10-17 22:17:50
+	 *
+	 * Clear filter, call when `imprintIndex` is cleared
+	 */
+	inline void clearImprintFilter(void) {
+		if (this->imprintFilter)
+			::memset(this->imprintFilter, 0, this->imprintFilterSize * sizeof(*this->imprintFilter));
+	}
+
+	/**
+	 * @date 2026-10-17 22:17:50
+	 *
+	 * Rebuild filter from imprints
+	 */
+	void rebuildImprintFilter(void) {
+		clearImprintFilter();
+
+		for (unsigned iImprint = 1; iImprint < this->numImprint; iImprint++)
+			addImprintFilter(this->imprints[iImprint].footprint.crc32());
+	}
+
+	/**
+	 * @date 2026-10-17 22:46:12
+	 *
+	 * Imprint invariants
+	 *
+	 * Associative lookups find the orientation by brute force, evaluating every row of the evaluator.
+	 * Reordering variables does not change the number of minterms of a footprint,
+	 * it permutes the cofactor weights (minterms with variable set) the same way it permutes the variables.
+	 * A row can only match an imprint if the candidate weights, permuted by that row,
+	 * equal the weights of a stored imprint.
+	 * That test needs no evaluation, only `MAXSLOTS` table lookups of the precomputed row permutation.
+	 *
+	 * Weight vectors are hashed into a single bit filter which is grown on demand.
+	 * Like `imprintFilter` bits are never removed and false positives only cost an evaluation.
+	 * The filter is in-memory only and enabled with `enableImprintInvariant()`.
+	 */
+
+	/**
+	 * @date 2026-10-17 22:46:12
+	 *
+	 * Cofactor weights of a footprint
+	 *
+	 * @param {footprint_t} v - footprint
+	 * @param {footprint_t[]} pVariables - footprints of variables with identity transform
+	 * @param {number[]} pWeights - (output) `MAXSLOTS` cofactor weights followed by number of minterms
+	 */
+	static inline void imprintInvariantWeights(const footprint_t &v, const footprint_t *pVariables, unsigned *pWeights) {
+		unsigned cnt = 0;
+
+		for (unsigned j = 0; j < footprint_t::QUADPERFOOTPRINT; j++)
+			cnt += __builtin_popcountll(v.bits[j]);
+		pWeights[MAXSLOTS] = cnt;
+
+		for (unsigned k = 0; k < MAXSLOTS; k++) {
+			cnt = 0;
+			for (unsigned j = 0; j < footprint_t::QUADPERFOOTPRINT; j++)
+				cnt += __builtin_popcountll(v.bits[j] & pVariables[k].bits[j]);
+			pWeights[k] = cnt;
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 22:46:12
+	 *
+	 * Filter bit of permuted weights.
+	 * The hash is linear so permuting weights only permutes the multipliers.
+	 *
+	 * @param {number[]} pWeights - weights from `imprintInvariantWeights()`
+	 * @param {number[]} pMap - variable permutation, weight of endpoint `k` moves to variable `pMap[k]`
+	 * @return {number} bit offset
+	 */
+	inline uint64_t imprintInvariantBit(const unsigned *pWeights, const uint8_t *pMap) const {
+		uint64_t h = imprintInvariantSeed[MAXSLOTS] * pWeights[MAXSLOTS];
+
+		for (unsigned k = 0; k < MAXSLOTS; k++)
+			h += imprintInvariantSeed[pMap[k]] * pWeights[k];
+
+		return (h * 0x9e3779b97f4a7c15ULL) >> (64 - imprintInvariantLog);
+	}
+
+	/**
+	 * @date 2026-10-17 22:46:12
+	 *
+	 * Test if evaluator row could match a stored imprint
+	 *
+	 * @param {number[]} pWeights - candidate weights from `prepareImprintInvariant()`
+	 * @param {number} iRow - associative row as scanned by `lookupImprintAssociativeCompact()`
+	 * @return {boolean} `false` if row definitely does not match
+	 */
+	inline bool testImprintInvariant(const unsigned *pWeights, unsigned iRow) const {
+		uint64_t bit = imprintInvariantBit(pWeights, this->imprintInvariantMap + iRow * MAXSLOTS);
+
+		return (this->imprintInvariant[bit >> 6] >> (bit & 63)) & 1;
+	}
+
+	/**
+	 * @date 2026-10-17 22:46:12
+	 *
+	 * Evaluate candidate with identity transform and calculate weights
+	 *
+	 * @param {tinyTree_t} pTree - Tree containg expression
+	 * @param {footprint_t[]} pEvaluator - evaluator, first row must be the identity transform (modified)
+	 * @param {number[]} pWeights - (output) `MAXSLOTS+1` weights
+	 * @return {boolean} `false` if invariants are disabled or stale
+	 */
+	inline bool prepareImprintInvariant(const tinyTree_t *pTree, footprint_t *pEvaluator, unsigned *pWeights) const {
+		if (!this->imprintInvariant || this->imprintInvariantInterleave != this->interleave || this->imprintInvariantStep != this->interleaveStep)
+			return false;
+
+		pTree->eval(pEvaluator);
+		imprintInvariantWeights(pEvaluator[pTree->root], pEvaluator + tinyTree_t::TINYTREE_KSTART, pWeights);
+		return true;
+	}
+
+	/**
+	 * @date 2026-10-17 22:46:12
+	 *
+	 * Add weights of imprint to filter, grow when too dense
+	 *
+	 * @param {footprint_t} v - imprint footprint
+	 */
+	inline void addImprintInvariant(const footprint_t &v) {
+		if (!this->imprintInvariant)
+			return;
+
+		if ((uint64_t) this->numImprint * 8 > (1ULL << this->imprintInvariantLog)) {
+			// rebuild includes `v`
+			ctx.myFree("database_t::imprintInvariant", imprintInvariant);
+			imprintInvariantLog++;
+			imprintInvariant = (uint64_t *) ctx.myAlloc("database_t::imprintInvariant", (1ULL << imprintInvariantLog) / 64, sizeof(*imprintInvariant));
+			rebuildImprintInvariant();
+			return;
+		}
+
+		unsigned weights[MAXSLOTS + 1];
+
+		imprintInvariantWeights(v, this->fwdEvaluator + tinyTree_t::TINYTREE_KSTART, weights);
+
+		// first row is the identity transform
+		uint64_t bit = imprintInvariantBit(weights, this->imprintInvariantMap);
+		this->imprintInvariant[bit >> 6] |= 1ULL << (bit & 63);
+	}
+
+	/**
+	 * @date 2026-10-17 22:46:12
+	 *
+	 * Rebuild row map for current interleave and refill filter from imprints
+	 */
+	void rebuildImprintInvariant(void) {
+		unsigned          numRow     = numAssociativeRow();
+		const footprint_t *pIdentity = this->fwdEvaluator + tinyTree_t::TINYTREE_KSTART;
+
+		if (this->imprintInvariantInterleave != this->interleave || this->imprintInvariantStep != this->interleaveStep) {
+			if (imprintInvariantMap)
+				ctx.myFree("database_t::imprintInvariantMap", imprintInvariantMap);
+			imprintInvariantMap = (uint8_t *) ctx.myAlloc("database_t::imprintInvariantMap", numRow, MAXSLOTS);
+
+			// which variable lands where for rows scanned by `lookupImprintAssociative()`
+			for (unsigned iRow = 0; iRow < numRow; iRow++) {
+				const footprint_t *pRow;
+
+				if (this->interleave == this->interleaveStep)
+					pRow = this->revEvaluator + iRow * this->interleaveStep * tinyTree_t::TINYTREE_NEND + tinyTree_t::TINYTREE_KSTART;
+				else
+					pRow = this->fwdEvaluator + iRow * tinyTree_t::TINYTREE_NEND + tinyTree_t::TINYTREE_KSTART;
+
+				for (unsigned j = 0; j < MAXSLOTS; j++) {
+					unsigned k = 0;
+					while (k < MAXSLOTS && !pRow[j].equals(pIdentity[k]))
+						k++;
+					if (k >= MAXSLOTS)
+						ctx.fatal("\n{\"error\":\"evaluator row is not a permutation\",\"where\":\"%s:%s:%d\",\"row\":%u}\n",
+							  __FUNCTION__, __FILE__, __LINE__, iRow);
+					imprintInvariantMap[iRow * MAXSLOTS + j] = k;
+				}
+			}
+
+			this->imprintInvariantInterleave = this->interleave;
+			this->imprintInvariantStep       = this->interleaveStep;
+		}
+
+		::memset(imprintInvariant, 0, (1ULL << imprintInvariantLog) / 64 * sizeof(*imprintInvariant));
+
+		unsigned weights[MAXSLOTS + 1];
+
+		for (unsigned iImprint = 1; iImprint < this->numImprint; iImprint++) {
+			imprintInvariantWeights(this->imprints[iImprint].footprint, pIdentity, weights);
+
+			// first row is the identity transform
+			uint64_t bit = imprintInvariantBit(weights, this->imprintInvariantMap);
+			this->imprintInvariant[bit >> 6] |= 1ULL << (bit & 63);
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 22:46:12
+	 *
+	 * Enable invariant pruning of associative lookups.
+	 * Call again after `interleave` changed.
+	 */
+	void enableImprintInvariant(void) {
+		if (!imprintInvariant) {
+			imprintInvariantLog = 16;
+			while ((uint64_t) this->numImprint * 8 > (1ULL << imprintInvariantLog))
+				imprintInvariantLog++;
+			imprintInvariant = (uint64_t *) ctx.myAlloc("database_t::imprintInvariant", (1ULL << imprintInvariantLog) / 64, sizeof(*imprintInvariant));
+		}
+
+		rebuildImprintInvariant();
+	}
+
 	/*
 	 * @date 2020-03-17 18:16:51
 	 *
@@ -1897,12 +3139,18 @@ struct database_t {
 	 * @return {boolean} - `true` if found, `false` if not.
 	 */
 	inline bool lookupImprintAssociative(const tinyTree_t *pTree, footprint_t *pFwdEvaluator, footprint_t *pRevEvaluator, unsigned *sid, unsigned *tid) {
+		PERFTIMER(PERF_LOOKUPIMPRINT);
+
 		/*
 		 * According to `performSelfTestInterleave` the following is true:
 	         *   fwdTransform[row + col] == fwdTransform[row][fwdTransform[col]]
 	         *   revTransform[row][fwdTransform[row + col]] == fwdTransform[col]
 		 */
 
+		// rows that can not map candidate weights onto an imprint are skipped without evaluating
+		unsigned weights[MAXSLOTS + 1];
+		bool     invariant = prepareImprintInvariant(pTree, this->interleave == this->interleaveStep ? pRevEvaluator : pFwdEvaluator, weights);
+
 		if (this->interleave == this->interleaveStep) {
 			/*
 			 * index is populated with key cols, runtime scans rows
@@ -1910,7 +3158,10 @@ struct database_t {
 			 */
 
 			// permutate all rows
-			for (unsigned iRow = 0; iRow < MAXTRANSFORM; iRow += this->interleaveStep) {
+			for (unsigned iRow = 0, iMap = 0; iRow < MAXTRANSFORM; iRow += this->interleaveStep, iMap++) {
+
+				if (invariant && !testImprintInvariant(weights, iMap))
+					continue;
 
 				// find where the evaluator for the key is located in the evaluator store
 				footprint_t *v = pRevEvaluator + iRow * tinyTree_t::TINYTREE_NEND;
@@ -1918,8 +3169,13 @@ struct database_t {
 				// apply the reverse transform
 				pTree->eval(v);
 
+				// most rows miss, consult the filter before the index
+				unsigned crc = v[pTree->root].crc32();
+				if (!this->testImprintFilter(crc))
+					continue;
+
 				// search the resulting footprint in the cache/index
-				unsigned ix = this->lookupImprint(v[pTree->root]);
+				unsigned ix = this->lookupImprint(v[pTree->root], crc);
 
 				/*
 				 * Was something found
@@ -1947,11 +3203,23 @@ struct database_t {
 			// permutate all colums
 			for (unsigned iCol = 0; iCol < interleaveStep; iCol++) {
 
+				if (invariant && !testImprintInvariant(weights, iCol)) {
+					v += tinyTree_t::TINYTREE_NEND;
+					continue;
+				}
+
 				// apply the tree to the store
 				pTree->eval(v);
 
+				// most columns miss, consult the filter before the index
+				unsigned crc = v[pTree->root].crc32();
+				if (!this->testImprintFilter(crc)) {
+					v += tinyTree_t::TINYTREE_NEND;
+					continue;
+				}
+
 				// search the resulting footprint in the cache/index
-				unsigned ix = this->lookupImprint(v[pTree->root]);
+				unsigned ix = this->lookupImprint(v[pTree->root], crc);
 
 				/*
 				 * Was something found
@@ -1975,6 +3243,115 @@ struct database_t {
 		return false;
 	}
 
+	/**
+	 * @date 2026-10-17 14:31:09
+	 *
+	 * Number of evaluator rows scanned by `lookupImprintAssociative()`
+	 *
+	 * @return {number} rows
+	 */
+	inline unsigned numAssociativeRow(void) const {
+		if (this->interleave == this->interleaveStep)
+			return (MAXTRANSFORM + this->interleaveStep - 1) / this->interleaveStep;
+		else
+			return this->interleaveStep;
+	}
+
+	/**
+	 * @date 2026-10-17 14:33:45
+	 *
+	 * Copy the evaluator rows scanned by `lookupImprintAssociative()` into a private, compact evaluator.
+	 * `tinyTree_t::eval()` writes node results into the evaluator, so concurrent lookups each need their own.
+	 * Compact evaluators hold only `numAssociativeRow()` rows instead of `MAXTRANSFORM`.
+	 *
+	 * @param {footprint_t[]} pEvaluator - (output) `numAssociativeRow() * tinyTree_t::TINYTREE_NEND` footprints
+	 */
+	void copyAssociativeEvaluator(footprint_t *pEvaluator) const {
+		unsigned numRow = numAssociativeRow();
+
+		for (unsigned iRow = 0; iRow < numRow; iRow++) {
+			const footprint_t *pSrc;
+
+			if (this->interleave == this->interleaveStep)
+				pSrc = this->revEvaluator + iRow * this->interleaveStep * tinyTree_t::TINYTREE_NEND;
+			else
+				pSrc = this->fwdEvaluator + iRow * tinyTree_t::TINYTREE_NEND;
+
+			::memcpy(pEvaluator + iRow * tinyTree_t::TINYTREE_NEND, pSrc, tinyTree_t::TINYTREE_NEND * sizeof(*pEvaluator));
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 14:38:20
+	 *
+	 * `lookupImprintAssociative()` using a compact evaluator from `copyAssociativeEvaluator()`.
+	 * Does not modify the database and can be called concurrently as long as nothing is added.
+	 *
+	 * @param {tinyTree_t} pTree - Tree containg expression
+	 * @param {footprint_t[]} pEvaluator - Compact evaluator (modified)
+	 * @param {number} sid - found structure id
+	 * @param {number} tid - found transform id. what was queried can be reconstructed as `"sid/tid"`
+	 * @return {boolean} - `true` if found, `false` if not.
+	 */
+	inline bool lookupImprintAssociativeCompact(const tinyTree_t *pTree, footprint_t *pEvaluator, unsigned *sid, unsigned *tid) const {
+		return lookupImprintAssociativeCompact(pTree, pEvaluator, sid, tid, ctx.cntHash, ctx.cntCompare);
+	}
+
+	/**
+	 * @date 2026-10-17 23:14:05
+	 *
+	 * `lookupImprintAssociativeCompact()` with private statistics for concurrent callers.
+	 * Callers merge `cntHash`/`cntCompare` into `ctx` once the workers are idle.
+	 *
+	 * @param {tinyTree_t} pTree - Tree containg expression
+	 * @param {footprint_t[]} pEvaluator - Compact evaluator (modified)
+	 * @param {number} sid - found structure id
+	 * @param {number} tid - found transform id
+	 * @param {number} cntHash - (modified) number of lookups
+	 * @param {number} cntCompare - (modified) number of index probes
+	 * @return {boolean} - `true` if found, `false` if not.
+	 */
+	inline bool lookupImprintAssociativeCompact(const tinyTree_t *pTree, footprint_t *pEvaluator, unsigned *sid, unsigned *tid, uint64_t &cntHash, uint64_t &cntCompare) const {
+		PERFTIMER(PERF_LOOKUPIMPRINT);
+
+		unsigned    numRow = numAssociativeRow();
+		footprint_t *v     = pEvaluator;
+
+		// rows that can not map candidate weights onto an imprint are skipped without evaluating
+		unsigned weights[MAXSLOTS + 1];
+		bool     invariant = prepareImprintInvariant(pTree, pEvaluator, weights);
+
+		for (unsigned iRow = 0; iRow < numRow; iRow++, v += tinyTree_t::TINYTREE_NEND) {
+
+			if (invariant && !testImprintInvariant(weights, iRow))
+				continue;
+
+			// apply the tree to the store
+			pTree->eval(v);
+
+			// most rows miss, consult the filter before the index
+			unsigned crc = v[pTree->root].crc32();
+			if (!this->testImprintFilter(crc))
+				continue;
+
+			// search the resulting footprint in the cache/index
+			unsigned ix = this->lookupImprint(v[pTree->root], crc, cntHash, cntCompare);
+
+			if ((this->imprintVersion == NULL || this->imprintVersion[ix] == iVersion) && this->imprintIndex[ix] != 0) {
+				const imprint_t *pImprint = this->imprints + this->imprintIndex[ix];
+				*sid = pImprint->sid;
+
+				if (this->interleave == this->interleaveStep)
+					*tid = pImprint->tid + iRow * this->interleaveStep;
+				else
+					*tid = this->revTransformIds[pImprint->tid + iRow];
+				return true;
+			}
+		}
+
+		return false;
+	}
+
 	/**
 	 * @date 2020-03-16 21:46:02
 	 *
@@ -2012,6 +3389,10 @@ struct database_t {
 	 * @return {number} - zero for succeed, otherwise tree is already present with sid as return value.
 	 */
 	inline unsigned addImprintAssociative(const tinyTree_t *pTree, footprint_t *pFwdEvaluator, footprint_t *pRevEvaluator, unsigned sid) {
+		// grow here, `lookupImprint()` is also called concurrently by readers
+		if (mustGrowIndex(ALLOCMASK_IMPRINTINDEX, (uint64_t) this->numImprint + this->interleave, this->imprintIndexSize))
+			growIndex(ALLOCMASK_IMPRINTINDEX);
+
 		/*
 		 * According to `performSelfTestInterleave` the following is true:
 	         *   fwdTransform[row + col] == fwdTransform[row][fwdTransform[col]]
@@ -2105,6 +3486,112 @@ struct database_t {
 		return 0;
 	}
 
+	/**
+	 * @date 2026-10-17 21:58:12
+	 *
+	 * Number of evaluator rows used by `addImprintAssociative()`, the complement of `numAssociativeRow()`
+	 *
+	 * @return {number} rows
+	 */
+	inline unsigned numImprintRow(void) const {
+		if (this->interleave == this->interleaveStep)
+			return this->interleaveStep;
+		else
+			return (MAXTRANSFORM + this->interleaveStep - 1) / this->interleaveStep;
+	}
+
+	/**
+	 * @date 2026-10-17 21:58:12
+	 *
+	 * Copy the evaluator rows used by `addImprintAssociative()` into a private, compact evaluator.
+	 *
+	 * @param {footprint_t[]} pEvaluator - (output) `numImprintRow() * tinyTree_t::TINYTREE_NEND` footprints
+	 */
+	void copyImprintEvaluator(footprint_t *pEvaluator) const {
+		unsigned numRow = numImprintRow();
+
+		for (unsigned iRow = 0; iRow < numRow; iRow++) {
+			const footprint_t *pSrc;
+
+			if (this->interleave == this->interleaveStep)
+				pSrc = this->fwdEvaluator + iRow * tinyTree_t::TINYTREE_NEND;
+			else
+				pSrc = this->revEvaluator + iRow * this->interleaveStep * tinyTree_t::TINYTREE_NEND;
+
+			::memcpy(pEvaluator + iRow * tinyTree_t::TINYTREE_NEND, pSrc, tinyTree_t::TINYTREE_NEND * sizeof(*pEvaluator));
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 21:58:12
+	 *
+	 * Evaluate the footprints `addImprintAssociative()` would store, without touching the database.
+	 * Can be called concurrently, each with its own evaluator from `copyImprintEvaluator()`.
+	 *
+	 * @param {tinyTree_t} pTree - Tree containg expression
+	 * @param {footprint_t[]} pEvaluator - Compact evaluator (modified)
+	 * @param {footprint_t[]} pRows - (output) `numImprintRow()` footprints
+	 */
+	inline void evalImprintRows(const tinyTree_t *pTree, footprint_t *pEvaluator, footprint_t *pRows) const {
+		unsigned    numRow = numImprintRow();
+		footprint_t *v     = pEvaluator;
+
+		for (unsigned iRow = 0; iRow < numRow; iRow++) {
+			pTree->eval(v);
+			pRows[iRow] = v[pTree->root];
+			v += tinyTree_t::TINYTREE_NEND;
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 21:58:12
+	 *
+	 * `addImprintAssociative()` for footprints already evaluated by `evalImprintRows()`
+	 *
+	 * @param {footprint_t[]} pRows - `numImprintRow()` footprints
+	 * @param {number} sid - structure id to attach to imprints.
+	 * @return {number} - zero for succeed, otherwise tree is already present with sid as return value.
+	 */
+	inline unsigned addImprintRows(const footprint_t *pRows, unsigned sid) {
+		if (mustGrowIndex(ALLOCMASK_IMPRINTINDEX, (uint64_t) this->numImprint + this->interleave, this->imprintIndexSize))
+			growIndex(ALLOCMASK_IMPRINTINDEX);
+
+		unsigned numRow = numImprintRow();
+
+		for (unsigned iRow = 0; iRow < numRow; iRow++) {
+			// same tid as `addImprintAssociative()`
+			unsigned tid = (this->interleave == this->interleaveStep) ? iRow : iRow * this->interleaveStep;
+
+			// search the resulting footprint in the cache/index
+			unsigned ix = this->lookupImprint(pRows[iRow]);
+
+			// add to the database is not there
+			if (this->imprintIndex[ix] == 0 || (this->imprintVersion != NULL && this->imprintVersion[ix] != iVersion)) {
+				this->imprintIndex[ix]           = this->addImprint(pRows[iRow]);
+				if (this->imprintVersion)
+					this->imprintVersion[ix] = iVersion;
+
+				imprint_t *pImprint = this->imprints + this->imprintIndex[ix];
+				// populate non-key fields
+				pImprint->sid = sid;
+				pImprint->tid = tid;
+			} else {
+				imprint_t *pImprint = this->imprints + this->imprintIndex[ix];
+				// test for similar. First imprint must be unique, others must have matching sid
+				if (iRow == 0) {
+					// signature already present, return found
+					return pImprint->sid;
+				} else if (pImprint->sid != sid) {
+					ctx.fatal("\n{\"error\":\"index entry already in use\",\"where\":\"%s:%s:%d\",\"newsid\":\"%u\",\"newtid\":\"%u\",\"oldsid\":\"%u\",\"oldtid\":\"%u\",\"newname\":\"%s\",\"newname\":\"%s\"}\n",
+						  __FUNCTION__, __FILE__, __LINE__, sid, tid, pImprint->sid, pImprint->tid, this->signatures[pImprint->sid].name, this->signatures[sid].name);
+				}
+			}
+		}
+
+		// return succeeded
+		return 0;
+	}
+
 	/*
 	 * Sid/Tid pair store
 	 */
@@ -2123,6 +3610,9 @@ struct database_t {
 	 * @return {number} offset into index
 	 */
 	inline unsigned lookupPair(uint32_t sidmid, uint32_t tid) {
+		if (mustGrowIndex(ALLOCMASK_PAIRINDEX, numPair, pairIndexSize))
+			growIndex(ALLOCMASK_PAIRINDEX);
+
 		ctx.cntHash++;
 
 		// calculate starting position
@@ -2164,8 +3654,11 @@ struct database_t {
 	inline unsigned addPair(uint32_t sid, uint32_t tid) {
 		unsigned pairId = this->numPair++;
 
-		if (this->numPair > this->maxPair)
-			ctx.fatal("\n{\"error\":\"storage full\",\"where\":\"%s:%s:%d\",\"maxPair\":%u}\n", __FUNCTION__, __FILE__, __LINE__, this->maxPair);
+		if (this->numPair > this->maxPair) {
+			if (!(growSections & allocFlags & ALLOCMASK_PAIR))
+				ctx.fatal("\n{\"error\":\"storage full\",\"where\":\"%s:%s:%d\",\"maxPair\":%u}\n", __FUNCTION__, __FILE__, __LINE__, this->maxPair);
+			this->pairs = (pair_t *) growData("database_t::pairs", this->pairs, this->maxPair, sizeof(*this->pairs));
+		}
 
 		this->pairs[pairId].sidmid = sid;
 		this->pairs[pairId].tid    = tid;
@@ -2188,6 +3681,9 @@ struct database_t {
 	 * @return {number} offset into index
 	 */
 	inline unsigned lookupMember(const char *name) {
+		if (mustGrowIndex(ALLOCMASK_MEMBERINDEX, numMember, memberIndexSize))
+			growIndex(ALLOCMASK_MEMBERINDEX);
+
 		ctx.cntHash++;
 
 		// calculate starting position
@@ -2228,10 +3724,15 @@ struct database_t {
 	 * @return {number} memberId
 	 */
 	inline unsigned addMember(const char *name) {
-		member_t *pMember = this->members + this->numMember++;
+		unsigned memberId = this->numMember++;
+
+		if (this->numMember > this->maxMember) {
+			if (!(growSections & allocFlags & ALLOCMASK_MEMBER))
+				ctx.fatal("\n{\"error\":\"storage full\",\"where\":\"%s:%s:%d\",\"maxMember\":%u}\n", __FUNCTION__, __FILE__, __LINE__, this->maxMember);
+			this->members = (member_t *) growData("database_t::members", this->members, this->maxMember, sizeof(*this->members));
+		}
 
-		if (this->numMember > this->maxMember)
-			ctx.fatal("\n{\"error\":\"storage full\",\"where\":\"%s:%s:%d\",\"maxMember\":%u}\n", __FUNCTION__, __FILE__, __LINE__, this->maxMember);
+		member_t *pMember = this->members + memberId;
 
 		// clear before use
 		::memset(pMember, 0, sizeof(*pMember));
@@ -2401,6 +3902,7 @@ struct database_t {
 		if (sections & ALLOCMASK_IMPRINTINDEX) {
 			// clear
 			::memset(this->imprintIndex, 0, this->imprintIndexSize * sizeof(*this->imprintIndex));
+			clearImprintFilter();
 
 			// rebuild
 			for (unsigned iImprint = 1; iImprint < this->numImprint; iImprint++) {
@@ -2428,9 +3930,11 @@ struct database_t {
 
 				const imprint_t *pImprint = this->imprints + iImprint;
 
-				unsigned ix = this->lookupImprint(pImprint->footprint);
+				unsigned crc = pImprint->footprint.crc32();
+				unsigned ix  = this->lookupImprint(pImprint->footprint, crc);
 				assert(this->imprintIndex[ix] == 0);
 				this->imprintIndex[ix] = iImprint;
+				addImprintFilter(crc);
 
 				ctx.progress++;
 			}
@@ -2527,7 +4031,7 @@ struct database_t {
 			fprintf(stderr, "[%s] Indices built\n", ctx.timeAsString());
 	}
 
-	char *sectionToText(unsigned sections, char *pBuffer = NULL) {
+	char *sectionToText(unsigned sections, char *pBuffer = NULL) const {
 		static char buffer[512];
 		if (pBuffer == NULL)
 			pBuffer = buffer;
@@ -2641,6 +4145,7 @@ struct database_t {
 		json_object_set_new_nocheck(jResult, "interleave", json_integer(this->interleave));
 		json_object_set_new_nocheck(jResult, "numImprint", json_integer(this->numImprint));
 		json_object_set_new_nocheck(jResult, "imprintIndexSize", json_integer(this->imprintIndexSize));
+		json_object_set_new_nocheck(jResult, "imprintFilterSize", json_integer(this->imprintFilterSize));
 		json_object_set_new_nocheck(jResult, "numPair", json_integer(this->numPair));
 		json_object_set_new_nocheck(jResult, "pairIndexSize", json_integer(this->pairIndexSize));
 		json_object_set_new_nocheck(jResult, "numMember", json_integer(this->numMember));
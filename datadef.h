@@ -67,15 +67,15 @@ struct footprint_t {
 		/*
 		 * @date 2020-04-14 21:22:52
 		 * Update to SIMD
+		 *
+		 * @date 2026-10-17 21:41:26
+		 * AVX2 only when the build targets it, so it can inline.
+		 * Dispatched at runtime it loses to the inlined SSE2 early exit, which `selftest` measures.
 		 */
 
-#if 0 && defined(__AVX2__)
-
-		const __m256i *L = (const __m256i *) this->bits;
-		const __m256i *R = (const __m256i *) rhs.bits;
+#if defined(__AVX2__)
 
-		if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(L[0], R[0])) != 0xffffffff) return false;
-		if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(L[1], R[1])) != 0xffffffff) return false;
+		return equalsAVX2(rhs);
 
 #elif defined(__SSE2__)
 
@@ -116,6 +116,102 @@ struct footprint_t {
 	 */
 	inline unsigned crc32(void) const {
 
+		/*
+		 * @date 2026-10-17 21:41:26
+		 * Prefer the folded version, the result is identical.
+		 * It has shorter latency, which is what an index probe waits on.
+		 */
+#if defined(__PCLMUL__) && defined(__SSE4_2__)
+		return crc32Folded();
+#else
+		if (hasFolded())
+			return crc32Folded();
+		return crc32Serial();
+#endif
+	}
+
+	/**
+	 * @date 2026-10-17 21:41:26
+	 *
+	 * Compare two prints using two 256 bit lanes.
+	 * Unaligned loads, `imprint_t` is only 16 byte aligned.
+	 * Exits after the first lane, because most probes differ in the low words and the second half is often another cache line.
+	 *
+	 * @param {footprint_t} rhs - right hand side of comparison
+	 * @return {boolean} `true` if same, `false` if different
+	 */
+	__attribute__((target("avx2")))
+	inline bool equalsAVX2(const struct footprint_t &rhs) const {
+		const __m256i *L = (const __m256i *) this->bits;
+		const __m256i *R = (const __m256i *) rhs.bits;
+
+		__m256i lo = _mm256_xor_si256(_mm256_loadu_si256(L + 0), _mm256_loadu_si256(R + 0));
+		if (!_mm256_testz_si256(lo, lo))
+			return false;
+
+		__m256i hi = _mm256_xor_si256(_mm256_loadu_si256(L + 1), _mm256_loadu_si256(R + 1));
+		return _mm256_testz_si256(hi, hi);
+	}
+
+	/**
+	 * @date 2026-10-17 21:41:26
+	 *
+	 * Test once if the cpu can run `crc32Folded()`
+	 *
+	 * @return {boolean} `true` if `pclmulqdq` and `crc32` are available
+	 */
+	static inline bool hasFolded(void) {
+		static const bool folded = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.2");
+		return folded;
+	}
+
+	/**
+	 * @date 2026-10-17 21:41:26
+	 *
+	 * Same value as `crc32Serial()`, but as four independent chains of two words.
+	 * The serial version is one long dependency chain of eight `crc32` instructions.
+	 * Less latency at the cost of some throughput, `selftest -v` shows both.
+	 *
+	 * crc is linear, so a chain can be moved over `n` trailing bytes by a carry-less multiply with
+	 * the bit-reflected `x^(8n-33) mod P` followed by a `crc32` reduction.
+	 * The folded result must stay bit-identical, because stored imprint indices depend on it.
+	 *
+	 * @return {number} - calculate crc
+	 */
+	__attribute__((target("pclmul,sse4.2")))
+	inline unsigned crc32Folded(void) const {
+		// NOTE: QUADPERFOOTPRINT tests
+		uint64_t crcA = 0, crcB = 0, crcC = 0, crcD = 0;
+
+		crcA = _mm_crc32_u64(crcA, this->bits[0]);
+		crcB = _mm_crc32_u64(crcB, this->bits[2]);
+		crcC = _mm_crc32_u64(crcC, this->bits[4]);
+		crcD = _mm_crc32_u64(crcD, this->bits[6]);
+		crcA = _mm_crc32_u64(crcA, this->bits[1]);
+		crcB = _mm_crc32_u64(crcB, this->bits[3]);
+		crcC = _mm_crc32_u64(crcC, this->bits[5]);
+		crcD = _mm_crc32_u64(crcD, this->bits[7]);
+
+		// move A over 48 bytes, B over 32 bytes and C over 16 bytes
+		const __m128i AB = _mm_set_epi64x(crcB, crcA);
+		const __m128i K48K32 = _mm_set_epi64x(0xba4fc28e, 0xddc0152b);
+		const __m128i K16 = _mm_cvtsi32_si128(0x493c7d27);
+
+		__m128i fold = _mm_xor_si128(_mm_clmulepi64_si128(AB, K48K32, 0x00), _mm_clmulepi64_si128(AB, K48K32, 0x11));
+		fold = _mm_xor_si128(fold, _mm_clmulepi64_si128(_mm_cvtsi64_si128(crcC), K16, 0x00));
+
+		return (uint32_t) _mm_crc32_u64(0, _mm_cvtsi128_si64(fold)) ^ (uint32_t) crcD;
+	}
+
+	/**
+	 * @date 2020-03-15 20:29:35
+	 *
+	 * Original single chain version of `crc32()`
+	 *
+	 * @return {number} - calculate crc
+	 */
+	inline unsigned crc32Serial(void) const {
+
 		// NOTE: QUADPERFOOTPRINT tests
 #if defined(__SSE4_2__)
 		uint32_t crc32 = 0;
@@ -79,6 +79,10 @@ struct dbtool_t : callable_t {
 	unsigned opt_maxSwap;
 	/// @var {number} size of member index WARNING: must be prime
 	unsigned opt_memberIndexSize;
+	/// @var {number} save output as block-compressed container
+	unsigned opt_compress;
+	/// @var {number} allow allocated sections to grow beyond their initial size
+	unsigned opt_grow;
 	/// @var {number} index/data ratio
 	double   opt_ratio;
 	/// @var {number} size of pair index WARNING: must be prime
@@ -87,6 +91,8 @@ struct dbtool_t : callable_t {
 	unsigned opt_signatureIndexSize;
 	/// @var {number} size of swap index WARNING: must be prime
 	unsigned opt_swapIndexSize;
+	/// @var {number} verify input section checksums on open with given number of threads, 0 to verify on first copy
+	unsigned opt_verify;
 
 	/// @var {number} "0" assume input is read-only, else input is copy-on-write.
 	unsigned copyOnWrite;
@@ -96,6 +102,14 @@ struct dbtool_t : callable_t {
 	unsigned rebuildSections;
 	// mmapped sections that are copy-on-write
 	unsigned inheritSections;
+	// input sections with verified checksum
+	unsigned verifiedSections;
+	// input sections shared with output being verified in background
+	unsigned verifyPending;
+	/// @var {pthread_t} background verification of shared sections
+	pthread_t verifyThread;
+	/// @var {database_t} input database of background verification
+	const database_t *pVerifyDatabase;
 
 	/**
 	 * Constructor
@@ -112,10 +126,13 @@ struct dbtool_t : callable_t {
 		opt_maxSignature       = 0;
 		opt_maxSwap            = 0;
 		opt_memberIndexSize    = 0;
+		opt_compress           = 0;
+		opt_grow               = 1;
 		opt_ratio              = METRICS_DEFAULT_RATIO / 10.0;
 		opt_pairIndexSize      = 0;
 		opt_signatureIndexSize = 0;
 		opt_swapIndexSize      = 0;
+		opt_verify             = 0;
 
 		copyOnWrite = 0;
 		inheritSections = database_t::ALLOCMASK_TRANSFORM |
@@ -128,6 +145,114 @@ struct dbtool_t : callable_t {
 				  database_t::ALLOCMASK_MEMBER | database_t::ALLOCMASK_MEMBERINDEX;
 		readOnlyMode = 0;
 		rebuildSections = 0;
+		verifiedSections = 0;
+		verifyPending = 0;
+		pVerifyDatabase = NULL;
+	}
+
+	/**
+	 * @date 2026-10-17 19:33:50
+	 *
+	 * Verify all input sections with `--verify`, otherwise postpone until a section is first copied or shared.
+	 *
+	 * @param {database_t} db - read-only input database
+	 */
+	void verifyDatabaseSections(const database_t &db) {
+		if (this->opt_verify) {
+			db.verifySections(~0U, this->opt_verify);
+			this->verifiedSections = ~0U;
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 19:33:50
+	 *
+	 * Lazy verification of a section about to be copied
+	 *
+	 * @param {database_t} db - read-only input database
+	 * @param {number} section - `ALLOCMASK_*`
+	 */
+	inline void touchSection(const database_t &db, unsigned section) {
+		if (!(this->verifiedSections & section)) {
+			db.verifySections(section, verifyThreads());
+			this->verifiedSections |= section;
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 23:41:07
+	 *
+	 * Number of threads for lazy verification, `--verify=<n>` or all processors
+	 *
+	 * @return {number} number of threads
+	 */
+	unsigned verifyThreads(void) const {
+		if (this->opt_verify)
+			return this->opt_verify;
+
+		long numCpu = ::sysconf(_SC_NPROCESSORS_ONLN);
+		return numCpu > 0 ? (unsigned) numCpu : 1;
+	}
+
+	/**
+	 * @date 2026-10-17 23:41:07
+	 *
+	 * pthread entry point for background verification
+	 */
+	static void *verifyEntry(void *arg) {
+		dbtool_t *pTool = (dbtool_t *) arg;
+		pTool->pVerifyDatabase->verifySections(pTool->verifyPending, pTool->verifyThreads());
+		return NULL;
+	}
+
+	/**
+	 * @date 2026-10-17 23:41:07
+	 *
+	 * Start verification of input sections that the output inherited or shares copy-on-write.
+	 * These are never copied and would otherwise go unchecked, while long runs probe them for hours.
+	 * Runs in background so verification overlaps rebuilding, `waitVerifySections()` must be called before lookups.
+	 *
+	 * @param {database_t} store - output database
+	 * @param {database_t} db - read-only input database
+	 */
+	void startVerifySections(const database_t &store, const database_t &db) {
+		unsigned shared = 0;
+
+		for (unsigned iFlag = 0; iFlag <= database_t::ALLOCFLAG_MEMBERINDEX; iFlag++) {
+			const void *pStoreData[DATABASE_MAXRANGE], *pData[DATABASE_MAXRANGE];
+			size_t     storeLength[DATABASE_MAXRANGE], length[DATABASE_MAXRANGE];
+
+			if (store.sectionRanges(iFlag, pStoreData, storeLength) && db.sectionRanges(iFlag, pData, length) && pStoreData[0] == pData[0])
+				shared |= 1 << iFlag;
+		}
+
+		shared &= db.fileHeader.crcSections & ~this->verifiedSections;
+		if (!shared)
+			return;
+
+		this->pVerifyDatabase = &db;
+		this->verifyPending   = shared;
+
+		int ret = pthread_create(&this->verifyThread, NULL, verifyEntry, this);
+		if (ret)
+			ctx.fatal("\n{\"error\":\"pthread_create() failed\",\"where\":\"%s:%s:%d\",\"return\":%d}\n",
+				  __FUNCTION__, __FILE__, __LINE__, ret);
+	}
+
+	/**
+	 * @date 2026-10-17 23:41:07
+	 *
+	 * Wait for `startVerifySections()`. A checksum mismatch is fatal from within the worker.
+	 */
+	void waitVerifySections(void) {
+		if (!this->verifyPending)
+			return;
+
+		pthread_join(this->verifyThread, NULL);
+
+		this->verifiedSections |= this->verifyPending;
+		this->verifyPending   = 0;
+		this->pVerifyDatabase = NULL;
 	}
 
 	/**
@@ -639,6 +764,24 @@ struct dbtool_t : callable_t {
 			ctx.fatal("--maxpair=%u needs to be at least %u\n", store.maxPair, db.numPair);
 		if (store.maxMember < db.numMember)
 			ctx.fatal("--maxmember=%u needs to be at least %u\n", store.maxMember, db.numMember);
+
+		/*
+		 * @date 2026-10-17 19:16:27
+		 *
+		 * Sizes are estimates, let allocated sections grow on demand instead of "storage full".
+		 * Only sections that are allocated by `create()` are affected, inherited sections stay as-is.
+		 */
+		if (this->opt_grow && !readOnlyMode)
+			store.growSections = database_t::ALLOCMASK_SIGNATURE | database_t::ALLOCMASK_SIGNATUREINDEX |
+					     database_t::ALLOCMASK_SWAP | database_t::ALLOCMASK_SWAPINDEX |
+					     database_t::ALLOCMASK_HINT | database_t::ALLOCMASK_HINTINDEX |
+					     database_t::ALLOCMASK_IMPRINT | database_t::ALLOCMASK_IMPRINTINDEX |
+					     database_t::ALLOCMASK_PAIR | database_t::ALLOCMASK_PAIRINDEX |
+					     database_t::ALLOCMASK_MEMBER | database_t::ALLOCMASK_MEMBERINDEX;
+		else
+			store.growSections = 0;
+
+		store.saveCompressed = this->opt_compress;
 	}
 
 	/**
@@ -739,6 +882,7 @@ struct dbtool_t : callable_t {
 				assert(store.maxSignature >= db.numSignature);
 				assert(store.allocFlags & database_t::ALLOCMASK_SIGNATURE);
 				store.numSignature = db.numSignature;
+				touchSection(db, database_t::ALLOCMASK_SIGNATURE);
 				::memcpy(store.signatures, db.signatures, store.numSignature * sizeof(*store.signatures));
 			}
 
@@ -765,6 +909,7 @@ struct dbtool_t : callable_t {
 				assert(store.signatureIndexSize == db.signatureIndexSize);
 				assert(store.allocFlags & database_t::ALLOCMASK_SIGNATUREINDEX);
 				store.signatureIndexSize = db.signatureIndexSize;
+				touchSection(db, database_t::ALLOCMASK_SIGNATUREINDEX);
 				::memcpy(store.signatureIndex, db.signatureIndex, store.signatureIndexSize * sizeof(*store.signatureIndex));
 			}
 		}
@@ -797,6 +942,7 @@ struct dbtool_t : callable_t {
 				assert(store.maxSwap >= db.numSwap);
 				assert(store.allocFlags & database_t::ALLOCMASK_SWAP);
 				store.numSwap = db.numSwap;
+				touchSection(db, database_t::ALLOCMASK_SWAP);
 				::memcpy(store.swaps, db.swaps, store.numSwap * sizeof(*store.swaps));
 			}
 
@@ -823,6 +969,7 @@ struct dbtool_t : callable_t {
 				assert(store.swapIndexSize == db.swapIndexSize);
 				assert(store.allocFlags & database_t::ALLOCMASK_SWAPINDEX);
 				store.swapIndexSize = db.swapIndexSize;
+				touchSection(db, database_t::ALLOCMASK_SWAPINDEX);
 				::memcpy(store.swapIndex, db.swapIndex, store.swapIndexSize * sizeof(*store.swapIndex));
 			}
 		}
@@ -855,6 +1002,7 @@ struct dbtool_t : callable_t {
 				assert(store.maxHint >= db.numHint);
 				assert(store.allocFlags & database_t::ALLOCMASK_HINT);
 				store.numHint = db.numHint;
+				touchSection(db, database_t::ALLOCMASK_HINT);
 				::memcpy(store.hints, db.hints, store.numHint * sizeof(*store.hints));
 			}
 
@@ -881,6 +1029,7 @@ struct dbtool_t : callable_t {
 				assert(store.hintIndexSize == db.hintIndexSize);
 				assert(store.allocFlags & database_t::ALLOCMASK_HINTINDEX);
 				store.hintIndexSize = db.hintIndexSize;
+				touchSection(db, database_t::ALLOCMASK_HINTINDEX);
 				::memcpy(store.hintIndex, db.hintIndex, store.hintIndexSize * sizeof(*store.hintIndex));
 			}
 		}
@@ -913,6 +1062,7 @@ struct dbtool_t : callable_t {
 				assert(store.maxImprint >= db.numImprint);
 				assert(store.allocFlags & database_t::ALLOCMASK_IMPRINT);
 				store.numImprint = db.numImprint;
+				touchSection(db, database_t::ALLOCMASK_IMPRINT);
 				::memcpy(store.imprints, db.imprints, store.numImprint * sizeof(*store.imprints));
 			}
 
@@ -921,6 +1071,8 @@ struct dbtool_t : callable_t {
 				assert(!(store.allocFlags & database_t::ALLOCMASK_IMPRINTINDEX));
 				store.imprintIndexSize = db.imprintIndexSize;
 				store.imprintIndex = db.imprintIndex;
+				store.imprintFilterSize = db.imprintFilterSize;
+				store.imprintFilter = db.imprintFilter;
 			} else if (rebuildSections & database_t::ALLOCMASK_IMPRINTINDEX) {
 				// post-processing
 				assert(store.allocFlags & database_t::ALLOCMASK_IMPRINTINDEX);
@@ -928,18 +1080,28 @@ struct dbtool_t : callable_t {
 				// was missing
 				assert(store.allocFlags & database_t::ALLOCMASK_IMPRINTINDEX);
 				::memset(store.imprintIndex, 0, store.imprintIndexSize * sizeof(*store.imprintIndex));
+				store.clearImprintFilter();
 			} else if (copyOnWrite) {
 				// copy-on-write
 				assert(store.imprintIndexSize == db.imprintIndexSize);
 				assert(!(store.allocFlags & database_t::ALLOCMASK_IMPRINTINDEX));
 				store.imprintIndex = db.imprintIndex;
 				store.imprintIndexSize = db.imprintIndexSize;
+				store.imprintFilter = db.imprintFilter;
+				store.imprintFilterSize = db.imprintFilterSize;
 			} else {
 				// copy
 				assert(store.imprintIndexSize == db.imprintIndexSize);
 				assert(store.allocFlags & database_t::ALLOCMASK_IMPRINTINDEX);
 				store.imprintIndexSize = db.imprintIndexSize;
+				touchSection(db, database_t::ALLOCMASK_IMPRINTINDEX);
 				::memcpy(store.imprintIndex, db.imprintIndex, store.imprintIndexSize * sizeof(*store.imprintIndex));
+
+				// filter is sized to index
+				if (db.imprintFilterSize == store.imprintFilterSize)
+					::memcpy(store.imprintFilter, db.imprintFilter, store.imprintFilterSize * sizeof(*store.imprintFilter));
+				else
+					store.rebuildImprintFilter();
 			}
 		}
 
@@ -971,6 +1133,7 @@ struct dbtool_t : callable_t {
 				assert(store.maxPair >= db.numPair);
 				assert(store.allocFlags & database_t::ALLOCMASK_PAIR);
 				store.numPair = db.numPair;
+				touchSection(db, database_t::ALLOCMASK_PAIR);
 				::memcpy(store.pairs, db.pairs, store.numPair * sizeof(*store.pairs));
 			}
 
@@ -997,6 +1160,7 @@ struct dbtool_t : callable_t {
 				assert(store.pairIndexSize == db.pairIndexSize);
 				assert(store.allocFlags & database_t::ALLOCMASK_PAIRINDEX);
 				store.pairIndexSize = db.pairIndexSize;
+				touchSection(db, database_t::ALLOCMASK_PAIRINDEX);
 				::memcpy(store.pairIndex, db.pairIndex, store.pairIndexSize * sizeof(*store.pairIndex));
 			}
 		}
@@ -1029,6 +1193,7 @@ struct dbtool_t : callable_t {
 				assert(store.maxMember >= db.numMember);
 				assert(store.allocFlags & database_t::ALLOCMASK_MEMBER);
 				store.numMember = db.numMember;
+				touchSection(db, database_t::ALLOCMASK_MEMBER);
 				::memcpy(store.members, db.members, store.numMember * sizeof(*store.members));
 			}
 
@@ -1055,9 +1220,16 @@ struct dbtool_t : callable_t {
 				assert(store.memberIndexSize == db.memberIndexSize);
 				assert(store.allocFlags & database_t::ALLOCMASK_MEMBERINDEX);
 				store.memberIndexSize = db.memberIndexSize;
+				touchSection(db, database_t::ALLOCMASK_MEMBERINDEX);
 				::memcpy(store.memberIndex, db.memberIndex, store.memberIndexSize * sizeof(*store.memberIndex));
 			}
 		}
+
+		/*
+		 * Inherited and copy-on-write sections are never copied, verify them in background
+		 */
+
+		startVerifySections(store, db);
 	}
 };
 
@@ -0,0 +1,340 @@
+#ifndef _DECORSORT_H
+#define _DECORSORT_H
+
+/*
+ * @date 2026-10-17 18:30:14
+ *
+ * `decorsort.h` decorate-sort-undecorate for database sections.
+ *
+ * Comparators for members and signatures parse both names for every comparison,
+ * which is O(n log n) string parses for millions of entries.
+ *
+ * Instead, a 64-bit sort key is calculated once per element, in parallel.
+ * Only elements with identical keys need the (expensive) tie comparator.
+ * Decorated entries are sorted per thread with `qsort_r()`, sorted runs are merged pairwise in parallel.
+ * Finally the section is permuted once.
+ *
+ * Equal elements are ordered by their original position, making the result independent of the number of threads.
+ *
+ * Flow:
+ *
+ *   decorate:   entry[i] = { keyFn(data[i]), i }          per thread range
+ *   sort:       qsort_r(range)                             per thread range
+ *   merge:      runs of 1,2,4... ranges                    one thread per pair
+ *   undecorate: data[i] = copy[entry[i].index]
+ */
+
+/*
+ *	This file is part of Untangle, Information in fractal structures.
+ *	Copyright (C) 2017-2026, xyzzy@rockingship.org
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "context.h"
+
+/**
+ * @date 2026-10-17 18:31:40
+ *
+ * Parallel decorated sort
+ *
+ * @typedef {object} decoratedSort_t
+ */
+struct decoratedSort_t {
+
+	/**
+	 * Decorated element
+	 */
+	struct entry_t {
+		/// @var {number} packed sort key
+		uint64_t key;
+		/// @var {number} original position
+		uint32_t index;
+	};
+
+	/**
+	 * @param {object} pElement - element to decorate
+	 * @param {object} arg - caller context
+	 * @return {number} sort key, called concurrently
+	 */
+	typedef uint64_t (*keyFn_t)(const void *pElement, void *arg);
+
+	/**
+	 * @param {object} lhs - left hand side element
+	 * @param {object} rhs - right hand side element
+	 * @param {object} arg - caller context
+	 * @return "<0" if "L<R", "0" if "L==R", ">0" if "L>R", called concurrently for elements with equal keys
+	 */
+	typedef int (*tieFn_t)(const void *lhs, const void *rhs, void *arg);
+
+	/**
+	 * Worker thread context
+	 */
+	struct worker_t {
+		/// @var {decoratedSort_t} owner
+		decoratedSort_t *pSort;
+		/// @var {pthread_t} thread handle
+		pthread_t       thread;
+		/// @var {number} first entry of (left) range
+		unsigned        lo;
+		/// @var {number} end of left range and start of right range when merging
+		unsigned        mid;
+		/// @var {number} end of (right) range
+		unsigned        hi;
+	};
+
+	/// @var {context_t} I/O context
+	context_t     &ctx;
+	/// @var {number} number of threads, 0 or 1 for serial
+	unsigned      numThreads;
+
+	/// @var {object} section being sorted
+	const uint8_t *pData;
+	/// @var {number} size of section element
+	size_t        elementSize;
+	/// @var {keyFn_t} key generator
+	keyFn_t       keyFn;
+	/// @var {tieFn_t} comparator for equal keys, NULL if keys are unique
+	tieFn_t       tieFn;
+	/// @var {object} caller context
+	void          *arg;
+	/// @var {entry_t[]} decorated elements
+	entry_t       *pEntries;
+	/// @var {entry_t[]} merge buffer
+	entry_t       *pMerge;
+
+	/**
+	 * @date 2026-10-17 18:33:02
+	 *
+	 * Constructor
+	 *
+	 * @param {context_t} ctx - I/O context
+	 * @param {number} numThreads - number of threads, 0 for serial
+	 */
+	decoratedSort_t(context_t &ctx, unsigned numThreads) : ctx(ctx) {
+		this->numThreads = numThreads ? numThreads : 1;
+
+		pData       = NULL;
+		elementSize = 0;
+		keyFn       = NULL;
+		tieFn       = NULL;
+		arg         = NULL;
+		pEntries    = NULL;
+		pMerge      = NULL;
+	}
+
+	/**
+	 * @date 2026-10-17 18:34:48
+	 *
+	 * Compare decorated entries: key, tie comparator, original position.
+	 *
+	 * @param {entry_t} pL - left hand side
+	 * @param {entry_t} pR - right hand side
+	 * @return "<0" if "L<R", ">0" if "L>R", never equal
+	 */
+	inline int compare(const entry_t *pL, const entry_t *pR) const {
+		if (pL->key != pR->key)
+			return pL->key < pR->key ? -1 : +1;
+
+		if (tieFn) {
+			int cmp = (*tieFn)(pData + (size_t) pL->index * elementSize, pData + (size_t) pR->index * elementSize, arg);
+			if (cmp)
+				return cmp;
+		}
+
+		return pL->index < pR->index ? -1 : (pL->index > pR->index ? +1 : 0);
+	}
+
+	/**
+	 * Compare function for `qsort_r`
+	 */
+	static int comparEntry(const void *lhs, const void *rhs, void *arg) {
+		return static_cast<const decoratedSort_t *>(arg)->compare(static_cast<const entry_t *>(lhs), static_cast<const entry_t *>(rhs));
+	}
+
+	/**
+	 * @date 2026-10-17 18:36:20
+	 *
+	 * Decorate and sort a thread range
+	 *
+	 * @param {worker_t} pWorker - range
+	 */
+	void sortRange(worker_t *pWorker) {
+		for (unsigned i = pWorker->lo; i < pWorker->hi; i++) {
+			pEntries[i].key   = (*keyFn)(pData + (size_t) i * elementSize, arg);
+			pEntries[i].index = i;
+		}
+
+		qsort_r(pEntries + pWorker->lo, pWorker->hi - pWorker->lo, sizeof(*pEntries), comparEntry, this);
+	}
+
+	/**
+	 * @date 2026-10-17 18:37:55
+	 *
+	 * Merge two adjacent sorted runs into `pMerge[]`
+	 *
+	 * @param {worker_t} pWorker - runs
+	 */
+	void mergeRange(worker_t *pWorker) {
+		unsigned iL = pWorker->lo, iR = pWorker->mid, iOut = pWorker->lo;
+
+		while (iL < pWorker->mid && iR < pWorker->hi) {
+			if (compare(pEntries + iL, pEntries + iR) <= 0)
+				pMerge[iOut++] = pEntries[iL++];
+			else
+				pMerge[iOut++] = pEntries[iR++];
+		}
+		while (iL < pWorker->mid)
+			pMerge[iOut++] = pEntries[iL++];
+		while (iR < pWorker->hi)
+			pMerge[iOut++] = pEntries[iR++];
+	}
+
+	/**
+	 * pthread entry point for decorate/sort
+	 */
+	static void *sortEntry(void *arg) {
+		worker_t *pWorker = (worker_t *) arg;
+		pWorker->pSort->sortRange(pWorker);
+		return NULL;
+	}
+
+	/**
+	 * pthread entry point for merge
+	 */
+	static void *mergeEntry(void *arg) {
+		worker_t *pWorker = (worker_t *) arg;
+		pWorker->pSort->mergeRange(pWorker);
+		return NULL;
+	}
+
+	/**
+	 * @date 2026-10-17 18:39:31
+	 *
+	 * Run workers, inline when only one
+	 *
+	 * @param {worker_t[]} pWorkers - ranges
+	 * @param {number} numWorker - number of ranges
+	 * @param {function} entry - pthread entry point
+	 */
+	void runWorkers(worker_t *pWorkers, unsigned numWorker, void *(*entry)(void *)) {
+		if (numWorker == 1) {
+			(*entry)(pWorkers);
+			return;
+		}
+
+		for (unsigned iWorker = 0; iWorker < numWorker; iWorker++) {
+			int ret = pthread_create(&pWorkers[iWorker].thread, NULL, entry, pWorkers + iWorker);
+			if (ret)
+				ctx.fatal("\n{\"error\":\"pthread_create() failed\",\"where\":\"%s:%s:%d\",\"return\":%d}\n",
+					  __FUNCTION__, __FILE__, __LINE__, ret);
+		}
+		for (unsigned iWorker = 0; iWorker < numWorker; iWorker++)
+			pthread_join(pWorkers[iWorker].thread, NULL);
+	}
+
+	/**
+	 * @date 2026-10-17 18:41:07
+	 *
+	 * Sort section
+	 *
+	 * @param {object} pBase - first element
+	 * @param {number} numElements - number of elements
+	 * @param {number} size - size of element
+	 * @param {keyFn_t} keyFn - key generator
+	 * @param {tieFn_t} tieFn - comparator for equal keys, NULL for none
+	 * @param {object} arg - caller context passed to `keyFn`/`tieFn`
+	 */
+	void sort(void *pBase, unsigned numElements, size_t size, keyFn_t keyFn, tieFn_t tieFn, void *arg) {
+		if (numElements < 2)
+			return;
+
+		this->pData       = (const uint8_t *) pBase;
+		this->elementSize = size;
+		this->keyFn       = keyFn;
+		this->tieFn       = tieFn;
+		this->arg         = arg;
+
+		unsigned numRange = numThreads;
+		if (numRange > numElements)
+			numRange = numElements;
+
+		pEntries = (entry_t *) ctx.myAlloc("decoratedSort_t::pEntries", numElements, sizeof(*pEntries));
+		pMerge   = (entry_t *) ctx.myAlloc("decoratedSort_t::pMerge", numElements, sizeof(*pMerge));
+
+		// range boundaries, `numRange+1` entries
+		unsigned *pBounds = (unsigned *) ctx.myAlloc("decoratedSort_t::pBounds", numRange + 1, sizeof(*pBounds));
+		for (unsigned iRange = 0; iRange <= numRange; iRange++)
+			pBounds[iRange] = (unsigned) ((uint64_t) numElements * iRange / numRange);
+
+		worker_t *pWorkers = (worker_t *) ctx.myAlloc("decoratedSort_t::pWorkers", numRange, sizeof(*pWorkers));
+
+		/*
+		 * Decorate and sort ranges
+		 */
+		for (unsigned iRange = 0; iRange < numRange; iRange++) {
+			pWorkers[iRange].pSort = this;
+			pWorkers[iRange].lo    = pBounds[iRange];
+			pWorkers[iRange].mid   = pBounds[iRange + 1];
+			pWorkers[iRange].hi    = pBounds[iRange + 1];
+		}
+		runWorkers(pWorkers, numRange, sortEntry);
+
+		/*
+		 * Merge runs of `width` ranges pairwise
+		 */
+		for (unsigned width = 1; width < numRange; width *= 2) {
+			unsigned numWorker = 0;
+
+			for (unsigned iRange = 0; iRange < numRange; iRange += 2 * width) {
+				worker_t *pWorker = pWorkers + numWorker++;
+
+				pWorker->pSort = this;
+				pWorker->lo    = pBounds[iRange];
+				pWorker->mid   = pBounds[iRange + width < numRange ? iRange + width : numRange];
+				pWorker->hi    = pBounds[iRange + 2 * width < numRange ? iRange + 2 * width : numRange];
+			}
+			runWorkers(pWorkers, numWorker, mergeEntry);
+
+			entry_t *pSwap = pEntries;
+			pEntries = pMerge;
+			pMerge   = pSwap;
+		}
+
+		/*
+		 * Undecorate: permute section once
+		 */
+		uint8_t *pCopy = (uint8_t *) ctx.myAlloc("decoratedSort_t::pCopy", numElements, size);
+		::memcpy(pCopy, pBase, (size_t) numElements * size);
+
+		for (unsigned i = 0; i < numElements; i++)
+			::memcpy((uint8_t *) pBase + (size_t) i * size, pCopy + (size_t) pEntries[i].index * size, size);
+
+		ctx.myFree("decoratedSort_t::pCopy", pCopy);
+		ctx.myFree("decoratedSort_t::pWorkers", pWorkers);
+		ctx.myFree("decoratedSort_t::pBounds", pBounds);
+		ctx.myFree("decoratedSort_t::pMerge", pMerge);
+		ctx.myFree("decoratedSort_t::pEntries", pEntries);
+
+		pData    = NULL;
+		pEntries = NULL;
+		pMerge   = NULL;
+	}
+};
+
+#endif
@@ -0,0 +1,685 @@
+//#pragma GCC optimize ("O0") // optimize on demand
+
+/*
+ * @date 2026-10-17 13:05:22
+ *
+ * gencoord.cc
+ *      Local coordinator for windowed/task generator runs.
+ *      Replacement for SGE task arrays when running on one big box or several without a batch scheduler.
+ *
+ *      The coordinator splits the work into `--tasks=<number>` tasks and keeps `--jobs=<number>` workers busy.
+ *      Workers are ordinary invocations of `gensignature`, `genmember`, `genswap` or `genhint`.
+ *      The task is passed to workers in two ways:
+ *        - every `{}` in the worker arguments is replaced by `<id>,<last>`, as in `--task={}`
+ *        - `SGE_TASK_ID`/`SGE_TASK_LAST` are set in the worker environment, so `--task=sge` works unchanged.
+ *          Remote workers get them through `env` in front of the ssh command.
+ *      If no argument contains `{}`, `--task=<id>,<last>` is appended.
+ *
+ *      Worker stdout is redirected into a per-task part file.
+ *      When a worker exits successfully its part is appended to `<output.lst>` and removed.
+ *      Failed workers have their partial output discarded and the task is retried up to `--retry=<number>` times.
+ *      The merged list can be loaded with `--load=<output.lst>` into a final database.
+ *
+ *      `--hosts=<host>[,<host>...]` adds one worker slot per host. Workers on hosts other than `localhost` are started with `ssh`.
+ *      Results stream back over the ssh connection.
+ *
+ *      Example:
+ *        ./gencoord --jobs=16 --tasks=256 members-5n9.lst ./genmember --task={} --text=1 --no-saveindex signatures-5n9.db 5
+ *        ./genmember --load=members-5n9.lst --no-generate signatures-5n9.db 5 members-5n9.db
+ */
+
+/*
+ *	This file is part of Untangle, Information in fractal structures.
+ *	Copyright (C) 2017-2026, xyzzy@rockingship.org
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <jansson.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "context.h"
+
+/*
+ * Resource context.
+ * Needs to be global to be accessible by signal handlers.
+ *
+ * @global {context_t} Application context
+ */
+context_t ctx;
+
+/**
+ * @date 2026-10-17 13:07:40
+ *
+ * Signal handlers
+ *
+ * Bump interval timer
+ *
+ * @param {number} sig - signal (ignored)
+ */
+void sigalrmHandler(int __attribute__ ((unused)) sig) {
+	if (ctx.opt_timer) {
+		ctx.tick++;
+		alarm(ctx.opt_timer);
+	}
+}
+
+/**
+ * @date 2026-10-17 13:09:12
+ *
+ * Main program logic as application context
+ * It is contained as an independent `struct` so it can be easily included into projects/code
+ */
+struct gencoordContext_t {
+
+	enum {
+		/// @constant {number} task waiting for a worker
+		TASK_PENDING = 0,
+		/// @constant {number} task has a worker
+		TASK_RUNNING,
+		/// @constant {number} task output merged
+		TASK_DONE,
+		/// @constant {number} task exceeded retries
+		TASK_FAILED,
+	};
+
+	/**
+	 * @date 2026-10-17 13:11:05
+	 *
+	 * Task/window state
+	 *
+	 * @typedef {object} task_t
+	 */
+	struct task_t {
+		/// @var {number} TASK_xxx
+		unsigned state;
+		/// @var {number} number of attempts
+		unsigned attempts;
+		/// @var {number} process id of worker
+		pid_t    pid;
+		/// @var {number} worker slot
+		unsigned slot;
+	};
+
+	/*
+	 * User specified program arguments and options
+	 */
+
+	/// @var {string} name of merged output
+	const char *arg_outputName;
+	/// @var {string[]} worker command and arguments
+	char       **arg_command;
+	/// @var {number} number of worker arguments
+	unsigned   arg_numCommand;
+	/// @var {number} --force, force overwriting of output if already exists
+	unsigned   opt_force;
+	/// @var {string} comma separated list of worker hosts
+	const char *opt_hosts;
+	/// @var {number} number of concurrent workers
+	unsigned   opt_jobs;
+	/// @var {number} retries per failed task
+	unsigned   opt_retry;
+	/// @var {number} number of tasks
+	unsigned   opt_tasks;
+
+	/// @var {task_t[]} task states, index 1..opt_tasks
+	task_t     *pTasks;
+	/// @var {string[]} host of worker slot, NULL for local
+	char       **pSlotHost;
+	/// @var {number} worker slot busy flags
+	unsigned   *pSlotBusy;
+	/// @var {number} number of worker slots
+	unsigned   numSlot;
+
+	/// @var {number} tasks merged
+	unsigned   numDone;
+	/// @var {number} tasks given up
+	unsigned   numFailed;
+	/// @var {number} tasks with a worker
+	unsigned   numRunning;
+	/// @var {number} worker re-submissions
+	unsigned   numRetry;
+	/// @var {uint64_t} lines merged
+	uint64_t   numLines;
+
+	/**
+	 * Constructor
+	 */
+	gencoordContext_t() {
+		arg_outputName = NULL;
+		arg_command    = NULL;
+		arg_numCommand = 0;
+		opt_force      = 0;
+		opt_hosts      = NULL;
+		opt_jobs       = 0;
+		opt_retry      = 2;
+		opt_tasks      = 0;
+
+		pTasks    = NULL;
+		pSlotHost = NULL;
+		pSlotBusy = NULL;
+		numSlot   = 0;
+
+		numDone    = 0;
+		numFailed  = 0;
+		numRunning = 0;
+		numRetry   = 0;
+		numLines   = 0;
+	}
+
+	/**
+	 * @date 2026-10-17 13:15:31
+	 *
+	 * Create worker slots, either `--jobs` local or one per entry in `--hosts`
+	 */
+	void setupSlots(void) {
+		if (opt_hosts) {
+			// count hosts
+			numSlot = 1;
+			for (const char *p = opt_hosts; *p; p++)
+				if (*p == ',')
+					numSlot++;
+
+			pSlotHost = (char **) ctx.myAlloc("gencoordContext_t::pSlotHost", numSlot, sizeof(*pSlotHost));
+
+			char *hosts = ::strdup(opt_hosts);
+			char *saveptr;
+			unsigned iSlot = 0;
+			for (char *p = ::strtok_r(hosts, ",", &saveptr); p; p = ::strtok_r(NULL, ",", &saveptr))
+				pSlotHost[iSlot++] = ::strcmp(p, "localhost") == 0 ? NULL : p;
+			numSlot = iSlot;
+		} else {
+			numSlot   = opt_jobs;
+			pSlotHost = (char **) ctx.myAlloc("gencoordContext_t::pSlotHost", numSlot, sizeof(*pSlotHost));
+		}
+
+		if (numSlot == 0)
+			ctx.fatal("\n{\"error\":\"no worker slots\",\"where\":\"%s:%s:%d\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__);
+
+		pSlotBusy = (unsigned *) ctx.myAlloc("gencoordContext_t::pSlotBusy", numSlot, sizeof(*pSlotBusy));
+
+		if (opt_tasks == 0)
+			opt_tasks = numSlot * 4;
+		pTasks = (task_t *) ctx.myAlloc("gencoordContext_t::pTasks", opt_tasks + 1, sizeof(*pTasks));
+	}
+
+	/**
+	 * @date 2026-10-17 13:19:48
+	 *
+	 * Name of file capturing worker output
+	 *
+	 * @param {string} buf - (output) filename
+	 * @param {number} taskId - task
+	 */
+	void partName(char *buf, size_t len, unsigned taskId) {
+		::snprintf(buf, len, "%s.%u.part", arg_outputName, taskId);
+	}
+
+	/**
+	 * @date 2026-10-17 13:22:14
+	 *
+	 * Start worker for task.
+	 * stdout of the worker is captured into its part file, stderr is shared with the coordinator.
+	 *
+	 * @param {number} taskId - task to start
+	 * @param {number} iSlot - worker slot
+	 */
+	void startWorker(unsigned taskId, unsigned iSlot) {
+		char taskArg[64];
+		::sprintf(taskArg, "%u,%u", taskId, opt_tasks);
+
+		// construct argument list, substitute `{}` or append `--task=`
+		char     **argv  = (char **) ::calloc(arg_numCommand + 12, sizeof(*argv));
+		bool     *pOwned = (bool *) ::calloc(arg_numCommand + 12, sizeof(*pOwned));
+		unsigned numArgv = 0;
+		bool     hasTask = false;
+
+		if (pSlotHost[iSlot]) {
+			argv[numArgv++] = (char *) "ssh";
+			argv[numArgv++] = (char *) "-o";
+			argv[numArgv++] = (char *) "BatchMode=yes";
+			argv[numArgv++] = pSlotHost[iSlot];
+
+			// ssh does not forward the environment, set it in the remote command
+			char *pEnvId   = (char *) ::malloc(32);
+			char *pEnvLast = (char *) ::malloc(32);
+			::sprintf(pEnvId, "SGE_TASK_ID=%u", taskId);
+			::sprintf(pEnvLast, "SGE_TASK_LAST=%u", opt_tasks);
+
+			argv[numArgv++]   = (char *) "env";
+			pOwned[numArgv]   = true;
+			argv[numArgv++]   = pEnvId;
+			pOwned[numArgv]   = true;
+			argv[numArgv++]   = pEnvLast;
+		}
+
+		for (unsigned iArg = 0; iArg < arg_numCommand; iArg++) {
+			const char *pArg = arg_command[iArg];
+			const char *pSub = ::strstr(pArg, "{}");
+
+			if (pSub) {
+				char *pNew = (char *) ::malloc(::strlen(pArg) + ::strlen(taskArg) + 1);
+				::sprintf(pNew, "%.*s%s%s", (int) (pSub - pArg), pArg, taskArg, pSub + 2);
+				pOwned[numArgv]   = true;
+				argv[numArgv++]   = pNew;
+				hasTask = true;
+			} else {
+				argv[numArgv++] = (char *) pArg;
+			}
+		}
+
+		static char taskOpt[80];
+		if (!hasTask) {
+			::sprintf(taskOpt, "--task=%s", taskArg);
+			argv[numArgv++] = taskOpt;
+		}
+		argv[numArgv] = NULL;
+
+		char fname[1024];
+		partName(fname, sizeof(fname), taskId);
+
+		int hndl = ::open(fname, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+		if (hndl == -1)
+			ctx.fatal("\n{\"error\":\"open('%s') failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  fname, __FUNCTION__, __FILE__, __LINE__);
+
+		pid_t pid = ::fork();
+		if (pid == -1)
+			ctx.fatal("\n{\"error\":\"fork() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__);
+
+		if (pid == 0) {
+			// worker
+			char envId[32], envLast[32];
+			::sprintf(envId, "%u", taskId);
+			::sprintf(envLast, "%u", opt_tasks);
+			::setenv("SGE_TASK_ID", envId, 1);
+			::setenv("SGE_TASK_LAST", envLast, 1);
+
+			::dup2(hndl, STDOUT_FILENO);
+			::close(hndl);
+			::signal(SIGALRM, SIG_DFL);
+
+			::execvp(argv[0], argv);
+			fprintf(stderr, "execvp(%s) failed: %m\n", argv[0]);
+			::_exit(127);
+		}
+
+		::close(hndl);
+
+		// release substituted arguments
+		for (unsigned iArg = 0; iArg < numArgv; iArg++) {
+			if (pOwned[iArg])
+				::free(argv[iArg]);
+		}
+		::free(pOwned);
+		::free(argv);
+
+		task_t *pTask = pTasks + taskId;
+		pTask->state = TASK_RUNNING;
+		pTask->pid   = pid;
+		pTask->slot  = iSlot;
+		pTask->attempts++;
+		pSlotBusy[iSlot] = 1;
+		numRunning++;
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "\r\e[K[%s] start task=%s pid=%d host=%s\n", ctx.timeAsString(), taskArg, pid, pSlotHost[iSlot] ? pSlotHost[iSlot] : "localhost");
+	}
+
+	/**
+	 * @date 2026-10-17 13:30:57
+	 *
+	 * Append part file of finished task to merged output
+	 *
+	 * @param {FILE} fOutput - merged output
+	 * @param {number} taskId - finished task
+	 */
+	void mergePart(FILE *fOutput, unsigned taskId) {
+		char fname[1024];
+		partName(fname, sizeof(fname), taskId);
+
+		FILE *f = ::fopen(fname, "r");
+		if (f == NULL)
+			ctx.fatal("\n{\"error\":\"fopen('%s') failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  fname, __FUNCTION__, __FILE__, __LINE__);
+
+		char   buf[65536];
+		size_t len;
+		while ((len = ::fread(buf, 1, sizeof(buf), f)) > 0) {
+			for (size_t i = 0; i < len; i++)
+				if (buf[i] == '\n')
+					numLines++;
+			if (::fwrite(buf, 1, len, fOutput) != len)
+				ctx.fatal("\n{\"error\":\"fwrite('%s') failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  arg_outputName, __FUNCTION__, __FILE__, __LINE__);
+		}
+		::fclose(f);
+		::fflush(fOutput);
+
+		::unlink(fname);
+	}
+
+	/**
+	 * @date 2026-10-17 13:35:16
+	 *
+	 * Main entrypoint.
+	 * Keep worker slots busy until all tasks are merged or given up.
+	 *
+	 * @return {number} 0 when all tasks succeeded
+	 */
+	int main(void) {
+
+		setupSlots();
+
+		FILE *fOutput = ::fopen(arg_outputName, "w");
+		if (fOutput == NULL)
+			ctx.fatal("\n{\"error\":\"fopen('%s') failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  arg_outputName, __FUNCTION__, __FILE__, __LINE__);
+
+		unsigned nextTask  = 1;
+		uint64_t lastLines = 0;
+
+		while (numDone + numFailed < opt_tasks) {
+
+			/*
+			 * Fill empty slots with pending tasks, lowest first
+			 */
+			for (unsigned iSlot = 0; iSlot < numSlot; iSlot++) {
+				if (pSlotBusy[iSlot])
+					continue;
+
+				while (nextTask <= opt_tasks && pTasks[nextTask].state != TASK_PENDING)
+					nextTask++;
+				if (nextTask > opt_tasks)
+					break;
+
+				startWorker(nextTask, iSlot);
+			}
+
+			/*
+			 * Wait for a worker to finish, interrupted by the ticker
+			 */
+			int   status;
+			pid_t pid = ::waitpid(-1, &status, 0);
+
+			if (pid == -1) {
+				if (errno != EINTR)
+					ctx.fatal("\n{\"error\":\"waitpid() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+						  __FUNCTION__, __FILE__, __LINE__);
+
+				if (ctx.opt_verbose >= ctx.VERBOSE_TICK && ctx.tick) {
+					double speed = (double) (numLines - lastLines) / (ctx.opt_timer ? ctx.opt_timer : 1);
+
+					fprintf(stderr, "\r\e[K[%s] done=%u/%u running=%u failed=%u retry=%u lines=%lu(%7.0f/s)",
+						ctx.timeAsString(), numDone, opt_tasks, numRunning, numFailed, numRetry, numLines, speed);
+
+					lastLines = numLines;
+					ctx.tick  = 0;
+				}
+				continue;
+			}
+
+			// locate task
+			unsigned taskId;
+			for (taskId = 1; taskId <= opt_tasks; taskId++)
+				if (pTasks[taskId].state == TASK_RUNNING && pTasks[taskId].pid == pid)
+					break;
+			if (taskId > opt_tasks)
+				continue; // not ours
+
+			task_t *pTask = pTasks + taskId;
+			pSlotBusy[pTask->slot] = 0;
+			numRunning--;
+
+			if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+				mergePart(fOutput, taskId);
+				pTask->state = TASK_DONE;
+				numDone++;
+
+				if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+					fprintf(stderr, "\r\e[K[%s] done task=%u,%u\n", ctx.timeAsString(), taskId, opt_tasks);
+			} else {
+				// discard partial output
+				char fname[1024];
+				partName(fname, sizeof(fname), taskId);
+				::unlink(fname);
+
+				if (pTask->attempts <= opt_retry) {
+					pTask->state = TASK_PENDING;
+					numRetry++;
+					if (taskId < nextTask)
+						nextTask = taskId;
+				} else {
+					pTask->state = TASK_FAILED;
+					numFailed++;
+				}
+
+				if (ctx.opt_verbose >= ctx.VERBOSE_WARNING)
+					fprintf(stderr, "\r\e[K[%s] WARNING: task=%u,%u %s=%d attempt=%u%s\n", ctx.timeAsString(), taskId, opt_tasks,
+						WIFEXITED(status) ? "exit" : "signal", WIFEXITED(status) ? WEXITSTATUS(status) : WTERMSIG(status),
+						pTask->attempts, pTask->state == TASK_FAILED ? " giving up" : "");
+			}
+		}
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
+			fprintf(stderr, "\r\e[K");
+
+		if (::fclose(fOutput))
+			ctx.fatal("\n{\"error\":\"fclose('%s') failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  arg_outputName, __FUNCTION__, __FILE__, __LINE__);
+
+		return numFailed ? 1 : 0;
+	}
+
+};
+
+/*
+ * Application context.
+ * Needs to be global to be accessible by signal handlers.
+ *
+ * @global {gencoordContext_t} Application context
+ */
+gencoordContext_t app;
+
+/**
+ * @date 2026-10-17 13:44:02
+ *
+ * Program usage. Keep high in source code for easy reference
+ *
+ * @param {string[]} argv - program arguments
+ * @param {boolean} verbose - set to true for option descriptions
+ */
+void usage(char *argv[], bool verbose) {
+	fprintf(stderr, "usage: %s [options] <output.lst> <command> [<argument>...]\n", argv[0]);
+
+	if (verbose) {
+		fprintf(stderr, "\n");
+		fprintf(stderr, "\t   --force                   Force overwriting of output if already exists\n");
+		fprintf(stderr, "\t-h --help                    This list\n");
+		fprintf(stderr, "\t   --hosts=<host>[,<host>]   One worker slot per host, started with ssh unless \"localhost\"\n");
+		fprintf(stderr, "\t   --jobs=<number>           Number of local workers [default=%u]\n", app.opt_jobs);
+		fprintf(stderr, "\t-q --quiet                   Say less\n");
+		fprintf(stderr, "\t   --retry=<number>          Retries per failed task [default=%u]\n", app.opt_retry);
+		fprintf(stderr, "\t   --tasks=<number>          Number of tasks [default=4*workers]\n");
+		fprintf(stderr, "\t   --timer=<seconds>         Interval timer for verbose updates [default=%u]\n", ctx.opt_timer);
+		fprintf(stderr, "\t-v --verbose                 Say more\n");
+		fprintf(stderr, "\n");
+		fprintf(stderr, "\t`{}` in arguments is replaced by \"<id>,<last>\", otherwise \"--task=<id>,<last>\" is appended\n");
+		fprintf(stderr, "\tWorkers also get SGE_TASK_ID/SGE_TASK_LAST in their environment for \"--task=sge\"\n");
+	}
+}
+
+/**
+ * @date 2026-10-17 13:46:19
+ *
+ * Program main entry point
+ * Process all user supplied arguments to construct a application context.
+ * Activate application context.
+ *
+ * @param  {number} argc - number of arguments
+ * @param  {string[]} argv - program arguments
+ * @return {number} 0 on normal return, non-zero when attention is required
+ */
+int main(int argc, char *argv[]) {
+	setlinebuf(stdout);
+
+	app.opt_jobs = (unsigned) ::sysconf(_SC_NPROCESSORS_ONLN);
+
+	for (;;) {
+		enum {
+			LO_HELP     = 1, LO_DEBUG, LO_FORCE, LO_HOSTS, LO_JOBS, LO_RETRY, LO_TASKS, LO_TIMER, LO_QUIET = 'q', LO_VERBOSE = 'v'
+		};
+
+		static struct option long_options[] = {
+			/* name, has_arg, flag, val */
+			{"debug",   1, 0, LO_DEBUG},
+			{"force",   0, 0, LO_FORCE},
+			{"help",    0, 0, LO_HELP},
+			{"hosts",   1, 0, LO_HOSTS},
+			{"jobs",    1, 0, LO_JOBS},
+			{"quiet",   2, 0, LO_QUIET},
+			{"retry",   1, 0, LO_RETRY},
+			{"tasks",   1, 0, LO_TASKS},
+			{"timer",   1, 0, LO_TIMER},
+			{"verbose", 2, 0, LO_VERBOSE},
+			{NULL,      0, 0, 0}
+		};
+
+		char optstring[64];
+		char *cp                            = optstring;
+		int  option_index                   = 0;
+
+		// stop at first non-option, the rest belongs to the worker command
+		*cp++ = '+';
+
+		for (int i = 0; long_options[i].name; i++) {
+			if (isalpha(long_options[i].val)) {
+				*cp++ = (char) long_options[i].val;
+
+				if (long_options[i].has_arg)
+					*cp++ = ':';
+				if (long_options[i].has_arg == 2)
+					*cp++ = ':';
+			}
+		}
+
+		*cp = '\0';
+
+		int c = getopt_long(argc, argv, optstring, long_options, &option_index);
+		if (c == -1)
+			break;
+
+		switch (c) {
+		case LO_DEBUG:
+			ctx.opt_debug = (unsigned) strtoul(optarg, NULL, 8); // OCTAL!!
+			break;
+		case LO_FORCE:
+			app.opt_force++;
+			break;
+		case LO_HELP:
+			usage(argv, true);
+			exit(0);
+		case LO_HOSTS:
+			app.opt_hosts = optarg;
+			break;
+		case LO_JOBS:
+			app.opt_jobs = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_QUIET:
+			ctx.opt_verbose = optarg ? (unsigned) strtoul(optarg, NULL, 10) : ctx.opt_verbose - 1;
+			break;
+		case LO_RETRY:
+			app.opt_retry = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_TASKS:
+			app.opt_tasks = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_TIMER:
+			ctx.opt_timer = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_VERBOSE:
+			ctx.opt_verbose = optarg ? (unsigned) strtoul(optarg, NULL, 10) : ctx.opt_verbose + 1;
+			break;
+
+		case '?':
+			ctx.fatal("Try `%s --help' for more information.\n", argv[0]);
+		default:
+			ctx.fatal("getopt returned character code %d\n", c);
+		}
+	}
+
+	if (argc - optind >= 1)
+		app.arg_outputName = argv[optind++];
+	if (argc - optind >= 1) {
+		app.arg_command    = argv + optind;
+		app.arg_numCommand = argc - optind;
+	}
+
+	if (app.arg_command == NULL) {
+		usage(argv, false);
+		exit(1);
+	}
+
+	/*
+	 * None of the outputs may exist
+	 */
+	if (!app.opt_force) {
+		struct stat sbuf;
+		if (!stat(app.arg_outputName, &sbuf))
+			ctx.fatal("%s already exists. Use --force to overwrite\n", app.arg_outputName);
+	}
+
+	/*
+	 * Main
+	 */
+
+	// register timer handler. Without `SA_RESTART` so it interrupts `waitpid()`
+	if (ctx.opt_timer) {
+		struct sigaction sa;
+		::memset(&sa, 0, sizeof(sa));
+		sa.sa_handler = sigalrmHandler;
+		::sigaction(SIGALRM, &sa, NULL);
+		::alarm(ctx.opt_timer);
+	}
+
+	int ret = app.main();
+
+	if (ctx.opt_verbose >= ctx.VERBOSE_WARNING) {
+		json_t *jResult = json_object();
+		json_object_set_new_nocheck(jResult, "done", json_string_nocheck(argv[0]));
+		json_object_set_new_nocheck(jResult, "filename", json_string_nocheck(app.arg_outputName));
+		json_object_set_new_nocheck(jResult, "numTask", json_integer(app.opt_tasks));
+		json_object_set_new_nocheck(jResult, "numWorker", json_integer(app.numSlot));
+		json_object_set_new_nocheck(jResult, "numDone", json_integer(app.numDone));
+		json_object_set_new_nocheck(jResult, "numFailed", json_integer(app.numFailed));
+		json_object_set_new_nocheck(jResult, "numRetry", json_integer(app.numRetry));
+		json_object_set_new_nocheck(jResult, "numLines", json_integer(app.numLines));
+		fprintf(stderr, "%s\n", json_dumps(jResult, JSON_PRESERVE_ORDER | JSON_COMPACT));
+	}
+
+	return ret;
+}
@@ -1419,6 +1419,9 @@ int main(int argc, char *argv[]) {
 	if (app.rebuildSections)
 		store.rebuildIndices(app.rebuildSections);
 
+	// shared input sections must be verified before lookups
+	app.waitVerifySections();
+
 	/*
 	 * count empty/unsafe
 	 */
@@ -55,6 +55,14 @@
  * NOTE: due to new packed layout, `TINYTREE_MAXNODE` is now set to max 8.
  * However, 8 nodes requires 4930223 template entries. 7 nodes has 2181293.
  * Don't be wasteful, 7n9 spans a massively large space.
+ *
+ * @date 2026-10-17 13:52:18
+ *
+ * Template tables (`pIsType[]`, `pTOS[]`, `pTemplateData[]`, `templateIndex[]`) are read-only after construction
+ * and identical for every generator with the same `pure` setting.
+ * They are built once per process and shared by all `generatorTree_t` instances, making instances cheap to create per thread.
+ * When environment `UNTANGLE_TEMPLATES=<directory>` is set, tables are `mmap()`ed from `<directory>/generator-<pure>.tpl`,
+ * which is created on first use, so short-lived tasks skip construction and share pages between processes.
  */
 
 /*
@@ -76,9 +84,14 @@
  */
 
 #include <assert.h>
+#include <fcntl.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "tinytree.h"
 
 /*
@@ -164,6 +177,36 @@ struct generatorTree_t : tinyTree_t {
 		/// @constant {number} - size of `pTemplateData[]`
 		TEMPLATE_MAXDATA = 5116361,
 		TEMPLATE_MAXDATA_PURE = 2719253,
+
+		/// @constant {number} - magic number of persisted template tables
+		TEMPLATE_MAGIC = 0x20261017,
+	};
+
+	/**
+	 * @date 2026-10-17 13:55:40
+	 *
+	 * Read-only template tables shared between generator instances.
+	 * Layout is flat so it can be persisted and `mmap()`ed as a single blob.
+	 *
+	 * @typedef {object} generatorTemplate_t
+	 */
+	struct generatorTemplate_t {
+		/// @var {number} TEMPLATE_MAGIC
+		uint32_t magic;
+		/// @var {number} `sizeof(generatorTemplate_t)`
+		uint32_t size;
+		/// @var {number} non-zero for `QnTF`-only
+		uint32_t pure;
+		/// @var {number} number of entries used in `templateData[]`
+		uint32_t numTemplateData;
+		/// @var {number[7][10][10]} starting offset in `templateData[]`. `templateIndex[SECTION][numNode][numPlaceholder]`
+		uint32_t templateIndex[1 << TINYTREE_MAXNODES][MAXSLOTS + 1][4];
+		/// @var {uint8_t[]} array indexed by packed `QTnF` to indicate what type of operator
+		uint8_t  isType[1 << PACKED_SIZE];
+		/// @var {uint8_t[]} Value of top-of-stack
+		uint8_t  TOS[1 << TINYTREE_MAXNODES];
+		/// @var {number[]} template data for generator
+		uint32_t templateData[TEMPLATE_MAXDATA];
 	};
 
 	/// @var {number[]} lookup table for `push()` index by packed `QTF`
@@ -179,10 +222,10 @@ struct generatorTree_t : tinyTree_t {
 	uint32_t packedN[TINYTREE_NEND];
 
 	/// @var {uint8_t[]} array indexed by packed `QTnF` to indicate what type of operator
-	uint8_t *pIsType;
+	const uint8_t *pIsType;
 
 	/// @var {uint8_t[]} Value of top-of-stack
-	uint8_t *pTOS;
+	const uint8_t *pTOS;
 
 	/// @var {uint64_t} lower bound `progress` (if non-zero)
 	uint64_t windowLo;
@@ -197,10 +240,10 @@ struct generatorTree_t : tinyTree_t {
 	unsigned restartTabDepth;
 
 	/// @var {number[]} template data for generator
-	uint32_t *pTemplateData;
+	const uint32_t *pTemplateData;
 
 	/// @var {number[7][10][10]} starting offset in `templateData[]`. `templateIndex[SECTION][numNode][numPlaceholder]`
-	uint32_t templateIndex[1 << TINYTREE_MAXNODES][MAXSLOTS + 1][4];
+	const uint32_t (*templateIndex)[MAXSLOTS + 1][4];
 
 	/// @var {tintTree_t} Tree needed to re-order endpoints before calling `foundTree()`
 	tinyTree_t foundTree;
@@ -223,14 +266,15 @@ struct generatorTree_t : tinyTree_t {
 		ctx.tick = 0;
 		restartTabDepth = TINYTREE_NSTART + 2; // for `7n9` +3 is a better choice. But `7n9-pure` still has 70177 restart tabs.
 
-		::memset(templateIndex, 0, sizeof(templateIndex));
+		// template tables are shared, attached by `initialiseGenerator()`
+		pIsType = NULL;
+		pTOS = NULL;
+		pTemplateData = NULL;
+		templateIndex = NULL;
 
 		// allocate structures
-		pIsType = (uint8_t *) ctx.myAlloc("generatorTree_t::pIsType", 1 << PACKED_SIZE, sizeof(*this->pIsType));
-		pTOS = (uint8_t *) ctx.myAlloc("generatorTree_t::pTOS", 1 << TINYTREE_MAXNODES, sizeof(*this->pTOS));
 		pCacheQTF = (uint32_t *) ctx.myAlloc("generatorTree_t::pCacheQTF", 1 << PACKED_SIZE, sizeof(*this->pCacheQTF));
 		pCacheVersion = (uint32_t *) ctx.myAlloc("generatorTree_t::pCacheVersion", 1 << PACKED_SIZE, sizeof(*this->pCacheVersion));
-		pTemplateData = (uint32_t *) ctx.myAlloc("generatorTree_t::pTemplateData", TEMPLATE_MAXDATA, sizeof(*pTemplateData));
 
 		// clear versioned memory
 		iVersion = 0;
@@ -246,10 +290,8 @@ struct generatorTree_t : tinyTree_t {
 	 * Release system resources
 	 */
 	~generatorTree_t() {
-		ctx.myFree("generatorTree_t::pIsType", this->pIsType);
 		ctx.myFree("generatorTree_t::pCacheQTF", this->pCacheQTF);
 		ctx.myFree("generatorTree_t::pCacheVersion", this->pCacheVersion);
-		ctx.myFree("generatorTree_t::pTemplateData", this->pTemplateData);
 	}
 
 	/**
@@ -287,13 +329,117 @@ struct generatorTree_t : tinyTree_t {
 	}
 
 	/**
-	 * @date 2020-03-18 21:05:34
+	 * @date 2026-10-17 14:02:11
 	 *
-	 * Initialise lookup tables for generator
+	 * Attach shared lookup tables for generator
 	 *
 	 * @param {number} pure - zero for any operator, non-zero for `QnTF` only operator
 	 */
 	void initialiseGenerator(unsigned pure) {
+		const generatorTemplate_t *pTemplate = getTemplate(ctx, pure ? 1 : 0);
+
+		pIsType = pTemplate->isType;
+		pTOS = pTemplate->TOS;
+		pTemplateData = pTemplate->templateData;
+		templateIndex = pTemplate->templateIndex;
+	}
+
+	/**
+	 * @date 2026-10-17 14:04:37
+	 *
+	 * Get process-wide template tables, constructed on first use.
+	 * Function-local statics make first use thread-safe.
+	 *
+	 * @param {context_t} ctx - I/O context
+	 * @param {number} pure - zero for any operator, one for `QnTF` only operator
+	 * @return {generatorTemplate_t} read-only tables
+	 */
+	static const generatorTemplate_t *getTemplate(context_t &ctx, unsigned pure) {
+		if (pure) {
+			static const generatorTemplate_t *pPure = loadTemplate(ctx, 1);
+			return pPure;
+		} else {
+			static const generatorTemplate_t *pFull = loadTemplate(ctx, 0);
+			return pFull;
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 14:08:53
+	 *
+	 * Load template tables from the directory in `UNTANGLE_TEMPLATES`, or construct them.
+	 * Persisted tables are created when missing or invalid.
+	 *
+	 * @param {context_t} ctx - I/O context
+	 * @param {number} pure - zero for any operator, one for `QnTF` only operator
+	 * @return {generatorTemplate_t} read-only tables
+	 */
+	static const generatorTemplate_t *loadTemplate(context_t &ctx, unsigned pure) {
+		const char *pDir = ::getenv("UNTANGLE_TEMPLATES");
+		char       fileName[1024];
+
+		if (pDir && *pDir) {
+			::snprintf(fileName, sizeof(fileName), "%s/generator-%u.tpl", pDir, pure);
+
+			int hndl = ::open(fileName, O_RDONLY);
+			if (hndl != -1) {
+				struct stat sbuf;
+				void        *pMap = MAP_FAILED;
+
+				if (::fstat(hndl, &sbuf) == 0 && (size_t) sbuf.st_size == sizeof(generatorTemplate_t))
+					pMap = ::mmap(NULL, sizeof(generatorTemplate_t), PROT_READ, MAP_SHARED, hndl, 0);
+				::close(hndl);
+
+				if (pMap != MAP_FAILED) {
+					const generatorTemplate_t *pTemplate = (const generatorTemplate_t *) pMap;
+
+					if (pTemplate->magic == TEMPLATE_MAGIC && pTemplate->size == sizeof(generatorTemplate_t) && pTemplate->pure == pure)
+						return pTemplate;
+
+					// stale, rebuild
+					::munmap(pMap, sizeof(generatorTemplate_t));
+				}
+			}
+		}
+
+		generatorTemplate_t *pTemplate = (generatorTemplate_t *) ctx.myAlloc("generatorTree_t::pTemplate", 1, sizeof(generatorTemplate_t));
+		buildTemplate(pTemplate, pure);
+
+		if (pDir && *pDir) {
+			// write to temporary and rename so concurrent readers never see partial tables
+			char tmpName[1040];
+			::snprintf(tmpName, sizeof(tmpName), "%s.%d", fileName, (int) ::getpid());
+
+			FILE *f = ::fopen(tmpName, "w");
+			if (f) {
+				bool ok = ::fwrite(pTemplate, sizeof(generatorTemplate_t), 1, f) == 1;
+				ok = (::fclose(f) == 0) && ok;
+				if (!ok || ::rename(tmpName, fileName) != 0)
+					::unlink(tmpName);
+			}
+		}
+
+		return pTemplate;
+	}
+
+	/**
+	 * @date 2020-03-18 21:05:34
+	 *
+	 * Construct lookup tables for generator
+	 *
+	 * @param {generatorTemplate_t} pTemplate - (output) tables
+	 * @param {number} pure - zero for any operator, non-zero for `QnTF` only operator
+	 */
+	static void buildTemplate(generatorTemplate_t *pTemplate, unsigned pure) {
+		uint8_t  *pIsType = pTemplate->isType;
+		uint8_t  *pTOS = pTemplate->TOS;
+		uint32_t *pTemplateData = pTemplate->templateData;
+		uint32_t (*templateIndex)[MAXSLOTS + 1][4] = pTemplate->templateIndex;
+
+		pTemplate->magic = TEMPLATE_MAGIC;
+		pTemplate->size = sizeof(generatorTemplate_t);
+		pTemplate->pure = pure;
+
 		/*
 		 * Create lookup table indexed by packed notation to determine if `Q,T,F` combo is normalised
 		 * Exclude ordered dyadics.
@@ -572,6 +718,8 @@ struct generatorTree_t : tinyTree_t {
 			pTemplateData[numTemplateData++] = 0;
 		}
 
+		pTemplate->numTemplateData = numTemplateData;
+
 		if (pure) {
 			if (numTemplateData != TEMPLATE_MAXDATA_PURE)
 				fprintf(stderr, "numTemplateData=%u\n", numTemplateData);
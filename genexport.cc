@@ -162,7 +162,7 @@ struct genexportContext_t {
 
 		json_t *jSignature = json_object();
 		json_object_set_new_nocheck(jSignature, "filename", json_string(arg_signatureName));
-		json_object_set_new_nocheck(jSignature, "count", json_integer(pStore->numSignature - 1));
+		json_object_set_new_nocheck(jSignature, "count", json_integer(pStore->numSignature ? pStore->numSignature - 1 : 0));
 		json_object_set_new_nocheck(jSignature, "crc", json_integer(crc32));
 		json_object_set_new_nocheck(jOutput, "signature", jSignature);
 
@@ -199,7 +199,7 @@ struct genexportContext_t {
 
 		json_t *jSwap = json_object();
 		json_object_set_new_nocheck(jSwap, "filename", json_string(arg_swapName));
-		json_object_set_new_nocheck(jSwap, "count", json_integer(pStore->numSwap - 1));
+		json_object_set_new_nocheck(jSwap, "count", json_integer(pStore->numSwap ? pStore->numSwap - 1 : 0));
 		json_object_set_new_nocheck(jSwap, "crc", json_integer(crc32));
 		json_object_set_new_nocheck(jOutput, "swap", jSwap);
 
@@ -252,11 +252,14 @@ struct genexportContext_t {
 		}
 
 		json_t *jMember = json_object();
-		json_object_set_new_nocheck(jMember, "filename", json_string(arg_signatureName));
-		json_object_set_new_nocheck(jMember, "count", json_integer(pStore->numSignature - 1));
+		json_object_set_new_nocheck(jMember, "filename", json_string(arg_memberName));
+		json_object_set_new_nocheck(jMember, "count", json_integer(pStore->numMember ? pStore->numMember - 1 : 0));
 		json_object_set_new_nocheck(jMember, "crc", json_integer(crc32));
 		json_object_set_new_nocheck(jOutput, "member", jMember);
 
+		// member `tid` depends on which imprints are present
+		json_object_set_new_nocheck(jOutput, "interleave", json_integer(pStore->interleave));
+
 		/*
 		 * Write JSON
 		 */
@@ -415,7 +418,8 @@ int main(int argc, char *argv[]) {
 		// Open database
 	database_t db(ctx);
 
-	db.open(app.arg_databaseName);
+	// only exported sections are used, compressed containers leave other sections compressed
+	db.open(app.arg_databaseName, ~(database_t::ALLOCMASK_TRANSFORM | database_t::ALLOCMASK_SIGNATURE | database_t::ALLOCMASK_SWAP | database_t::ALLOCMASK_MEMBER));
 
 	app.pStore   = &db;
 
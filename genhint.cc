@@ -654,8 +654,10 @@ void usage(char *argv[], bool verbose) {
 	if (verbose) {
 		fprintf(stderr, "\n");
 		fprintf(stderr, "\t   --analyse=<number>         Analyise input database for given amount of memory\n");
+		fprintf(stderr, "\t   --[no-]compress            Save as block-compressed container [default=%s]\n", app.opt_compress ? "enabled" : "disabled");
 		fprintf(stderr, "\t   --force                    Force overwriting of database if already exists\n");
 		fprintf(stderr, "\t   --[no-]generate            Invoke generator for new candidates [default=%s]\n", app.opt_generate ? "enabled" : "disabled");
+		fprintf(stderr, "\t   --[no-]grow                Grow full sections instead of \"storage full\" [default=%s]\n", app.opt_grow ? "enabled" : "disabled");
 		fprintf(stderr, "\t-h --help                     This list\n");
 		fprintf(stderr, "\t   --hintindexsize=<number>   Size of hint index [default=%u]\n", app.opt_hintIndexSize);
 		fprintf(stderr, "\t   --maxhint=<number>         Maximum number of hints [default=%u]\n", app.opt_maxHint);
@@ -670,6 +672,7 @@ void usage(char *argv[], bool verbose) {
 		fprintf(stderr, "\t   --timer=<seconds>          Interval timer for verbose updates [default=%u]\n", ctx.opt_timer);
 		fprintf(stderr, "\t   --[no-]unsafe              Reindex imprints based on empty/unsafe signature groups [default=%s]\n", (ctx.flags & context_t::MAGICMASK_UNSAFE) ? "enabled" : "disabled");
 		fprintf(stderr, "\t-v --verbose                  Say more\n");
+		fprintf(stderr, "\t   --verify[=<threads>]       Verify input checksums before use, otherwise on first copy\n");
 	}
 }
 
@@ -696,12 +699,16 @@ int main(int argc, char *argv[]) {
 			// long-only opts
 			LO_ANALYSE = 1,
 			LO_DEBUG,
+			LO_COMPRESS,
 			LO_FORCE,
 			LO_GENERATE,
+			LO_GROW,
 			LO_HINTINDEXSIZE,
 			LO_LOAD,
 			LO_MAXHINT,
+			LO_NOCOMPRESS,
 			LO_NOGENERATE,
+			LO_NOGROW,
 			LO_NOPARANOID,
 			LO_NOPURE,
 			LO_NOSAVEINDEX,
@@ -714,6 +721,7 @@ int main(int argc, char *argv[]) {
 			LO_TEXT,
 			LO_TIMER,
 			LO_UNSAFE,
+			LO_VERIFY,
 			// short opts
 			LO_HELP    = 'h',
 			LO_QUIET   = 'q',
@@ -725,15 +733,19 @@ int main(int argc, char *argv[]) {
 			/* name, has_arg, flag, val */
 			{"analyse",       1, 0, LO_ANALYSE},
 			{"debug",         1, 0, LO_DEBUG},
+			{"compress",      0, 0, LO_COMPRESS},
 			{"force",         0, 0, LO_FORCE},
 			{"generate",      0, 0, LO_GENERATE},
+			{"grow",          0, 0, LO_GROW},
 			{"help",          0, 0, LO_HELP},
 			{"hintindexsize", 1, 0, LO_HINTINDEXSIZE},
 			{"load",          1, 0, LO_LOAD},
 			{"maxhint",       1, 0, LO_MAXHINT},
 			{"paranoid",      0, 0, LO_PARANOID},
 			{"pure",          0, 0, LO_PURE},
+			{"no-compress",   0, 0, LO_NOCOMPRESS},
 			{"no-generate",   0, 0, LO_NOGENERATE},
+			{"no-grow",       0, 0, LO_NOGROW},
 			{"no-paranoid",   0, 0, LO_NOPARANOID},
 			{"no-pure",       0, 0, LO_NOPURE},
 			{"no-saveindex",  0, 0, LO_NOSAVEINDEX},
@@ -746,6 +758,7 @@ int main(int argc, char *argv[]) {
 			{"timer",         1, 0, LO_TIMER},
 			{"unsafe",        0, 0, LO_UNSAFE},
 			{"verbose",       2, 0, LO_VERBOSE},
+			{"verify",        2, 0, LO_VERIFY},
 			//
 			{NULL,            0, 0, 0}
 		};
@@ -780,12 +793,18 @@ int main(int argc, char *argv[]) {
 		case LO_DEBUG:
 			ctx.opt_debug = ::strtoul(optarg, NULL, 0);
 			break;
+		case LO_COMPRESS:
+			app.opt_compress++;
+			break;
 		case LO_FORCE:
 			app.opt_force++;
 			break;
 		case LO_GENERATE:
 			app.opt_generate++;
 			break;
+		case LO_GROW:
+			app.opt_grow++;
+			break;
 		case LO_HELP:
 			usage(argv, true);
 			exit(0);
@@ -798,9 +817,15 @@ int main(int argc, char *argv[]) {
 		case LO_MAXHINT:
 			app.opt_maxHint = ctx.nextPrime(::strtod(optarg, NULL));
 			break;
+		case LO_NOCOMPRESS:
+			app.opt_compress = 0;
+			break;
 		case LO_NOGENERATE:
 			app.opt_generate = 0;
 			break;
+		case LO_NOGROW:
+			app.opt_grow = 0;
+			break;
 		case LO_NOPARANOID:
 			ctx.flags &= ~context_t::MAGICMASK_PARANOID;
 			break;
@@ -898,6 +923,9 @@ int main(int argc, char *argv[]) {
 		case LO_VERBOSE:
 			ctx.opt_verbose = optarg ? ::strtoul(optarg, NULL, 0) : ctx.opt_verbose + 1;
 			break;
+		case LO_VERIFY:
+			app.opt_verify = optarg ? (unsigned) ::strtoul(optarg, NULL, 0) : (unsigned) sysconf(_SC_NPROCESSORS_ONLN);
+			break;
 
 		case '?':
 			fprintf(stderr, "Try `%s --help' for more information.\n", argv[0]);
@@ -967,6 +995,12 @@ int main(int argc, char *argv[]) {
 
 	db.open(app.arg_inputDatabase);
 
+	// sections copied/scanned during startup, evaluators are fully used
+	db.adviseSections(database_t::ALLOCMASK_SIGNATURE | database_t::ALLOCMASK_HINT, database_t::ACCESS_SEQUENTIAL);
+	db.adviseSections(database_t::ALLOCMASK_EVALUATOR, database_t::ACCESS_WILLNEED);
+
+	app.verifyDatabaseSections(db);
+
 	// display system flags when database was created
 	if (ctx.opt_verbose >= ctx.VERBOSE_WARNING) {
 		char dbText[128], ctxText[128];
@@ -1064,6 +1098,9 @@ int main(int argc, char *argv[]) {
 	if (app.rebuildSections)
 		store.rebuildIndices(app.rebuildSections);
 
+	// shared input sections must be verified before lookups
+	app.waitVerifySections();
+
 	/*
 	 * Where to look for new candidates
 	 */
@@ -0,0 +1,1435 @@
+//#pragma GCC optimize ("O0") // optimize on demand
+
+/*
+ * @date 2026-10-17 22:04:37
+ *
+ * `genimport` is the counterpart of `genexport`.
+ * It restores a database from the text sections and json manifest written by `genexport`.
+ *
+ * Sections are read in full and split into chunks at line boundaries.
+ * Workers first count lines per chunk, which gives every chunk the id of its first record.
+ * Then workers parse chunks directly into their final position, together with a partial crc.
+ * Partial crc's are combined in chunk order and compared against the manifest.
+ *
+ * Imprints are evaluated by workers in batches and added in sid order by the main thread while the next batch is evaluated.
+ * Member `sid`/`tid` are not part of the export and are resolved with a read-only associative lookup.
+ * The member crc includes them, which makes it a check on the resolve.
+ * `tid` depends on the imprints present, the interleave is taken from the manifest when `genexport` recorded it.
+ *
+ * The output is identical to a serial run and independent of `--threads`.
+ *
+ * Not part of the export and left empty:
+ *   - hints
+ *   - swap id's of signatures
+ *   - member heads/tails and pairs, run `"genmember <output.db> <numNode> <new.db> --no-generate"` to recreate them.
+ */
+
+/*
+ *	This file is part of Untangle, Information in fractal structures.
+ *	Copyright (C) 2017-2021, xyzzy@rockingship.org
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <assert.h>
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <jansson.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/sysinfo.h>
+#include <unistd.h>
+#include "database.h"
+#include "dbtool.h"
+#include "metrics.h"
+#include "tinytree.h"
+
+/**
+ * @date 2026-10-17 22:04:37
+ *
+ * Main program logic as application context
+ * It is contained as an independent `struct` so it can be easily included into projects/code
+ *
+ * @typedef {object}
+ */
+struct genimportContext_t : dbtool_t {
+
+	enum {
+		/// @constant {number} - Minimal size of a section chunk
+		CHUNKMINSIZE    = 1 << 20,
+		/// @constant {number} - Chunks per worker, for load balancing
+		CHUNKPERTHREAD  = 8,
+		/// @constant {number} - Footprints per imprint batch
+		IMPRINTBATCHROW = 1 << 18,
+	};
+
+	enum {
+		/// @constant {number} - Job types for workers
+		JOB_COUNT     = 1,
+		JOB_SIGNATURE = 2,
+		JOB_SWAP      = 3,
+		JOB_IMPRINT   = 4,
+		JOB_MEMBER    = 5,
+	};
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Line range of a section file
+	 */
+	struct importChunk_t {
+		/// @var {number} offset of first line
+		size_t   begin;
+		/// @var {number} offset of end
+		size_t   end;
+		/// @var {number} record id of first line
+		unsigned firstRecord;
+		/// @var {number} number of lines
+		unsigned numLine;
+		/// @var {number} crc of chunk records
+		uint32_t crc;
+		/// @var {number} number of bytes in crc
+		uint64_t crcLength;
+	};
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Section as described by the manifest
+	 */
+	struct importSection_t {
+		/// @var {string} name of section in manifest
+		const char    *pName;
+		/// @var {string} name of text file, NULL if absent
+		const char    *pFilename;
+		/// @var {number} number of records according to manifest
+		unsigned      numRecord;
+		/// @var {number} crc according to manifest
+		uint32_t      crc;
+		/// @var {string} file contents
+		char          *pData;
+		/// @var {number} length of file contents
+		size_t        dataLength;
+		/// @var {number} number of chunks
+		unsigned      numChunk;
+		/// @var {importChunk_t[]} chunks
+		importChunk_t *pChunks;
+	};
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Worker thread with private evaluator
+	 */
+	struct importWorker_t {
+		/// @var {genimportContext_t} owner
+		genimportContext_t *pApp;
+		/// @var {pthread_t} thread handle
+		pthread_t          thread;
+		/// @var {footprint_t[]} private compact evaluator
+		footprint_t        *pEvaluator;
+	};
+
+	/// @var {string} name of input database
+	const char *arg_inputDatabase;
+	/// @var {string} name of json manifest
+	const char *arg_jsonName;
+	/// @var {string} name of output database
+	const char *arg_outputDatabase;
+	/// @var {number} --force, force overwriting of database if already exists
+	unsigned   opt_force;
+	/// @var {number} --threads, number of worker threads, 0 for serial
+	unsigned   opt_threads;
+
+	/// @var {database_t} - Database store to place results
+	database_t *pStore;
+
+	/// @var {importSection_t} - `signature` section
+	importSection_t sectionSignature;
+	/// @var {importSection_t} - `swap` section
+	importSection_t sectionSwap;
+	/// @var {importSection_t} - `member` section
+	importSection_t sectionMember;
+
+	/// @var {signature_t[]} - signatures parsed before `store` exists
+	signature_t     *pSignatures;
+	/// @var {number} - largest signature size, to select metrics
+	unsigned        maxSize;
+
+	/// @var {importWorker_t[]} - workers, at least one
+	importWorker_t  *pWorkers;
+	/// @var {number} - number of workers
+	unsigned        numWorker;
+	/// @var {number} - type of job being processed
+	unsigned        jobType;
+	/// @var {number} - next job to be claimed
+	unsigned        jobNext;
+	/// @var {number} - end of jobs
+	unsigned        jobLast;
+	/// @var {importSection_t} - section of `JOB_COUNT` and parse jobs
+	importSection_t *pJobSection;
+	/// @var {number} - first sid of imprint job
+	unsigned        jobSidLo;
+	/// @var {footprint_t[]} - imprint footprints of job, `numImprintRow()` per sid
+	footprint_t     *pJobRows;
+	/// @var {number} - members not found by associative lookup
+	unsigned        numNotFound;
+
+	/**
+	 * Constructor
+	 */
+	genimportContext_t(context_t &ctx) : dbtool_t(ctx) {
+		// arguments and options
+		arg_inputDatabase  = NULL;
+		arg_jsonName       = NULL;
+		arg_outputDatabase = NULL;
+		opt_force          = 0;
+		opt_threads        = 0;
+
+		pStore = NULL;
+
+		::memset(&sectionSignature, 0, sizeof(sectionSignature));
+		::memset(&sectionSwap, 0, sizeof(sectionSwap));
+		::memset(&sectionMember, 0, sizeof(sectionMember));
+		sectionSignature.pName = "signature";
+		sectionSwap.pName      = "swap";
+		sectionMember.pName    = "member";
+
+		pSignatures = NULL;
+		maxSize     = 0;
+		pWorkers    = NULL;
+		numWorker   = 0;
+		jobType     = 0;
+		jobNext     = 0;
+		jobLast     = 0;
+		pJobSection = NULL;
+		jobSidLo    = 0;
+		pJobRows    = NULL;
+		numNotFound = 0;
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Multiply two polynomials modulo the crc32c polynomial, bit-reflected
+	 *
+	 * @param {number} a - polynomial
+	 * @param {number} b - polynomial
+	 * @return {number} `a*b mod P`
+	 */
+	static uint32_t crc32Multiply(uint32_t a, uint32_t b) {
+		uint32_t product = 0;
+
+		for (uint32_t m = 1U << 31; m; m >>= 1) {
+			if (a & m)
+				product ^= b;
+			b = (b & 1) ? (b >> 1) ^ 0x82f63b78 : b >> 1;
+		}
+
+		return product;
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * crc of two concatenated byte streams, given their individual crc's.
+	 * crc with zero initial value is linear, `crc(A|B) = crc(A) * x^(8*length(B)) + crc(B)`
+	 *
+	 * @param {number} crcA - crc of first stream
+	 * @param {number} crcB - crc of second stream
+	 * @param {number} lengthB - length of second stream in bytes
+	 * @return {number} crc of concatenation
+	 */
+	static uint32_t crc32Combine(uint32_t crcA, uint32_t crcB, uint64_t lengthB) {
+		// `x^(2^k)` for `k=3` is `x^8`, one byte
+		uint32_t power = 1U << 30; // x^1
+		for (unsigned k = 0; k < 3; k++)
+			power = crc32Multiply(power, power);
+
+		// square-and-multiply `x^(8*lengthB)`
+		uint32_t shift = 1U << 31; // x^0
+		for (; lengthB; lengthB >>= 1) {
+			if (lengthB & 1)
+				shift = crc32Multiply(shift, power);
+			power = crc32Multiply(power, power);
+		}
+
+		return crc32Multiply(crcA, shift) ^ crcB;
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Same as `genexportContext_t::crc32Name()`
+	 */
+	static inline uint32_t crc32Name(uint32_t crc32, const char *pName, uint64_t *pLength) {
+		while (*pName) {
+			__asm__ __volatile__ ("crc32b %1, %0" : "+r"(crc32) : "rm"(*pName));
+			pName++;
+			++*pLength;
+		}
+		return crc32;
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Read manifest entry of section
+	 *
+	 * @param {json_t} jManifest - manifest
+	 * @param {importSection_t} pSection - section to set
+	 */
+	void loadManifestSection(json_t *jManifest, importSection_t *pSection) {
+		json_t *jSection = json_object_get(jManifest, pSection->pName);
+		if (!jSection)
+			return; // absent
+
+		json_t *jFilename = json_object_get(jSection, "filename");
+		json_t *jCount    = json_object_get(jSection, "count");
+		json_t *jCrc      = json_object_get(jSection, "crc");
+
+		if (!json_is_string(jFilename) || !json_is_integer(jCount) || !json_is_integer(jCrc))
+			ctx.fatal("\n{\"error\":\"incomplete manifest section\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"section\":\"%s\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__, arg_jsonName, pSection->pName);
+
+		pSection->pFilename = ::strdup(json_string_value(jFilename));
+		pSection->numRecord = json_integer_value(jCount);
+		pSection->crc       = json_integer_value(jCrc);
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Read section file and split into chunks at line boundaries
+	 *
+	 * @param {importSection_t} pSection - section to load
+	 */
+	void loadSectionFile(importSection_t *pSection) {
+		int hndl = ::open(pSection->pFilename, O_RDONLY);
+		if (hndl == -1)
+			ctx.fatal("\n{\"error\":\"fopen('%s') failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  pSection->pFilename, __FUNCTION__, __FILE__, __LINE__);
+
+		struct stat sbuf;
+		if (::fstat(hndl, &sbuf))
+			ctx.fatal("\n{\"error\":\"fstat('%s') failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  pSection->pFilename, __FUNCTION__, __FILE__, __LINE__);
+
+		pSection->dataLength = sbuf.st_size;
+		pSection->pData      = (char *) ctx.myAlloc("genimportContext_t::pData", pSection->dataLength + 1, 1);
+
+		for (size_t done = 0; done < pSection->dataLength;) {
+			ssize_t ret = ::read(hndl, pSection->pData + done, pSection->dataLength - done);
+			if (ret <= 0)
+				ctx.fatal("\n{\"error\":\"read('%s') failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  pSection->pFilename, __FUNCTION__, __FILE__, __LINE__);
+			done += ret;
+		}
+		::close(hndl);
+
+		// terminator for the last line
+		pSection->pData[pSection->dataLength] = 0;
+
+		// split
+		size_t chunkSize = pSection->dataLength / (numWorker * CHUNKPERTHREAD);
+		if (chunkSize < CHUNKMINSIZE)
+			chunkSize = CHUNKMINSIZE;
+
+		pSection->numChunk = pSection->dataLength / chunkSize + 1;
+		pSection->pChunks  = (importChunk_t *) ctx.myAlloc("genimportContext_t::pChunks", pSection->numChunk, sizeof(*pSection->pChunks));
+
+		size_t   pos      = 0;
+		unsigned numChunk = 0;
+		while (pos < pSection->dataLength) {
+			size_t end = pos + chunkSize;
+
+			if (end >= pSection->dataLength) {
+				end = pSection->dataLength;
+			} else {
+				const char *pEol = (const char *) ::memchr(pSection->pData + end, '\n', pSection->dataLength - end);
+				end = pEol ? pEol - pSection->pData + 1 : pSection->dataLength;
+			}
+
+			assert(numChunk < pSection->numChunk);
+			pSection->pChunks[numChunk].begin = pos;
+			pSection->pChunks[numChunk].end   = end;
+			numChunk++;
+
+			pos = end;
+		}
+		pSection->numChunk = numChunk;
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Release section resources
+	 *
+	 * @param {importSection_t} pSection - section to release
+	 */
+	void freeSection(importSection_t *pSection) {
+		if (pSection->pChunks)
+			ctx.myFree("genimportContext_t::pChunks", pSection->pChunks);
+		if (pSection->pData)
+			ctx.myFree("genimportContext_t::pData", pSection->pData);
+		pSection->pChunks = NULL;
+		pSection->pData   = NULL;
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Count lines of chunk
+	 *
+	 * @param {importChunk_t} pChunk - chunk
+	 */
+	void countChunk(const importSection_t *pSection, importChunk_t *pChunk) {
+		unsigned   numLine = 0;
+		const char *p      = pSection->pData + pChunk->begin;
+		const char *pEnd   = pSection->pData + pChunk->end;
+
+		while (p < pEnd) {
+			const char *pEol = (const char *) ::memchr(p, '\n', pEnd - p);
+			numLine++;
+			if (!pEol)
+				break;
+			p = pEol + 1;
+		}
+
+		pChunk->numLine = numLine;
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Split line into tab separated fields, in place
+	 *
+	 * @param {string} pLine - line, will be modified
+	 * @param {string[]} pFields - (output) fields
+	 * @param {number} maxField - maximum number of fields
+	 * @return {number} number of fields
+	 */
+	static unsigned splitLine(char *pLine, char **pFields, unsigned maxField) {
+		unsigned numField = 0;
+
+		for (;;) {
+			if (numField >= maxField)
+				return maxField + 1; // too many
+			pFields[numField++] = pLine;
+
+			while (*pLine && *pLine != '\t' && *pLine != '\n')
+				pLine++;
+
+			if (*pLine != '\t') {
+				*pLine = 0;
+				return numField;
+			}
+			*pLine++ = 0;
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Count placeholders, endpoints and back-references of a name, like `signaturesFromFile()`
+	 */
+	static void countName(const char *pName, unsigned *pPlaceholder, unsigned *pEndpoint, unsigned *pBackRef) {
+		unsigned numPlaceholder = 0, numEndpoint = 0, numBackRef = 0;
+		unsigned beenThere      = 0;
+
+		for (const char *p = pName; *p; p++) {
+			if (::islower(*p)) {
+				if (!(beenThere & (1 << (*p - 'a')))) {
+					numPlaceholder++;
+					beenThere |= 1 << (*p - 'a');
+				}
+				numEndpoint++;
+			} else if (::isdigit(*p) && *p != '0') {
+				numBackRef++;
+			}
+		}
+
+		*pPlaceholder = numPlaceholder;
+		*pEndpoint    = numEndpoint;
+		*pBackRef     = numBackRef;
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Parse chunk of signatures into `pSignatures[]`
+	 *
+	 * Line format: `<name> <tab> <flags>`
+	 *
+	 * @param {importSection_t} pSection - section
+	 * @param {importChunk_t} pChunk - chunk
+	 */
+	void parseSignatureChunk(importSection_t *pSection, importChunk_t *pChunk) {
+		tinyTree_t tree(ctx);
+		uint32_t   crc32  = 0;
+		uint64_t   length = 0;
+		char       *p     = pSection->pData + pChunk->begin;
+		char       *pFields[3];
+
+		for (unsigned iLine = 0; iLine < pChunk->numLine; iLine++) {
+			char *pEol = ::strchr(p, '\n');
+			if (pEol)
+				*pEol = 0;
+
+			unsigned    sid       = pChunk->firstRecord + iLine;
+			signature_t *pSignature = pSignatures + sid;
+
+			if (splitLine(p, pFields, 2) != 2 || !*pFields[0] || ::strlen(pFields[0]) >= signature_t::SIGNATURENAMELENGTH)
+				ctx.fatal("\n{\"error\":\"bad line\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"linenr\":%u}\n",
+					  __FUNCTION__, __FILE__, __LINE__, pSection->pFilename, sid);
+
+			::strcpy(pSignature->name, pFields[0]);
+
+			for (const char *pFlag = pFields[1]; *pFlag; pFlag++) {
+				switch (*pFlag) {
+				case 'S':
+					pSignature->flags |= signature_t::SIGMASK_SAFE;
+					break;
+				case 'P':
+					pSignature->flags |= signature_t::SIGMASK_PROVIDES;
+					break;
+				case 'R':
+					pSignature->flags |= signature_t::SIGMASK_REQUIRED;
+					break;
+				default:
+					ctx.fatal("\n{\"error\":\"bad flag\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"linenr\":%u,\"flag\":\"%c\"}\n",
+						  __FUNCTION__, __FILE__, __LINE__, pSection->pFilename, sid, *pFlag);
+				}
+			}
+
+			tree.loadStringFast(pSignature->name);
+
+			unsigned numPlaceholder, numEndpoint, numBackRef;
+			countName(pSignature->name, &numPlaceholder, &numEndpoint, &numBackRef);
+
+			pSignature->size           = tree.count - tinyTree_t::TINYTREE_NSTART;
+			pSignature->numPlaceholder = numPlaceholder;
+			pSignature->numEndpoint    = numEndpoint;
+			pSignature->numBackRef     = numBackRef;
+
+			// update crc
+			crc32 = crc32Name(crc32, pSignature->name, &length);
+			__asm__ __volatile__ ("crc32b %1, %0" : "+r"(crc32) : "rm"(pSignature->flags));
+			length++;
+
+			p = pEol + 1;
+		}
+
+		pChunk->crc       = crc32;
+		pChunk->crcLength = length;
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Parse chunk of swaps into `pStore->swaps[]`
+	 *
+	 * Line format: `<transform> [ <tab> <transform> ... ]`
+	 *
+	 * @param {importSection_t} pSection - section
+	 * @param {importChunk_t} pChunk - chunk
+	 */
+	void parseSwapChunk(importSection_t *pSection, importChunk_t *pChunk) {
+		uint32_t crc32  = 0;
+		uint64_t length = 0;
+		char     *p     = pSection->pData + pChunk->begin;
+		char     *pFields[swap_t::MAXENTRY];
+
+		for (unsigned iLine = 0; iLine < pChunk->numLine; iLine++) {
+			char *pEol = ::strchr(p, '\n');
+			if (pEol)
+				*pEol = 0;
+
+			unsigned iSwap    = pChunk->firstRecord + iLine;
+			swap_t   *pSwap   = pStore->swaps + iSwap;
+			unsigned numField = splitLine(p, pFields, swap_t::MAXENTRY);
+
+			if (numField > swap_t::MAXENTRY)
+				ctx.fatal("\n{\"error\":\"bad line\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"linenr\":%u}\n",
+					  __FUNCTION__, __FILE__, __LINE__, pSection->pFilename, iSwap);
+
+			::memset(pSwap, 0, sizeof(*pSwap));
+			for (unsigned j = 0; j < numField; j++) {
+				// empty swap
+				if (!*pFields[j])
+					continue;
+
+				unsigned tid = pStore->lookupFwdTransform(pFields[j]);
+				if (tid >= pStore->numTransform || ::strcmp(pStore->fwdTransformNames[tid], pFields[j]) != 0)
+					ctx.fatal("\n{\"error\":\"unknown transform\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"linenr\":%u,\"name\":\"%s\"}\n",
+						  __FUNCTION__, __FILE__, __LINE__, pSection->pFilename, iSwap, pFields[j]);
+
+				pSwap->tids[j] = tid;
+
+				// update crc
+				crc32 = crc32Name(crc32, pFields[j], &length);
+			}
+
+			p = pEol + 1;
+		}
+
+		pChunk->crc       = crc32;
+		pChunk->crcLength = length;
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Parse chunk of members into `pStore->members[]` and resolve their `sid`/`tid`
+	 *
+	 * Line format: `<name> <tab> <flags>`
+	 *
+	 * @param {importSection_t} pSection - section
+	 * @param {importChunk_t} pChunk - chunk
+	 * @param {footprint_t[]} pEvaluator - private evaluator from `copyAssociativeEvaluator()`
+	 */
+	void parseMemberChunk(importSection_t *pSection, importChunk_t *pChunk, footprint_t *pEvaluator) {
+		tinyTree_t tree(ctx);
+		uint32_t   crc32  = 0;
+		uint64_t   length = 0;
+		char       *p     = pSection->pData + pChunk->begin;
+		char       *pFields[3];
+		unsigned   notFound = 0;
+		uint64_t   cntHash = 0, cntCompare = 0;
+
+		for (unsigned iLine = 0; iLine < pChunk->numLine; iLine++) {
+			char *pEol = ::strchr(p, '\n');
+			if (pEol)
+				*pEol = 0;
+
+			unsigned iMid     = pChunk->firstRecord + iLine;
+			member_t *pMember = pStore->members + iMid;
+
+			if (splitLine(p, pFields, 2) != 2 || !*pFields[0] || ::strlen(pFields[0]) >= signature_t::SIGNATURENAMELENGTH)
+				ctx.fatal("\n{\"error\":\"bad line\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"linenr\":%u}\n",
+					  __FUNCTION__, __FILE__, __LINE__, pSection->pFilename, iMid);
+
+			::memset(pMember, 0, sizeof(*pMember));
+			::strcpy(pMember->name, pFields[0]);
+
+			for (const char *pFlag = pFields[1]; *pFlag; pFlag++) {
+				switch (*pFlag) {
+				case 'S':
+					pMember->flags |= member_t::MEMMASK_SAFE;
+					break;
+				case 'C':
+					pMember->flags |= member_t::MEMMASK_COMP;
+					break;
+				case 'L':
+					pMember->flags |= member_t::MEMMASK_LOCKED;
+					break;
+				case 'D':
+					pMember->flags |= member_t::MEMMASK_DEPR;
+					break;
+				case 'X':
+					pMember->flags |= member_t::MEMMASK_DELETE;
+					break;
+				default:
+					ctx.fatal("\n{\"error\":\"bad flag\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"linenr\":%u,\"flag\":\"%c\"}\n",
+						  __FUNCTION__, __FILE__, __LINE__, pSection->pFilename, iMid, *pFlag);
+				}
+			}
+
+			tree.loadStringFast(pMember->name);
+
+			unsigned numPlaceholder, numEndpoint, numBackRef;
+			countName(pMember->name, &numPlaceholder, &numEndpoint, &numBackRef);
+
+			pMember->size           = tree.count - tinyTree_t::TINYTREE_NSTART;
+			pMember->numPlaceholder = numPlaceholder;
+			pMember->numEndpoint    = numEndpoint;
+			pMember->numBackRef     = numBackRef;
+
+			// store is read-only during this phase
+			unsigned sid = 0, tid = 0;
+			if (!pStore->lookupImprintAssociativeCompact(&tree, pEvaluator, &sid, &tid, cntHash, cntCompare))
+				notFound++;
+			pMember->sid = sid;
+			pMember->tid = tid;
+
+			// update crc
+			__asm__ __volatile__ ("crc32l %1, %0" : "+r"(crc32) : "rm"(pMember->sid));
+			__asm__ __volatile__ ("crc32l %1, %0" : "+r"(crc32) : "rm"(pMember->tid));
+			crc32 = crc32Name(crc32, pMember->name, &length);
+			__asm__ __volatile__ ("crc32b %1, %0" : "+r"(crc32) : "rm"(pMember->flags));
+			length += 2 * sizeof(uint32_t) + 1;
+
+			p = pEol + 1;
+		}
+
+		pChunk->crc       = crc32;
+		pChunk->crcLength = length;
+
+		__atomic_fetch_add(&numNotFound, notFound, __ATOMIC_RELAXED);
+		__atomic_fetch_add(&ctx.cntHash, cntHash, __ATOMIC_RELAXED);
+		__atomic_fetch_add(&ctx.cntCompare, cntCompare, __ATOMIC_RELAXED);
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Evaluate imprint footprints of one sid of the current imprint job
+	 *
+	 * @param {number} iSid - signature id
+	 * @param {footprint_t[]} pEvaluator - private evaluator from `copyImprintEvaluator()`
+	 */
+	void evalImprintJob(unsigned iSid, footprint_t *pEvaluator) {
+		tinyTree_t tree(ctx);
+
+		tree.loadStringFast(pStore->signatures[iSid].name);
+		pStore->evalImprintRows(&tree, pEvaluator, pJobRows + (size_t) (iSid - jobSidLo) * pStore->numImprintRow());
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Claim and process jobs
+	 *
+	 * @param {importWorker_t} pWorker - worker with private evaluator
+	 */
+	void jobWorker(importWorker_t *pWorker) {
+		for (;;) {
+			unsigned iJob = __atomic_fetch_add(&jobNext, 1, __ATOMIC_RELAXED);
+			if (iJob >= jobLast)
+				break;
+
+			switch (jobType) {
+			case JOB_COUNT:
+				countChunk(pJobSection, pJobSection->pChunks + iJob);
+				break;
+			case JOB_SIGNATURE:
+				parseSignatureChunk(pJobSection, pJobSection->pChunks + iJob);
+				break;
+			case JOB_SWAP:
+				parseSwapChunk(pJobSection, pJobSection->pChunks + iJob);
+				break;
+			case JOB_IMPRINT:
+				evalImprintJob(iJob, pWorker->pEvaluator);
+				break;
+			case JOB_MEMBER:
+				parseMemberChunk(pJobSection, pJobSection->pChunks + iJob, pWorker->pEvaluator);
+				break;
+			default:
+				assert(0);
+			}
+		}
+	}
+
+	/**
+	 * pthread entry point
+	 */
+	static void *jobEntry(void *arg) {
+		importWorker_t *pWorker = (importWorker_t *) arg;
+		pWorker->pApp->jobWorker(pWorker);
+		return NULL;
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Start workers on jobs `jobLo..jobHi`. Serial runs complete the jobs before returning.
+	 *
+	 * @param {number} type - `JOB_*`
+	 * @param {number} jobLo - first job
+	 * @param {number} jobHi - end job
+	 */
+	void startJobs(unsigned type, unsigned jobLo, unsigned jobHi) {
+		jobType = type;
+		jobNext = jobLo;
+		jobLast = jobHi;
+
+		if (opt_threads == 0) {
+			jobWorker(pWorkers);
+			return;
+		}
+
+		for (unsigned iWorker = 0; iWorker < numWorker; iWorker++) {
+			int ret = pthread_create(&pWorkers[iWorker].thread, NULL, jobEntry, pWorkers + iWorker);
+			if (ret)
+				ctx.fatal("\n{\"error\":\"pthread_create() failed\",\"where\":\"%s:%s:%d\",\"return\":%d}\n",
+					  __FUNCTION__, __FILE__, __LINE__, ret);
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Wait for `startJobs()` to complete
+	 */
+	void joinJobs(void) {
+		if (opt_threads == 0)
+			return;
+
+		for (unsigned iWorker = 0; iWorker < numWorker; iWorker++)
+			pthread_join(pWorkers[iWorker].thread, NULL);
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Count lines, assign record ids to chunks and parse.
+	 * Verify number of records and combined crc against manifest.
+	 *
+	 * @param {importSection_t} pSection - section
+	 * @param {number} type - `JOB_*` parser
+	 */
+	void importSection(importSection_t *pSection, unsigned type) {
+		// database without the section, `genexport` writes an empty file
+		if (pSection->numRecord == 0)
+			return;
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "[%s] Importing %s from \"%s\"\n", ctx.timeAsString(), pSection->pName, pSection->pFilename);
+
+		loadSectionFile(pSection);
+		pJobSection = pSection;
+
+		startJobs(JOB_COUNT, 0, pSection->numChunk);
+		joinJobs();
+
+		// first record is reserved
+		unsigned numRecord = 1;
+		for (unsigned iChunk = 0; iChunk < pSection->numChunk; iChunk++) {
+			pSection->pChunks[iChunk].firstRecord = numRecord;
+			numRecord += pSection->pChunks[iChunk].numLine;
+		}
+
+		if (numRecord - 1 != pSection->numRecord)
+			ctx.fatal("\n{\"error\":\"record count mismatch\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"expected\":%u,\"encountered\":%u}\n",
+				  __FUNCTION__, __FILE__, __LINE__, pSection->pFilename, pSection->numRecord, numRecord - 1);
+
+		startJobs(type, 0, pSection->numChunk);
+		joinJobs();
+
+		uint32_t crc32 = 0;
+		for (unsigned iChunk = 0; iChunk < pSection->numChunk; iChunk++)
+			crc32 = crc32Combine(crc32, pSection->pChunks[iChunk].crc, pSection->pChunks[iChunk].crcLength);
+
+		if (crc32 != pSection->crc)
+			ctx.fatal("\n{\"error\":\"crc mismatch\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"expected\":%u,\"encountered\":%u}\n",
+				  __FUNCTION__, __FILE__, __LINE__, pSection->pFilename, pSection->crc, crc32);
+
+		freeSection(pSection);
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Create imprints for all signatures.
+	 * Workers evaluate the footprints of the next batch while the current batch is added in sid order.
+	 * Imprints are identical to `gensignatureContext_t::rebuildImprints()`.
+	 */
+	void importImprints(void) {
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "[%s] Rebuilding imprints\n", ctx.timeAsString());
+
+		::memset(pStore->imprintIndex, 0, pStore->imprintIndexSize * sizeof(*pStore->imprintIndex));
+		pStore->clearImprintFilter();
+		pStore->numImprint = 1; // skip reserved entry
+
+		unsigned numRow     = pStore->numImprintRow();
+		unsigned batchSize  = IMPRINTBATCHROW / numRow ? IMPRINTBATCHROW / numRow : 1;
+		footprint_t *pRows[2];
+
+		pRows[0] = (footprint_t *) ctx.myAlloc("genimportContext_t::pRows", (size_t) batchSize * numRow, sizeof(footprint_t));
+		pRows[1] = (footprint_t *) ctx.myAlloc("genimportContext_t::pRows", (size_t) batchSize * numRow, sizeof(footprint_t));
+
+		for (unsigned iWorker = 0; iWorker < numWorker; iWorker++)
+			pStore->copyImprintEvaluator(pWorkers[iWorker].pEvaluator);
+
+		ctx.setupSpeed(pStore->numSignature);
+		ctx.tick     = 0;
+		ctx.progress = 1;
+
+		unsigned iBuffer = 0;
+		unsigned batchLo = 1;
+		unsigned batchHi = batchLo + batchSize < pStore->numSignature ? batchLo + batchSize : pStore->numSignature;
+
+		// first batch
+		jobSidLo = batchLo;
+		pJobRows = pRows[iBuffer];
+		startJobs(JOB_IMPRINT, batchLo, batchHi);
+		joinJobs();
+
+		while (batchLo < batchHi) {
+			// start evaluating next batch
+			unsigned nextLo = batchHi;
+			unsigned nextHi = nextLo + batchSize < pStore->numSignature ? nextLo + batchSize : pStore->numSignature;
+
+			if (nextLo < nextHi) {
+				jobSidLo = nextLo;
+				pJobRows = pRows[iBuffer ^ 1];
+				startJobs(JOB_IMPRINT, nextLo, nextHi);
+			}
+
+			// add current batch
+			const footprint_t *pBatch = pRows[iBuffer];
+			for (unsigned iSid = batchLo; iSid < batchHi; iSid++) {
+				// index is random access, start loading the slots of the next signature
+				if (iSid + 1 < batchHi) {
+					const footprint_t *pNext = pBatch + (size_t) (iSid + 1 - batchLo) * numRow;
+					for (unsigned iRow = 0; iRow < numRow; iRow++)
+						__builtin_prefetch(pStore->imprintIndex + pNext[iRow].crc32() % pStore->imprintIndexSize);
+				}
+
+				unsigned ret = pStore->addImprintRows(pBatch + (size_t) (iSid - batchLo) * numRow, iSid);
+				if (ret != 0)
+					ctx.fatal("\n{\"error\":\"duplicate signature\",\"where\":\"%s:%s:%d\",\"sid\":%u,\"name\":\"%s\",\"oldsid\":%u,\"oldname\":\"%s\"}\n",
+						  __FUNCTION__, __FILE__, __LINE__, iSid, pStore->signatures[iSid].name, ret, pStore->signatures[ret].name);
+			}
+
+			if (nextLo < nextHi)
+				joinJobs();
+
+			ctx.progress = batchHi;
+			if (ctx.opt_verbose >= ctx.VERBOSE_TICK && ctx.tick) {
+				int perSecond = ctx.updateSpeed();
+
+				fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) %.5f%% | numImprint=%u(%.0f%%) | hash=%.3f",
+					ctx.timeAsString(), ctx.progress, perSecond, ctx.progress * 100.0 / ctx.progressHi,
+					pStore->numImprint, pStore->numImprint * 100.0 / pStore->maxImprint,
+					(double) ctx.cntCompare / ctx.cntHash);
+
+				ctx.tick = 0;
+			}
+
+			iBuffer ^= 1;
+			batchLo = nextLo;
+			batchHi = nextHi;
+		}
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
+			fprintf(stderr, "\r\e[K");
+
+		ctx.myFree("genimportContext_t::pRows", pRows[1]);
+		ctx.myFree("genimportContext_t::pRows", pRows[0]);
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY)
+			fprintf(stderr, "[%s] Imprints built. numImprint=%u(%.0f%%) | hash=%.3f\n",
+				ctx.timeAsString(),
+				pStore->numImprint, pStore->numImprint * 100.0 / pStore->maxImprint,
+				(double) ctx.cntCompare / ctx.cntHash);
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Import members, index them and string them to their signatures, like `genmemberContext_t::finaliseMembers()`
+	 */
+	void importMembers(void) {
+		for (unsigned iWorker = 0; iWorker < numWorker; iWorker++)
+			pStore->copyAssociativeEvaluator(pWorkers[iWorker].pEvaluator);
+
+		importSection(&sectionMember, JOB_MEMBER);
+		pStore->numMember = sectionMember.numRecord + 1;
+
+		if (numNotFound && ctx.opt_verbose >= ctx.VERBOSE_WARNING)
+			fprintf(stderr, "[%s] WARNING: %u members without signature\n", ctx.timeAsString(), numNotFound);
+
+		pStore->rebuildIndices(database_t::ALLOCMASK_MEMBERINDEX);
+
+		for (unsigned iSid = 0; iSid < pStore->numSignature; iSid++)
+			pStore->signatures[iSid].firstMember = 0;
+
+		// best one is first in list
+		for (unsigned iMid = pStore->numMember - 1; iMid >= 1; --iMid) {
+			member_t *pMember = pStore->members + iMid;
+
+			if (pMember->sid) {
+				signature_t *pSignature = pStore->signatures + pMember->sid;
+
+				pMember->nextMember     = pSignature->firstMember;
+				pSignature->firstMember = iMid;
+			}
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Allocate workers with an evaluator large enough for both imprint and associative rows
+	 *
+	 * @param {number} numRow - rows per evaluator
+	 */
+	void createWorkers(unsigned numRow) {
+		numWorker = opt_threads ? opt_threads : 1;
+		pWorkers  = (importWorker_t *) ctx.myAlloc("genimportContext_t::pWorkers", numWorker, sizeof(*pWorkers));
+
+		for (unsigned iWorker = 0; iWorker < numWorker; iWorker++) {
+			pWorkers[iWorker].pApp = this;
+			if (numRow)
+				pWorkers[iWorker].pEvaluator = (footprint_t *) ctx.myAlloc("genimportContext_t::pEvaluator", (size_t) numRow * tinyTree_t::TINYTREE_NEND, sizeof(footprint_t));
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 22:04:37
+	 *
+	 * Release workers
+	 */
+	void freeWorkers(void) {
+		for (unsigned iWorker = 0; iWorker < numWorker; iWorker++) {
+			if (pWorkers[iWorker].pEvaluator)
+				ctx.myFree("genimportContext_t::pEvaluator", pWorkers[iWorker].pEvaluator);
+		}
+		ctx.myFree("genimportContext_t::pWorkers", pWorkers);
+		pWorkers  = NULL;
+		numWorker = 0;
+	}
+};
+
+/*
+ * I/O context.
+ * Needs to be global to be accessible by signal handlers.
+ *
+ * @global {context_t} I/O context
+ */
+context_t ctx;
+
+/*
+ * Application context.
+ * Needs to be global to be accessible by signal handlers.
+ *
+ * @global {genimportContext_t} Application context
+ */
+genimportContext_t app(ctx);
+
+/**
+ * @date 2026-10-17 22:04:37
+ *
+ * Signal handler
+ *
+ * Delete partially created database unless explicitly requested
+ *
+ * @param {number} sig - signal (ignored)
+ */
+void sigintHandler(int __attribute__ ((unused)) sig) {
+	if (app.arg_outputDatabase) {
+		remove(app.arg_outputDatabase);
+	}
+	exit(1);
+}
+
+/**
+ * @date 2026-10-17 22:04:37
+ *
+ * Signal handlers
+ *
+ * Bump interval timer
+ *
+ * @param {number} sig - signal (ignored)
+ */
+void sigalrmHandler(int __attribute__ ((unused)) sig) {
+	if (ctx.opt_timer) {
+		ctx.tick++;
+		alarm(ctx.opt_timer);
+	}
+}
+
+/**
+ * @date 2026-10-17 22:04:37
+ *
+ * Program usage. Keep this directly above `main()`
+ *
+ * @param {string[]} argv - program arguments
+ * @param {boolean} verbose - set to true for option descriptions
+ */
+void usage(char *argv[], bool verbose) {
+	fprintf(stderr, "usage: %s <input.db> <export.json> <output.db>\n", argv[0]);
+
+	if (verbose) {
+		fprintf(stderr, "\n");
+		fprintf(stderr, "\t   --[no-]compress                 Save as block-compressed container [default=%s]\n", app.opt_compress ? "enabled" : "disabled");
+		fprintf(stderr, "\t   --force                         Force overwriting of database if already exists\n");
+		fprintf(stderr, "\t   --[no-]grow                     Grow full sections instead of \"storage full\" [default=%s]\n", app.opt_grow ? "enabled" : "disabled");
+		fprintf(stderr, "\t-h --help                          This list\n");
+		fprintf(stderr, "\t   --imprintindexsize=<number>     Size of imprint index [default=%u]\n", app.opt_imprintIndexSize);
+		fprintf(stderr, "\t   --interleave=<number>           Imprint index interleave [default=manifest]\n");
+		fprintf(stderr, "\t   --maximprint=<number>           Maximum number of imprints [default=%u]\n", app.opt_maxImprint);
+		fprintf(stderr, "\t-q --quiet                         Say less\n");
+		fprintf(stderr, "\t   --ratio=<number>                Index/data ratio [default=%.1f]\n", app.opt_ratio);
+		fprintf(stderr, "\t   --threads=<number>              Worker threads, 0=serial [default=%u]\n", app.opt_threads);
+		fprintf(stderr, "\t   --timer=<seconds>               Interval timer for verbose updates [default=%u]\n", ctx.opt_timer);
+		fprintf(stderr, "\t-v --verbose                       Say more\n");
+		fprintf(stderr, "\t   --verify[=<threads>]            Verify input checksums before use, otherwise on first copy\n");
+	}
+}
+
+/**
+ * @date 2026-10-17 22:04:37
+ *
+ * Program main entry point
+ * Process all user supplied arguments to construct a application context.
+ * Activate application context.
+ *
+ * @param  {number} argc - number of arguments
+ * @param  {string[]} argv - program arguments
+ * @return {number} 0 on normal return, non-zero when attention is required
+ */
+int main(int argc, char *argv[]) {
+	setlinebuf(stdout);
+
+	/*
+	 *  Process program options
+	 */
+	for (;;) {
+		// Long option shortcuts
+		enum {
+			// long-only opts
+			LO_DEBUG   = 1,
+			LO_COMPRESS,
+			LO_FORCE,
+			LO_GROW,
+			LO_IMPRINTINDEXSIZE,
+			LO_INTERLEAVE,
+			LO_MAXIMPRINT,
+			LO_NOCOMPRESS,
+			LO_NOGROW,
+			LO_RATIO,
+			LO_THREADS,
+			LO_TIMER,
+			LO_VERIFY,
+			// short opts
+			LO_HELP    = 'h',
+			LO_QUIET   = 'q',
+			LO_VERBOSE = 'v',
+		};
+
+		// long option descriptions
+		static struct option long_options[] = {
+			/* name, has_arg, flag, val */
+			{"debug",            1, 0, LO_DEBUG},
+			{"compress",         0, 0, LO_COMPRESS},
+			{"force",            0, 0, LO_FORCE},
+			{"grow",             0, 0, LO_GROW},
+			{"help",             0, 0, LO_HELP},
+			{"imprintindexsize", 1, 0, LO_IMPRINTINDEXSIZE},
+			{"interleave",       1, 0, LO_INTERLEAVE},
+			{"maximprint",       1, 0, LO_MAXIMPRINT},
+			{"no-compress",      0, 0, LO_NOCOMPRESS},
+			{"no-grow",          0, 0, LO_NOGROW},
+			{"quiet",            2, 0, LO_QUIET},
+			{"ratio",            1, 0, LO_RATIO},
+			{"threads",          1, 0, LO_THREADS},
+			{"timer",            1, 0, LO_TIMER},
+			{"verbose",          2, 0, LO_VERBOSE},
+			{"verify",           2, 0, LO_VERIFY},
+			//
+			{NULL,               0, 0, 0}
+		};
+
+		char optstring[64];
+		char *cp          = optstring;
+		int  option_index = 0;
+
+		/* construct optarg */
+		for (int i = 0; long_options[i].name; i++) {
+			if (isalpha(long_options[i].val)) {
+				*cp++ = (char) long_options[i].val;
+
+				if (long_options[i].has_arg != 0)
+					*cp++ = ':';
+				if (long_options[i].has_arg == 2)
+					*cp++ = ':';
+			}
+		}
+
+		*cp = '\0';
+
+		// parse long options
+		int c = getopt_long(argc, argv, optstring, long_options, &option_index);
+		if (c == -1)
+			break;
+
+		switch (c) {
+		case LO_DEBUG:
+			ctx.opt_debug = ::strtoul(optarg, NULL, 0);
+			break;
+		case LO_COMPRESS:
+			app.opt_compress++;
+			break;
+		case LO_FORCE:
+			app.opt_force++;
+			break;
+		case LO_GROW:
+			app.opt_grow++;
+			break;
+		case LO_HELP:
+			usage(argv, true);
+			exit(0);
+		case LO_IMPRINTINDEXSIZE:
+			app.opt_imprintIndexSize = ctx.nextPrime(::strtod(optarg, NULL));
+			break;
+		case LO_INTERLEAVE:
+			app.opt_interleave = ::strtoul(optarg, NULL, 0);
+			if (!getMetricsInterleave(MAXSLOTS, app.opt_interleave))
+				ctx.fatal("--interleave must be one of [%s]\n", getAllowedInterleaves(MAXSLOTS));
+			break;
+		case LO_MAXIMPRINT:
+			app.opt_maxImprint = ctx.dToMax(::strtod(optarg, NULL));
+			break;
+		case LO_NOCOMPRESS:
+			app.opt_compress = 0;
+			break;
+		case LO_NOGROW:
+			app.opt_grow = 0;
+			break;
+		case LO_QUIET:
+			ctx.opt_verbose = optarg ? ::strtoul(optarg, NULL, 0) : ctx.opt_verbose - 1;
+			break;
+		case LO_RATIO:
+			app.opt_ratio = strtof(optarg, NULL);
+			break;
+		case LO_THREADS:
+			app.opt_threads = ::strtoul(optarg, NULL, 0);
+			break;
+		case LO_TIMER:
+			ctx.opt_timer = ::strtoul(optarg, NULL, 0);
+			break;
+		case LO_VERBOSE:
+			ctx.opt_verbose = optarg ? ::strtoul(optarg, NULL, 0) : ctx.opt_verbose + 1;
+			break;
+		case LO_VERIFY:
+			app.opt_verify = optarg ? (unsigned) ::strtoul(optarg, NULL, 0) : (unsigned) sysconf(_SC_NPROCESSORS_ONLN);
+			break;
+
+		case '?':
+			fprintf(stderr, "Try `%s --help' for more information.\n", argv[0]);
+			exit(1);
+		default:
+			fprintf(stderr, "getopt_long() returned character code %d\n", c);
+			exit(1);
+		}
+	}
+
+	/*
+	 * Program arguments
+	 */
+	if (argc - optind >= 1)
+		app.arg_inputDatabase = argv[optind++];
+	if (argc - optind >= 1)
+		app.arg_jsonName = argv[optind++];
+	if (argc - optind >= 1)
+		app.arg_outputDatabase = argv[optind++];
+
+	if (app.arg_outputDatabase == NULL) {
+		usage(argv, false);
+		exit(1);
+	}
+
+	/*
+	 * None of the outputs may exist
+	 */
+
+	if (!app.opt_force) {
+		struct stat sbuf;
+
+		if (!stat(app.arg_outputDatabase, &sbuf)) {
+			fprintf(stderr, "%s already exists. Use --force to overwrite\n", app.arg_outputDatabase);
+			exit(1);
+		}
+	}
+
+	// register timer handler
+	if (ctx.opt_timer) {
+		signal(SIGALRM, sigalrmHandler);
+		::alarm(ctx.opt_timer);
+	}
+
+	/*
+	 * Load manifest
+	 */
+
+	json_error_t jError;
+	json_t       *jManifest = json_load_file(app.arg_jsonName, 0, &jError);
+	if (!jManifest)
+		ctx.fatal("\n{\"error\":\"failed to load manifest\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"line\":%d,\"text\":\"%s\"}\n",
+			  __FUNCTION__, __FILE__, __LINE__, app.arg_jsonName, jError.line, jError.text);
+
+	app.loadManifestSection(jManifest, &app.sectionSignature);
+	app.loadManifestSection(jManifest, &app.sectionSwap);
+	app.loadManifestSection(jManifest, &app.sectionMember);
+
+	// member `tid` are reproduced only with the imprints they were created with
+	json_t *jInterleave = json_object_get(jManifest, "interleave");
+	if (!app.opt_interleave && json_is_integer(jInterleave))
+		app.opt_interleave = json_integer_value(jInterleave);
+
+	if (!app.sectionSignature.pFilename)
+		ctx.fatal("\n{\"error\":\"manifest has no signatures\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\"}\n",
+			  __FUNCTION__, __FILE__, __LINE__, app.arg_jsonName);
+
+	/*
+	 * Open input database
+	 */
+
+	// Open input
+	database_t db(ctx);
+
+	db.open(app.arg_inputDatabase);
+
+	// evaluators are fully used
+	db.adviseSections(database_t::ALLOCMASK_EVALUATOR, database_t::ACCESS_WILLNEED);
+
+	app.verifyDatabaseSections(db);
+
+	// display system flags when database was created
+	if (ctx.opt_verbose >= ctx.VERBOSE_WARNING) {
+		char dbText[128], ctxText[128];
+
+		ctx.flagsToText(db.creationFlags, dbText);
+		ctx.flagsToText(ctx.flags, ctxText);
+
+		if (db.creationFlags != ctx.flags)
+			fprintf(stderr, "[%s] WARNING: Database/system flags differ: database=[%s] current=[%s]\n", ctx.timeAsString(), dbText, ctxText);
+		else if (db.creationFlags && ctx.opt_verbose >= ctx.VERBOSE_SUMMARY)
+			fprintf(stderr, "[%s] FLAGS [%s]\n", ctx.timeAsString(), dbText);
+	}
+
+	/*
+	 * Signatures are needed to select imprint metrics, parse them before the output exists
+	 */
+
+	app.createWorkers(0);
+
+	app.pSignatures = (signature_t *) ctx.myAlloc("genimportContext_t::pSignatures", app.sectionSignature.numRecord + 1, sizeof(*app.pSignatures));
+	app.importSection(&app.sectionSignature, app.JOB_SIGNATURE);
+
+	for (unsigned iSid = 1; iSid <= app.sectionSignature.numRecord; iSid++) {
+		if (app.pSignatures[iSid].size > app.maxSize)
+			app.maxSize = app.pSignatures[iSid].size;
+	}
+
+	app.freeWorkers();
+
+	/*
+	 * Create output database
+	 */
+
+	database_t store(ctx);
+
+	// all but transforms and evaluators are imported
+	app.inheritSections &= database_t::ALLOCMASK_TRANSFORM | database_t::ALLOCMASK_EVALUATOR;
+	app.rebuildSections |= database_t::ALLOCMASK_SIGNATURE | database_t::ALLOCMASK_SWAP | database_t::ALLOCMASK_HINT |
+			       database_t::ALLOCMASK_IMPRINT | database_t::ALLOCMASK_PAIR | database_t::ALLOCMASK_MEMBER;
+
+	// size to manifest
+	app.opt_maxSignature = app.sectionSignature.numRecord + 1;
+	app.opt_maxSwap      = app.sectionSwap.numRecord + 1;
+	app.opt_maxHint      = 1;
+	app.opt_maxPair      = 1;
+	app.opt_maxMember    = app.sectionMember.numRecord + 1;
+
+	// assign sizes to output sections
+	app.sizeDatabaseSections(store, db, app.maxSize);
+
+	/*
+	 * Finalise allocations and create database
+	 */
+
+	if (ctx.opt_verbose >= ctx.VERBOSE_WARNING) {
+		// Assuming with database allocations included
+		size_t allocated = ctx.totalAllocated + store.estimateMemoryUsage(app.inheritSections);
+
+		struct sysinfo info;
+		if (sysinfo(&info) == 0) {
+			double percent = 100.0 * allocated / info.freeram;
+			if (percent > 80)
+				fprintf(stderr, "WARNING: using %.1f%% of free memory minus cache\n", percent);
+		}
+	}
+
+	// actual create
+	store.create(app.inheritSections);
+	app.pStore = &store;
+
+	if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS) {
+		struct sysinfo info;
+		if (sysinfo(&info) != 0)
+			info.freeram = 0;
+
+		fprintf(stderr, "[%s] Allocated %.3fG memory. freeMemory=%.3fG.\n", ctx.timeAsString(), ctx.totalAllocated / 1e9, info.freeram / 1e9);
+	}
+
+	/*
+	 * Inherit transforms and evaluators
+	 */
+
+	app.populateDatabaseSections(store, db);
+	app.waitVerifySections();
+
+	store.numSignature = app.sectionSignature.numRecord + 1;
+	::memcpy(store.signatures, app.pSignatures, store.numSignature * sizeof(*store.signatures));
+	ctx.myFree("genimportContext_t::pSignatures", app.pSignatures);
+
+	store.numSwap   = 1;
+	store.numHint   = 1;
+	store.numPair   = 1;
+	store.numMember = 1;
+
+	/*
+	 * Import remaining sections
+	 */
+
+	unsigned numRow = store.numImprintRow() > store.numAssociativeRow() ? store.numImprintRow() : store.numAssociativeRow();
+	app.createWorkers(numRow);
+
+	if (app.sectionSwap.pFilename) {
+		app.importSection(&app.sectionSwap, app.JOB_SWAP);
+		store.numSwap = app.sectionSwap.numRecord + 1;
+	}
+
+	store.rebuildIndices(database_t::ALLOCMASK_SIGNATUREINDEX | database_t::ALLOCMASK_SWAPINDEX | database_t::ALLOCMASK_HINTINDEX | database_t::ALLOCMASK_PAIRINDEX);
+
+	app.importImprints();
+
+	if (app.sectionMember.pFilename)
+		app.importMembers();
+	else
+		store.rebuildIndices(database_t::ALLOCMASK_MEMBERINDEX);
+
+	app.freeWorkers();
+
+	/*
+	 * Save the database
+	 */
+
+	// unexpected termination should unlink the outputs
+	signal(SIGINT, sigintHandler);
+	signal(SIGHUP, sigintHandler);
+
+	store.save(app.arg_outputDatabase);
+
+	if (ctx.opt_verbose >= ctx.VERBOSE_WARNING) {
+		json_t *jResult = json_object();
+		json_object_set_new_nocheck(jResult, "done", json_string_nocheck(argv[0]));
+		json_object_set_new_nocheck(jResult, "filename", json_string_nocheck(app.arg_outputDatabase));
+		store.jsonInfo(jResult);
+		fprintf(stderr, "%s\n", json_dumps(jResult, JSON_PRESERVE_ORDER | JSON_COMPACT));
+	}
+
+	return 0;
+}
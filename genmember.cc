@@ -200,6 +200,10 @@
 #include "dbtool.h"
 #include "generator.h"
 #include "metrics.h"
+#include "decorsort.h"
+#include "lookupcache.h"
+#include "pipeline.h"
+#include "restartcost.h"
 #include "restartdata.h"
 #include "tinytree.h"
 
@@ -237,18 +241,34 @@ struct genmemberContext_t : dbtool_t {
 	unsigned   opt_generate;
 	/// @var {string} name of file containing members
 	const char *opt_load;
+	/// @var {number} prune associative lookups with imprint invariants
+	unsigned   opt_invariant;
+	/// @var {number} entries of candidate lookup cache, zero to disable
+	unsigned   opt_lookupCache;
 	/// @var {number} save level-1 indices (hintIndex, signatureIndex, ImprintIndex) and level-2 index (imprints)
 	unsigned   opt_saveIndex;
 	/// @var {number} Sid range upper bound
 	unsigned   opt_sidHi;
 	/// @var {number} Sid range lower bound
 	unsigned   opt_sidLo;
+	/// @var {string} write restart tab cost profile
+	const char *opt_costProfile;
+	/// @var {string} shared claim file for `--dynamic`
+	const char *opt_dynamic;
+	/// @var {number} number of windows for `--dynamic`
+	unsigned   opt_dynamicWindows;
+	/// @var {string} restart tab cost profile for `--task`/`--dynamic`
+	const char *opt_restartCost;
+	/// @var {number} candidates timed per restart tab for `--costprofile`
+	unsigned   opt_sample;
 	/// @var {number} task Id. First task=1
 	unsigned   opt_taskId;
 	/// @var {number} Number of tasks / last task
 	unsigned   opt_taskLast;
 	/// @var {number} --text, textual output instead of binary database
 	unsigned   opt_text;
+	/// @var {number} worker threads for pipelined lookups and sorting, zero for serial
+	unsigned   opt_threads;
 	/// @var {number} truncate on database overflow
 	double     opt_truncate;
 	/// @var {number} generator upper bound
@@ -267,6 +287,10 @@ struct genmemberContext_t : dbtool_t {
 	unsigned        freeMemberRoot;
 	/// @var {number} - THE generator
 	generatorTree_t generator;
+	/// @var {candidatePipeline_t} pipelined lookups when `--threads`
+	candidatePipeline_t *pPipeline;
+	/// @var {lookupCache_t} cached serial lookups during generation
+	lookupCache_t   *pLookupCache;
 	/// @var {number} - Number of empty signatures left
 	unsigned        numEmpty;
 	/// @var {number} - Number of unsafe signatures left
@@ -293,12 +317,20 @@ struct genmemberContext_t : dbtool_t {
 		opt_force          = 0;
 		opt_generate       = 1;
 		opt_saveIndex      = 1;
+		opt_costProfile    = NULL;
+		opt_dynamic        = NULL;
+		opt_dynamicWindows = 256;
+		opt_restartCost    = NULL;
+		opt_sample         = 10000;
 		opt_taskId         = 0;
 		opt_taskLast       = 0;
 		opt_load           = NULL;
+		opt_invariant      = 1;
+		opt_lookupCache    = LOOKUPCACHE_DEFAULT;
 		opt_sidHi          = 0;
 		opt_sidLo          = 0;
 		opt_text           = 0;
+		opt_threads        = 0;
 		opt_truncate       = 0;
 		opt_windowHi       = 0;
 		opt_windowLo       = 0;
@@ -308,6 +340,8 @@ struct genmemberContext_t : dbtool_t {
 
 		activeHintIndex  = 0;
 		freeMemberRoot   = 0;
+		pPipeline        = NULL;
+		pLookupCache     = NULL;
 		numUnsafe        = 0;
 		skipDuplicate    = 0;
 		skipSize         = 0;
@@ -782,7 +816,76 @@ struct genmemberContext_t : dbtool_t {
 	 * @param {number} numBackRef - number of back-references
 	 * @return {boolean} return `true` to continue with recursion (this should be always the case except for `genrestartdata`)
 	 */
-	bool /*__attribute__((optimize("O0")))*/ foundTreeMember(const generatorTree_t &treeR, const char *pNameR, unsigned numPlaceholder, unsigned numEndpoint, unsigned numBackRef) {
+	bool foundTreeMember(const generatorTree_t &treeR, const char *pNameR, unsigned numPlaceholder, unsigned numEndpoint, unsigned numBackRef) {
+		return foundMember(treeR, pNameR, numPlaceholder, numEndpoint, numBackRef, NULL);
+	}
+
+	/**
+	 * @date 2026-10-17 15:40:22
+	 *
+	 * `foundTreeMember()` for `--threads`, queue candidate for pipelined lookup
+	 *
+	 * @param {generatorTree_t} treeR - candidate tree
+	 * @param {string} pNameR - Tree name/notation
+	 * @param {number} numPlaceholder - number of unique endpoints/placeholders in tree
+	 * @param {number} numEndpoint - number of non-zero endpoints in tree
+	 * @param {number} numBackRef - number of back-references
+	 * @return {boolean} return `true` to continue with recursion
+	 */
+	bool foundTreePipeline(const generatorTree_t &treeR, const char *pNameR, unsigned numPlaceholder, unsigned numEndpoint, unsigned numBackRef) {
+		if (this->truncated)
+			return false; // quit as fast as possible
+
+		if (pPipeline->push(pNameR, numPlaceholder, numEndpoint, numBackRef))
+			commitPipeline();
+
+		return !this->truncated;
+	}
+
+	/**
+	 * @date 2026-10-17 15:42:51
+	 *
+	 * Commit batch finished by pipeline workers in candidate order, then dispatch the filled batch.
+	 */
+	void commitPipeline(void) {
+		const candidatePipeline_t::candidate_t *pBatch;
+		unsigned                               numBatch;
+
+		pPipeline->wait(&pBatch, &numBatch);
+
+		uint64_t   saveProgress = ctx.progress;
+		tinyTree_t tree(ctx);
+
+		for (unsigned i = 0; i < numBatch && !this->truncated; i++) {
+			const candidatePipeline_t::candidate_t *pCandidate = pBatch + i;
+
+			// replay generator state of candidate
+			ctx.progress = pCandidate->progress;
+			tree.loadStringFast(pCandidate->name);
+
+			foundMember(tree, pCandidate->name, pCandidate->numPlaceholder, pCandidate->numEndpoint, pCandidate->numBackRef, pCandidate);
+		}
+
+		ctx.progress = saveProgress;
+
+		pPipeline->dispatch();
+	}
+
+	/**
+	 * @date 2026-10-17 15:45:07
+	 *
+	 * Body of `foundTreeMember()`.
+	 * With `pSpeculative` the associative lookup result of the pipeline is used when still valid.
+	 *
+	 * @param {tinyTree_t} treeR - candidate tree
+	 * @param {string} pNameR - Tree name/notation
+	 * @param {number} numPlaceholder - number of unique endpoints/placeholders in tree
+	 * @param {number} numEndpoint - number of non-zero endpoints in tree
+	 * @param {number} numBackRef - number of back-references
+	 * @param {candidate_t} pSpeculative - pipelined lookup result, or NULL
+	 * @return {boolean} return `true` to continue with recursion
+	 */
+	bool /*__attribute__((optimize("O0")))*/ foundMember(const tinyTree_t &treeR, const char *pNameR, unsigned numPlaceholder, unsigned numEndpoint, unsigned numBackRef, const candidatePipeline_t::candidate_t *pSpeculative) {
 
 		if (this->truncated)
 			return false; // quit as fast as possible
@@ -806,7 +909,7 @@ struct genmemberContext_t : dbtool_t {
 				int etaS = eta;
 
 				fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) %.5f%% eta=%d:%02d:%02d | numMember=%u(%.0f%%) numEmpty=%u numUnsafe=%u | skipDuplicate=%u skipSize=%u skipUnsafe=%u | hash=%.3f %s",
-					ctx.timeAsString(), ctx.progress, perSecond, (ctx.progress - treeR.windowLo) * 100.0 / (ctx.progressHi - treeR.windowLo), etaH, etaM, etaS,
+					ctx.timeAsString(), ctx.progress, perSecond, (ctx.progress - generator.windowLo) * 100.0 / (ctx.progressHi - generator.windowLo), etaH, etaM, etaS,
 					pStore->numMember, pStore->numMember * 100.0 / pStore->maxMember,
 					numEmpty, numUnsafe - numEmpty,
 					skipDuplicate, skipSize, skipUnsafe, (double) ctx.cntCompare / ctx.cntHash, pNameR);
@@ -866,6 +969,13 @@ struct genmemberContext_t : dbtool_t {
 			 */
 			// add to imprints to index
 			sid = pStore->addImprintAssociative(&treeR, pStore->fwdEvaluator, pStore->revEvaluator, markSid);
+		} else if (pSpeculative && pPipeline->isValid(pSpeculative)) {
+			// pipelined lookup still valid
+			sid = pSpeculative->sid;
+			tid = pSpeculative->tid;
+		} else if (pLookupCache) {
+			// candidates sharing a footprint share the lookup result
+			pLookupCache->lookupImprintAssociative(pStore, &treeR, pStore->fwdEvaluator, pStore->revEvaluator, &sid, &tid);
 		} else {
 			pStore->lookupImprintAssociative(&treeR, pStore->fwdEvaluator, pStore->revEvaluator, &sid, &tid);
 		}
@@ -1070,65 +1180,52 @@ struct genmemberContext_t : dbtool_t {
 	/**
 	 * @date 2020-04-05 21:07:14
 	 *
-	 * Compare function for `qsort_r`
+	 * Sort key for `decoratedSort_t`, replaces the leading part of the former `qsort_r` comparator
+	 *
+	 * @date 2026-10-17 18:44:26
+	 *
+	 * Ordering: empties last, safes first, depreciates last, components first, then score.
+	 * Components now consistently go first, the former comparator returned `-1` both ways.
+	 *
+	 * @param {member_t} pElement - member
+	 * @param {context_t} arg - I/O context
+	 * @return {number} packed sort key
+	 */
+	static uint64_t keyMember(const void *pElement, void *arg) {
+		const member_t *pMember = static_cast<const member_t *>(pElement);
+		(void) arg;
+
+		// test for empties (they should gather towards the end of `members[]`)
+		if (pMember->sid == 0)
+			return ~(uint64_t) 0;
+
+		uint64_t key = 0;
+
+		key |= (uint64_t) ((pMember->flags & member_t::MEMMASK_SAFE) ? 0 : 1) << 62; // safes go first
+		key |= (uint64_t) ((pMember->flags & member_t::MEMMASK_DEPR) ? 1 : 0) << 61; // depreciates go last
+		key |= (uint64_t) ((pMember->flags & member_t::MEMMASK_COMP) ? 0 : 1) << 60; // components go first
+		key |= (uint64_t) tinyTree_t::calcScoreName(pMember->name) << 32;
+
+		return key;
+	}
+
+	/**
+	 * @date 2026-10-17 18:44:26
+	 *
+	 * Tie comparator for `decoratedSort_t`, only called for members with equal keys
 	 *
 	 * @param {member_t} lhs - left hand side member
 	 * @param {member_t} rhs - right hand side member
 	 * @param {context_t} arg - I/O context
 	 * @return "<0" if "L<R", "0" if "L==R", ">0" if "L>R"
 	 */
-	static int comparMember(const void *lhs, const void *rhs, void *arg) {
-		if (lhs == rhs)
-			return 0;
-
+	static int tieMember(const void *lhs, const void *rhs, void *arg) {
 		const member_t *pMemberL = static_cast<const member_t *>(lhs);
 		const member_t *pMemberR = static_cast<const member_t *>(rhs);
 		context_t      *pApp     = static_cast<context_t *>(arg);
 
-		// test for empties (they should gather towards the end of `members[]`)
-		if (pMemberL->sid == 0 && pMemberR->sid == 0)
+		if (pMemberL->sid == 0 || pMemberR->sid == 0)
 			return 0;
-		if (pMemberL->sid == 0)
-			return +1;
-		if (pMemberR->sid == 0)
-			return -1;
-
-		int cmp = 0;
-
-		/*
-		 * safes go first
-		 */
-		if ((pMemberL->flags & member_t::MEMMASK_SAFE) && !(pMemberR->flags & member_t::MEMMASK_SAFE))
-			return -1;
-		if (!(pMemberL->flags & member_t::MEMMASK_SAFE) && (pMemberR->flags & member_t::MEMMASK_SAFE))
-			return +1;
-
-		/*
-		 * depreciates go last
-		 */
-		if ((pMemberL->flags & member_t::MEMMASK_DEPR) && !(pMemberR->flags & member_t::MEMMASK_DEPR))
-			return +1;
-		if (!(pMemberL->flags & member_t::MEMMASK_DEPR) && (pMemberR->flags & member_t::MEMMASK_DEPR))
-			return -1;
-
-		/*
-		 * components go first
-		 */
-		if ((pMemberL->flags & member_t::MEMMASK_COMP) && !(pMemberR->flags & member_t::MEMMASK_COMP))
-			return -1;
-		if (!(pMemberL->flags & member_t::MEMMASK_COMP) && (pMemberR->flags & member_t::MEMMASK_COMP))
-			return -1;
-
-		/*
-		 * compare scores
-		 */
-
-		unsigned scoreL = tinyTree_t::calcScoreName(pMemberL->name);
-		unsigned scoreR = tinyTree_t::calcScoreName(pMemberR->name);
-
-		cmp = scoreL - scoreR;
-		if (cmp)
-			return cmp;
 
 		/*
 		 * Compare trees
@@ -1141,8 +1238,7 @@ struct genmemberContext_t : dbtool_t {
 		treeL.loadStringFast(pMemberL->name);
 		treeR.loadStringFast(pMemberR->name);
 
-		cmp = treeL.compare(treeL.root, treeR, treeR.root);
-		return cmp;
+		return treeL.compare(treeL.root, treeR, treeR.root);
 	}
 
 	/**
@@ -1151,6 +1247,7 @@ struct genmemberContext_t : dbtool_t {
 	void rebuildImprints(unsigned unsafeOnly) {
 		// clear signature and imprint index
 		::memset(pStore->imprintIndex, 0, pStore->imprintIndexSize * sizeof(*pStore->imprintIndex));
+		pStore->clearImprintFilter();
 
 		if (pStore->numSignature < 2)
 			return; //nothing to do
@@ -1316,6 +1413,7 @@ struct genmemberContext_t : dbtool_t {
 
 		// clear signature and imprint index
 		::memset(pStore->imprintIndex, 0, pStore->imprintIndexSize * sizeof(*pStore->imprintIndex));
+		pStore->clearImprintFilter();
 
 		if (pStore->numSignature < 2)
 			return; //nothing to do
@@ -1608,6 +1706,15 @@ struct genmemberContext_t : dbtool_t {
 		ctx.tick = 0;
 		skipDuplicate = skipSize = skipUnsafe = 0;
 
+		// cache lookups of candidates with identical footprints
+		lookupCache_t lookupCache(ctx, opt_lookupCache);
+		uint64_t      cntCacheHit = 0, cntCacheMiss = 0;
+		pLookupCache = &lookupCache;
+
+		// skip rows that can not match by cofactor weights
+		if (opt_invariant)
+			pStore->enableImprintInvariant();
+
 		/*
 		 * Generate candidates
 		 */
@@ -1624,9 +1731,30 @@ struct genmemberContext_t : dbtool_t {
 
 			generator.initialiseGenerator(ctx.flags & context_t::MAGICMASK_PURE);
 			generator.clearGenerator();
-			generator.generateTrees(arg_numNodes, endpointsLeft, 0, 0, this, static_cast<generatorTree_t::generateTreeCallback_t>(&genmemberContext_t::foundTreeMember));
+
+			if (opt_threads && !((ctx.flags & context_t::MAGICMASK_AINF) && !this->readOnlyMode)) {
+				// pipelined, enumerate here and lookup in worker threads
+				candidatePipeline_t pipeline(ctx, pStore, opt_threads, 1 << 16, opt_lookupCache);
+				pPipeline = &pipeline;
+
+				generator.generateTrees(arg_numNodes, endpointsLeft, 0, 0, this, static_cast<generatorTree_t::generateTreeCallback_t>(&genmemberContext_t::foundTreePipeline));
+
+				// flush in-flight and partially filled batch
+				commitPipeline();
+				commitPipeline();
+
+				pipeline.cacheStats(&cntCacheHit, &cntCacheMiss);
+
+				pPipeline = NULL;
+			} else {
+				generator.generateTrees(arg_numNodes, endpointsLeft, 0, 0, this, static_cast<generatorTree_t::generateTreeCallback_t>(&genmemberContext_t::foundTreeMember));
+			}
 		}
 
+		pLookupCache = NULL;
+		cntCacheHit += lookupCache.cntHit;
+		cntCacheMiss += lookupCache.cntMiss;
+
 		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
 			fprintf(stderr, "\r\e[K");
 
@@ -1648,6 +1776,47 @@ struct genmemberContext_t : dbtool_t {
 				pStore->numMember, pStore->numMember * 100.0 / pStore->maxMember,
 				numEmpty, numUnsafe - numEmpty,
 				skipDuplicate, skipSize, skipUnsafe);
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY && opt_lookupCache)
+			fprintf(stderr, "[%s] lookupCache: hit=%lu miss=%lu rate=%.1f%%\n",
+				ctx.timeAsString(), cntCacheHit, cntCacheMiss,
+				cntCacheHit + cntCacheMiss ? cntCacheHit * 100.0 / (cntCacheHit + cntCacheMiss) : 0.0);
+	}
+
+	/**
+	 * @date 2026-10-17 12:21:44
+	 *
+	 * Write restart tab cost profile for `--restartcost`.
+	 * Times `foundTreeMember()` on the first `--sample` candidates of every restart tab, members found are added as in a normal run.
+	 *
+	 * @param {restartCost_t} restartCost - profile writer
+	 */
+	void costFromGenerator(restartCost_t &restartCost) {
+
+		unsigned ofs = 0;
+		if (this->arg_numNodes > 4 && this->arg_numNodes < tinyTree_t::TINYTREE_MAXNODES)
+			ofs = restartIndex[this->arg_numNodes][(ctx.flags & context_t::MAGICMASK_PURE) ? 1 : 0];
+		const metricsGenerator_t *pMetrics = getMetricsGenerator(MAXSLOTS, ctx.flags & context_t::MAGICMASK_PURE, arg_numNodes);
+		if (!ofs || !pMetrics)
+			ctx.fatal("\n{\"error\":\"no restart data or metrics\",\"where\":\"%s:%s:%d\",\"numNode\":%u}\n", __FUNCTION__, __FILE__, __LINE__, arg_numNodes);
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "[%s] Sampling restart tabs for %un%u%s\n", ctx.timeAsString(), arg_numNodes, MAXSLOTS, ctx.flags & context_t::MAGICMASK_PURE ? "-pure" : "");
+
+		// same lookup shortcuts as a normal run
+		lookupCache_t lookupCache(ctx, opt_lookupCache);
+		pLookupCache = &lookupCache;
+		if (opt_invariant)
+			pStore->enableImprintInvariant();
+
+		ctx.setupSpeed(pMetrics->numProgress);
+		ctx.tick = 0;
+		skipDuplicate = skipSize = skipUnsafe = 0;
+
+		generator.initialiseGenerator(ctx.flags & context_t::MAGICMASK_PURE);
+		restartCost.sampleProfile(opt_costProfile, generator, restartData + ofs, pMetrics->numProgress, arg_numNodes, opt_sample, this, static_cast<generatorTree_t::generateTreeCallback_t>(&genmemberContext_t::foundTreeMember));
+
+		pLookupCache = NULL;
 	}
 
 	/**
@@ -1679,7 +1848,8 @@ struct genmemberContext_t : dbtool_t {
 
 		// sort entries (skipping first)
 		assert(pStore->numMember >= 1);
-		qsort_r(pStore->members + 1, pStore->numMember - 1, sizeof(*pStore->members), comparMember, this);
+		decoratedSort_t sorter(ctx, opt_threads);
+		sorter.sort(pStore->members + 1, pStore->numMember - 1, sizeof(*pStore->members), keyMember, tieMember, &ctx);
 
 		// lower lastMember, skipping all the deleted
 		while (pStore->numMember > 1 && pStore->members[pStore->numMember - 1].sid == 0)
@@ -1906,12 +2076,18 @@ void usage(char *argv[], bool verbose) {
 
 	if (verbose) {
 		fprintf(stderr, "\n");
+		fprintf(stderr, "\t   --dynamic=<file>[,<number>]     Claim windows on demand from shared claim file [default=%s,%u]\n", app.opt_dynamic ? app.opt_dynamic : "", app.opt_dynamicWindows);
+		fprintf(stderr, "\t   --[no-]compress                 Save as block-compressed container [default=%s]\n", app.opt_compress ? "enabled" : "disabled");
+		fprintf(stderr, "\t   --costprofile=<file>            Write restart tab cost profile for `--restartcost` instead of output [default=%s]\n", app.opt_costProfile ? app.opt_costProfile : "");
 		fprintf(stderr, "\t   --force                         Force overwriting of database if already exists\n");
 		fprintf(stderr, "\t   --[no-]generate                 Invoke generator for new candidates [default=%s]\n", app.opt_generate ? "enabled" : "disabled");
+		fprintf(stderr, "\t   --[no-]grow                     Grow full sections instead of \"storage full\" [default=%s]\n", app.opt_grow ? "enabled" : "disabled");
 		fprintf(stderr, "\t-h --help                          This list\n");
 		fprintf(stderr, "\t   --imprintindexsize=<number>     Size of imprint index [default=%u]\n", app.opt_imprintIndexSize);
 		fprintf(stderr, "\t   --interleave=<number>           Imprint index interleave [default=%u]\n", app.opt_interleave);
+		fprintf(stderr, "\t   --[no-]invariant                Prune associative lookups by cofactor weights [default=%s]\n", app.opt_invariant ? "enabled" : "disabled");
 		fprintf(stderr, "\t   --load=<file>                   Read candidates from file instead of generating [default=%s]\n", app.opt_load ? app.opt_load : "");
+		fprintf(stderr, "\t   --lookupcache=<number>          Entries of candidate lookup cache, 0=disable [default=%u]\n", app.opt_lookupCache);
 		fprintf(stderr, "\t   --maximprint=<number>           Maximum number of imprints [default=%u]\n", app.opt_maxImprint);
 		fprintf(stderr, "\t   --maxmember=<number>            Maximum number of members [default=%u]\n", app.opt_maxMember);
 		fprintf(stderr, "\t   --maxpair=<number>              Maximum number of sid/tid pairs [default=%u]\n", app.opt_maxPair);
@@ -1920,16 +2096,20 @@ void usage(char *argv[], bool verbose) {
 		fprintf(stderr, "\t   --[no-]pure                     QTF->QnTF rewriting [default=%s]\n", (ctx.flags & context_t::MAGICMASK_PURE) ? "enabled" : "disabled");
 		fprintf(stderr, "\t-q --quiet                         Say less\n");
 		fprintf(stderr, "\t   --ratio=<number>                Index/data ratio [default=%.1f]\n", app.opt_ratio);
+		fprintf(stderr, "\t   --restartcost=<file>            Restart tab cost profile from `--costprofile` [default=%s]\n", app.opt_restartCost ? app.opt_restartCost : "");
+		fprintf(stderr, "\t   --sample=<number>               Candidates timed per restart tab for `--costprofile` [default=%u]\n", app.opt_sample);
 		fprintf(stderr, "\t   --[no-]saveindex                Save with indices [default=%s]\n", app.opt_saveIndex ? "enabled" : "disabled");
 		fprintf(stderr, "\t   --sid=[<low>,]<high>            Sid range upper bound  [default=%u,%u]\n", app.opt_sidLo, app.opt_sidHi);
 		fprintf(stderr, "\t   --pairindexsize=<number>        Size of sid/tid pair index [default=%u]\n", app.opt_pairIndexSize);
 		fprintf(stderr, "\t   --task=sge                      Get task settings from SGE environment\n");
 		fprintf(stderr, "\t   --task=<id>,<last>              Task id/number of tasks. [default=%u,%u]\n", app.opt_taskId, app.opt_taskLast);
 		fprintf(stderr, "\t   --text                          Textual output instead of binary database\n");
+		fprintf(stderr, "\t   --threads=<number>              Worker threads for pipelined lookups and sorting, 0=serial [default=%u]\n", app.opt_threads);
 		fprintf(stderr, "\t   --timer=<seconds>               Interval timer for verbose updates [default=%u]\n", ctx.opt_timer);
 		fprintf(stderr, "\t   --[no-]unsafe                   Reindex imprints based on empty/unsafe signature groups [default=%s]\n", (ctx.flags & context_t::MAGICMASK_UNSAFE) ? "enabled" : "disabled");
 		fprintf(stderr, "\t-v --truncate                      Truncate on database overflow\n");
 		fprintf(stderr, "\t-v --verbose                       Say more\n");
+		fprintf(stderr, "\t   --verify[=<threads>]            Verify input checksums before use, otherwise on first copy\n");
 		fprintf(stderr, "\t   --window=[<low>,]<high>         Upper end restart window [default=%lu,%lu]\n", app.opt_windowLo, app.opt_windowHi);
 	}
 }
@@ -1956,16 +2136,25 @@ int main(int argc, char *argv[]) {
 		enum {
 			// long-only opts
 			LO_DEBUG   = 1,
+			LO_DYNAMIC,
+			LO_COMPRESS,
+			LO_COSTPROFILE,
 			LO_FORCE,
 			LO_GENERATE,
+			LO_GROW,
 			LO_IMPRINTINDEXSIZE,
 			LO_INTERLEAVE,
+			LO_INVARIANT,
 			LO_LOAD,
+			LO_LOOKUPCACHE,
 			LO_MAXIMPRINT,
 			LO_MAXMEMBER,
 			LO_MAXPAIR,
 			LO_MEMBERINDEXSIZE,
+			LO_NOCOMPRESS,
 			LO_NOGENERATE,
+			LO_NOGROW,
+			LO_NOINVARIANT,
 			LO_NOPARANOID,
 			LO_NOPURE,
 			LO_NOSAVEINDEX,
@@ -1973,15 +2162,19 @@ int main(int argc, char *argv[]) {
 			LO_PARANOID,
 			LO_PURE,
 			LO_RATIO,
+			LO_RESTARTCOST,
+			LO_SAMPLE,
 			LO_SAVEINDEX,
 			LO_SID,
 			LO_PAIRINDEXSIZE,
 			LO_TASK,
 			LO_TEXT,
+			LO_THREADS,
 			LO_TIMER,
 			LO_TRUNCATE,
 			LO_UNSAFE,
 			LO_WINDOW,
+			LO_VERIFY,
 			// short opts
 			LO_HELP    = 'h',
 			LO_QUIET   = 'q',
@@ -1992,17 +2185,26 @@ int main(int argc, char *argv[]) {
 		static struct option long_options[] = {
 			/* name, has_arg, flag, val */
 			{"debug",              1, 0, LO_DEBUG},
+			{"dynamic",            1, 0, LO_DYNAMIC},
+			{"compress",           0, 0, LO_COMPRESS},
+			{"costprofile",        1, 0, LO_COSTPROFILE},
 			{"force",              0, 0, LO_FORCE},
 			{"generate",           0, 0, LO_GENERATE},
+			{"grow",               0, 0, LO_GROW},
 			{"help",               0, 0, LO_HELP},
 			{"imprintindexsize",   1, 0, LO_IMPRINTINDEXSIZE},
 			{"interleave",         1, 0, LO_INTERLEAVE},
+			{"invariant",          0, 0, LO_INVARIANT},
 			{"load",               1, 0, LO_LOAD},
+			{"lookupcache",        1, 0, LO_LOOKUPCACHE},
 			{"maximprint",         1, 0, LO_MAXIMPRINT},
 			{"maxmember",          1, 0, LO_MAXMEMBER},
 			{"maxpair",            1, 0, LO_MAXPAIR},
 			{"memberindexsize",    1, 0, LO_MEMBERINDEXSIZE},
+			{"no-compress",        0, 0, LO_NOCOMPRESS},
 			{"no-generate",        0, 0, LO_NOGENERATE},
+			{"no-grow",            0, 0, LO_NOGROW},
+			{"no-invariant",       0, 0, LO_NOINVARIANT},
 			{"no-paranoid",        0, 0, LO_NOPARANOID},
 			{"no-pure",            0, 0, LO_NOPURE},
 			{"no-saveindex",       0, 0, LO_NOSAVEINDEX},
@@ -2011,15 +2213,19 @@ int main(int argc, char *argv[]) {
 			{"pure",               0, 0, LO_PURE},
 			{"quiet",              2, 0, LO_QUIET},
 			{"ratio",              1, 0, LO_RATIO},
+			{"restartcost",        1, 0, LO_RESTARTCOST},
+			{"sample",             1, 0, LO_SAMPLE},
 			{"saveindex",          0, 0, LO_SAVEINDEX},
 			{"sid",                1, 0, LO_SID},
 			{"pairindexsize",      1, 0, LO_PAIRINDEXSIZE},
 			{"task",               1, 0, LO_TASK},
 			{"text",               2, 0, LO_TEXT},
+			{"threads",            1, 0, LO_THREADS},
 			{"timer",              1, 0, LO_TIMER},
 			{"truncate",           0, 0, LO_TRUNCATE},
 			{"unsafe",             0, 0, LO_UNSAFE},
 			{"verbose",            2, 0, LO_VERBOSE},
+			{"verify",             2, 0, LO_VERIFY},
 			{"window",             1, 0, LO_WINDOW},
 			//
 			{NULL,                 0, 0, 0}
@@ -2052,12 +2258,38 @@ int main(int argc, char *argv[]) {
 		case LO_DEBUG:
 			ctx.opt_debug = ::strtoul(optarg, NULL, 0);
 			break;
+		case LO_DYNAMIC: {
+			static char claimFile[256];
+
+			// <claimfile>[,<numWindows>]
+			::strncpy(claimFile, optarg, sizeof(claimFile) - 1);
+			char *p = ::strchr(claimFile, ',');
+			if (p) {
+				*p++ = 0;
+				app.opt_dynamicWindows = ::strtoul(p, NULL, 0);
+			}
+			if (!claimFile[0] || app.opt_dynamicWindows == 0) {
+				usage(argv, true);
+				exit(1);
+			}
+			app.opt_dynamic = claimFile;
+			break;
+		}
+		case LO_COMPRESS:
+			app.opt_compress++;
+			break;
+		case LO_COSTPROFILE:
+			app.opt_costProfile = optarg;
+			break;
 		case LO_FORCE:
 			app.opt_force++;
 			break;
 		case LO_GENERATE:
 			app.opt_generate++;
 			break;
+		case LO_GROW:
+			app.opt_grow++;
+			break;
 		case LO_HELP:
 			usage(argv, true);
 			exit(0);
@@ -2069,9 +2301,15 @@ int main(int argc, char *argv[]) {
 			if (!getMetricsInterleave(MAXSLOTS, app.opt_interleave))
 				ctx.fatal("--interleave must be one of [%s]\n", getAllowedInterleaves(MAXSLOTS));
 			break;
+		case LO_INVARIANT:
+			app.opt_invariant++;
+			break;
 		case LO_LOAD:
 			app.opt_load = optarg;
 			break;
+		case LO_LOOKUPCACHE:
+			app.opt_lookupCache = ::strtoul(optarg, NULL, 0);
+			break;
 		case LO_MAXIMPRINT:
 			app.opt_maxImprint = ctx.dToMax(::strtod(optarg, NULL));
 			break;
@@ -2084,9 +2322,18 @@ int main(int argc, char *argv[]) {
 		case LO_MEMBERINDEXSIZE:
 			app.opt_memberIndexSize = ctx.nextPrime(::strtod(optarg, NULL));
 			break;
+		case LO_NOCOMPRESS:
+			app.opt_compress = 0;
+			break;
 		case LO_NOGENERATE:
 			app.opt_generate = 0;
 			break;
+		case LO_NOGROW:
+			app.opt_grow = 0;
+			break;
+		case LO_NOINVARIANT:
+			app.opt_invariant = 0;
+			break;
 		case LO_NOPARANOID:
 			ctx.flags &= ~context_t::MAGICMASK_PARANOID;
 			break;
@@ -2108,6 +2355,16 @@ int main(int argc, char *argv[]) {
 		case LO_RATIO:
 			app.opt_ratio = strtof(optarg, NULL);
 			break;
+		case LO_RESTARTCOST:
+			app.opt_restartCost = optarg;
+			break;
+		case LO_SAMPLE:
+			app.opt_sample = ::strtoul(optarg, NULL, 0);
+			if (app.opt_sample == 0) {
+				fprintf(stderr, "--sample must be non-zero\n");
+				exit(1);
+			}
+			break;
 		case LO_NOSAVEINDEX:
 			app.opt_saveIndex = 0;
 			break;
@@ -2176,6 +2433,9 @@ int main(int argc, char *argv[]) {
 		case LO_TEXT:
 			app.opt_text = optarg ? ::strtoul(optarg, NULL, 0) : app.opt_text + 1;
 			break;
+		case LO_THREADS:
+			app.opt_threads = ::strtoul(optarg, NULL, 0);
+			break;
 		case LO_TIMER:
 			ctx.opt_timer = ::strtoul(optarg, NULL, 0);
 			break;
@@ -2188,6 +2448,9 @@ int main(int argc, char *argv[]) {
 		case LO_VERBOSE:
 			ctx.opt_verbose = optarg ? ::strtoul(optarg, NULL, 0) : ctx.opt_verbose + 1;
 			break;
+		case LO_VERIFY:
+			app.opt_verify = optarg ? (unsigned) ::strtoul(optarg, NULL, 0) : (unsigned) sysconf(_SC_NPROCESSORS_ONLN);
+			break;
 		case LO_WINDOW: {
 			uint64_t m, n;
 
@@ -2246,28 +2509,48 @@ int main(int argc, char *argv[]) {
 	/*
 	 * `--task` post-processing
 	 */
-	if (app.opt_taskId || app.opt_taskLast) {
+	restartCost_t restartCost(ctx);
+	unsigned      numDynamic = 0; // windows claimed with `--dynamic`
+
+	if (app.opt_taskId || app.opt_taskLast || app.opt_dynamic) {
 		const metricsGenerator_t *pMetrics = getMetricsGenerator(MAXSLOTS, ctx.flags & context_t::MAGICMASK_PURE, app.arg_numNodes);
-		if (!pMetrics)
-			ctx.fatal("no preset for --task\n");
 
-		// split progress into chunks
-		uint64_t taskSize = pMetrics->numProgress / app.opt_taskLast;
-		if (taskSize == 0)
-			taskSize = 1;
-		app.opt_windowLo = taskSize * (app.opt_taskId - 1);
-		app.opt_windowHi = taskSize * app.opt_taskId;
+		if (app.opt_restartCost) {
+			// boundaries balanced on predicted cost
+			restartCost.load(app.opt_restartCost);
+			if (pMetrics && pMetrics->numProgress != restartCost.numProgress)
+				ctx.fatal("\n{\"error\":\"restartcost does not match metrics\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"encountered\":%lu,\"expected\":%lu}\n",
+					  __FUNCTION__, __FILE__, __LINE__, app.opt_restartCost, restartCost.numProgress, pMetrics->numProgress);
+		} else {
+			// split progress into equal chunks
+			if (!pMetrics)
+				ctx.fatal("no preset for --task\n");
+			restartCost.numProgress = pMetrics->numProgress;
+		}
 
 		// last task is open ended in case metrics are off
-		if (app.opt_taskId == app.opt_taskLast)
-			app.opt_windowHi = 0;
+		if (app.opt_taskId || app.opt_taskLast) {
+			restartCost.taskWindow(app.opt_taskId, app.opt_taskLast, &app.opt_windowLo, &app.opt_windowHi);
+
+			// costly tabs can absorb multiple boundaries
+			if (app.opt_windowHi && app.opt_windowLo >= app.opt_windowHi) {
+				if (ctx.opt_verbose >= ctx.VERBOSE_WARNING)
+					fprintf(stderr, "[%s] INFO: task=%u,%u empty window\n", ctx.timeAsString(), app.opt_taskId, app.opt_taskLast);
+				exit(0);
+			}
+		}
 	}
 	if (app.opt_windowHi && app.opt_windowLo >= app.opt_windowHi) {
 		fprintf(stderr, "--window low exceeds high\n");
 		exit(1);
 	}
 
-	if (app.opt_windowLo || app.opt_windowHi) {
+	if (app.opt_costProfile && (app.arg_outputDatabase || app.opt_taskLast || app.opt_dynamic || app.opt_windowLo || app.opt_windowHi)) {
+		fprintf(stderr, "--costprofile samples the whole run and has no output database\n");
+		exit(1);
+	}
+
+	if (app.opt_windowLo || app.opt_windowHi || app.opt_dynamic) {
 		if (app.arg_numNodes > tinyTree_t::TINYTREE_MAXNODES || restartIndex[app.arg_numNodes][(ctx.flags & context_t::MAGICMASK_PURE) ? 1 : 0] == 0) {
 			fprintf(stderr, "No restart data for --window\n");
 			exit(1);
@@ -2315,10 +2598,16 @@ int main(int argc, char *argv[]) {
 	database_t db(ctx);
 
 	// test readOnly mode
-	app.readOnlyMode = (app.arg_outputDatabase == NULL && app.opt_text != app.OPTTEXT_BRIEF && app.opt_text != app.OPTTEXT_VERBOSE);
+	app.readOnlyMode = (app.arg_outputDatabase == NULL && app.opt_text != app.OPTTEXT_BRIEF && app.opt_text != app.OPTTEXT_VERBOSE && app.opt_costProfile == NULL);
 
 	db.open(app.arg_inputDatabase);
 
+	// sections copied/scanned during startup, evaluators are fully used
+	db.adviseSections(database_t::ALLOCMASK_SIGNATURE | database_t::ALLOCMASK_PAIR | database_t::ALLOCMASK_MEMBER, database_t::ACCESS_SEQUENTIAL);
+	db.adviseSections(database_t::ALLOCMASK_EVALUATOR, database_t::ACCESS_WILLNEED);
+
+	app.verifyDatabaseSections(db);
+
 	// display system flags when database was created
 	if (ctx.opt_verbose >= ctx.VERBOSE_WARNING) {
 		char dbText[128], ctxText[128];
@@ -2375,6 +2664,12 @@ int main(int argc, char *argv[]) {
 	// assign sizes to output sections
 	app.sizeDatabaseSections(store, db, minNodes);
 
+	// imprints shared with the output are probed at random by every lookup, copied imprints are scanned once
+	if ((app.inheritSections & database_t::ALLOCMASK_IMPRINT) || app.copyOnWrite)
+		db.adviseSections(database_t::ALLOCMASK_IMPRINT | database_t::ALLOCMASK_IMPRINTINDEX, database_t::ACCESS_WILLNEED);
+	else if (!(app.rebuildSections & database_t::ALLOCMASK_IMPRINT))
+		db.adviseSections(database_t::ALLOCMASK_IMPRINT, database_t::ACCESS_SEQUENTIAL);
+
 	/*
 	 * Finalise allocations and create database
 	 */
@@ -2460,6 +2755,9 @@ int main(int argc, char *argv[]) {
 	if (app.rebuildSections)
 		store.rebuildIndices(app.rebuildSections);
 
+	// shared input sections must be verified before lookups
+	app.waitVerifySections();
+
 	/*
 	 * count empty/unsafe
 	 */
@@ -2488,6 +2786,12 @@ int main(int argc, char *argv[]) {
 		assert(store.numMember > 0);
 	}
 
+	if (app.opt_costProfile) {
+		// store is updated as in a normal run but not saved
+		app.costFromGenerator(restartCost);
+		return 0;
+	}
+
 	if (app.opt_load)
 		app.membersFromFile();
 	if (app.opt_generate) {
@@ -2497,7 +2801,22 @@ int main(int argc, char *argv[]) {
 			app.membersFromGenerator();
 			app.arg_numNodes = 1;
 		}
-		app.membersFromGenerator();
+		if (app.opt_dynamic) {
+			// claim windows until exhausted
+			unsigned windowId;
+			while (!app.truncated && restartCost.claimWindow(app.opt_dynamic, app.opt_dynamicWindows, &windowId, &app.opt_windowLo, &app.opt_windowHi)) {
+				if (ctx.opt_verbose >= ctx.VERBOSE_WARNING)
+					fprintf(stderr, "[%s] INFO: claimed window %u/%u\n", ctx.timeAsString(), windowId, app.opt_dynamicWindows);
+				app.membersFromGenerator();
+				numDynamic++;
+
+				// incomplete windows are re-issued to other workers
+				if (!app.truncated)
+					restartCost.completeWindow();
+			}
+		} else {
+			app.membersFromGenerator();
+		}
 	}
 
 	/*
@@ -2610,6 +2929,8 @@ int main(int argc, char *argv[]) {
 			json_object_set_new_nocheck(jResult, "taskId", json_integer(app.opt_taskId));
 			json_object_set_new_nocheck(jResult, "taskLast", json_integer(app.opt_taskLast));
 		}
+		if (app.opt_dynamic)
+			json_object_set_new_nocheck(jResult, "dynamicWindows", json_integer(numDynamic));
 		if (app.opt_windowLo || app.opt_windowHi) {
 			json_object_set_new_nocheck(jResult, "windowLo", json_integer(app.opt_windowLo));
 			json_object_set_new_nocheck(jResult, "windowHi", json_integer(app.opt_windowHi));
@@ -8,6 +8,8 @@
  * 	Address space is simple "abc!def!ghi!!" (with all QTF/QTnF combos)
  * 	There are to flavours, non-destructive and destructive.
  * 	The first rewrites only the top-level QTF operator, the latter will also rewrite operands
+ *
+ * 	Patterns and their states are enumerated serially, the target search runs on `--threads`.
  */
 
 /*
@@ -30,6 +32,7 @@
 
 #include <ctype.h>
 #include <getopt.h>
+#include <pthread.h>
 #include <signal.h>
 #include <string.h>
 #include <stdlib.h>
@@ -42,6 +45,11 @@
 
 struct genrewritedataContext_t {
 
+	enum {
+		/// @constant {number} patterns claimed per worker request
+		CHUNKSIZE = 256,
+	};
+
 	struct print_t {
 		char        name[tinyTree_t::TINYTREE_NAMELEN + 1];
 		footprint_t footprint;
@@ -49,11 +57,63 @@ struct genrewritedataContext_t {
 		uint32_t    score;
 	};
 
+	/**
+	 * @date 2026-10-17 16:02:51
+	 *
+	 * Enumerated pattern with its allocated state, input for the target search
+	 */
+	struct pattern_t {
+		tinyNode_t N[4];                                   // constructed nodes starting at `NSTART`
+		uint8_t    normMap[tinyTree_t::TINYTREE_NSTART + 4]; // slot mapping as seen by `foundNode()`
+		uint8_t    root;                                   // tree root
+		uint8_t    count;                                  // tree size
+		uint8_t    nextNode3;                              // candidate node limit
+		uint8_t    nextSlot3;                              // candidate slot limit
+		uint8_t    tlQ, tlTu, tlF, tlTi;                   // top-level operands
+		uint32_t   dataPos;                                // allocated state
+		uint32_t   progress;                               // owner
+		char       label[5 * 5 + 1];                       // state label
+		char       desc[14];                               // "abc!def!ghi!!" style pattern, unique per pattern
+	};
+
+	/**
+	 * @date 2026-10-17 16:04:09
+	 *
+	 * Outcome of target search
+	 */
+	struct result_t {
+		char        origName[tinyTree_t::TINYTREE_NAMELEN + 1];
+		char        bestName[tinyTree_t::TINYTREE_NAMELEN + 1];
+		uint32_t    origScore;
+		uint32_t    bestScore;
+		uint32_t    bestSize;
+		uint32_t    bestData;
+#ifdef ENABLE_REWRITE_DESTRUCTIVE
+		footprint_t origFoot;
+#endif
+	};
+
+	/**
+	 * @date 2026-10-17 16:07:12
+	 *
+	 * Private search state per thread
+	 */
+	struct worker_t {
+		genrewritedataContext_t *pApp;
+		pthread_t               thread;
+		tinyTree_t              *pTree;
+		tinyTree_t              *pTestTree;
+		tinyTree_t              *pBestTree;
+		footprint_t             *pEval;
+	};
+
 	/// @var {context_t} I/O context
 	context_t &ctx;
 
-	uint32_t opt_flags;
-	uint32_t opt_first;
+	uint32_t   opt_flags;
+	uint32_t   opt_first;
+	/// @var {number} --threads, number of worker threads
+	unsigned   opt_threads;
 
 	uint32_t iVersion;
 
@@ -81,6 +141,14 @@ struct genrewritedataContext_t {
 	uint32_t gCntTree;
 	uint32_t gCntNode[5];
 
+	// enumerated patterns
+	uint32_t          numPatterns;
+	uint32_t          maxPatterns;
+	pattern_t         *pPatterns;
+	result_t          *pResults;
+	uint32_t          nextPattern;  // next pattern to claim by workers
+	volatile uint32_t numSearched;  // patterns completed by workers
+
 	genrewritedataContext_t(context_t &ctx)
 	/*
 	 * initialize fields using initializer lists
@@ -89,6 +157,7 @@ struct genrewritedataContext_t {
 		ctx(ctx),
 		opt_flags(0),
 		opt_first(1<<5), // assuming tinyTree_t nodeID's fit in 5 bits, so start after that
+		opt_threads(sysconf(_SC_NPROCESSORS_ONLN)),
 		iVersion(1),
 		// imprint store
 		numPrints(0), // do not start at 0
@@ -109,7 +178,14 @@ struct genrewritedataContext_t {
 		gData((uint32_t *) ctx.myAlloc("gData", maxData, sizeof(*gData))),
 		gDataLength((uint8_t *) ctx.myAlloc("gDataLength", maxData, sizeof(*gDataLength))),
 		gDataLabel((char **) ctx.myAlloc("gDataLabel", maxData, sizeof(*gDataLabel))),
-		gDataOwner((uint32_t *) ctx.myAlloc("gDataOwner", maxData, sizeof(*gDataOwner)))
+		gDataOwner((uint32_t *) ctx.myAlloc("gDataOwner", maxData, sizeof(*gDataOwner))),
+		//
+		numPatterns(0),
+		maxPatterns(1000000),
+		pPatterns((pattern_t *) ctx.myAlloc("pPatterns", maxPatterns, sizeof(*pPatterns))),
+		pResults((result_t *) ctx.myAlloc("pResults", maxPatterns, sizeof(*pResults))),
+		nextPattern(0),
+		numSearched(0)
 
 	/*
 	 * test all allocations succeeded
@@ -847,13 +923,14 @@ struct genrewritedataContext_t {
 		return pos;
 	}
 
-	void main(void) {
-		/*
-		 * Create evaluator vector for 4n9.
-		 */
-
-		footprint_t *pEval = (footprint_t *) ctx.myAlloc("pEval", tinyTree_t::TINYTREE_NEND, sizeof(*pEval));
-
+	/**
+	 * @date 2026-10-17 16:10:14
+	 *
+	 * Create evaluator vector for 4n9.
+	 *
+	 * @param {footprint_t[]} pEval - evaluator with `TINYTREE_NEND` entries
+	 */
+	static void initEvaluator(footprint_t *pEval) {
 		// set 64bit slice to zero
 		for (unsigned i = 0; i < tinyTree_t::TINYTREE_NEND; i++)
 			for (unsigned j = 0; j<footprint_t::QUADPERFOOTPRINT; j++)
@@ -874,16 +951,181 @@ struct genrewritedataContext_t {
 			if (i & (1 << 7)) pEval[tinyTree_t::TINYTREE_KSTART + 7].bits[i / 64] |= 1LL << (i % 64);
 			if (i & (1 << 8)) pEval[tinyTree_t::TINYTREE_KSTART + 8].bits[i / 64] |= 1LL << (i % 64);
 		}
+	}
+
+	/**
+	 * @date 2026-10-17 16:24:45
+	 *
+	 * Find highest scoring target for a pattern.
+	 * Candidates are all permutations of 3-out-of-N slots.
+	 *
+	 * Runs inside worker threads: only reads the pattern and writes the result,
+	 * trees and evaluator are private to the worker.
+	 *
+	 * @param {worker_t} pWorker - private trees and evaluator
+	 * @param {pattern_t} pPattern - constructed pattern
+	 * @param {result_t} pResult - rewrite target
+	 */
+	void searchPattern(worker_t *pWorker, const pattern_t *pPattern, result_t *pResult) {
+		const unsigned NSTART     = tinyTree_t::TINYTREE_NSTART;
+		const unsigned NAMELENGTH = tinyTree_t::TINYTREE_NAMELEN;
+
+		tinyTree_t     &tree     = *pWorker->pTree;
+		tinyTree_t     &testTree = *pWorker->pTestTree;
+		tinyTree_t     &bestTree = *pWorker->pBestTree;
+		footprint_t    *pEval    = pWorker->pEval;
+		const uint8_t  *normMap  = pPattern->normMap;
+		const uint32_t nextNode3 = pPattern->nextNode3;
+		const uint32_t nextSlot3 = pPattern->nextSlot3;
+
+		// restore constructed tree
+		for (uint32_t iNode = 0; iNode < 4; iNode++)
+			tree.N[NSTART + iNode] = pPattern->N[iNode];
+		tree.root  = pPattern->root;
+		tree.count = pPattern->count;
 
+		/*
+		 * capture name, origScore, footprint and top-level Q/T/F
+		 */
+
+		char skin[31];
+		tree.saveString(tree.root, pResult->origName, skin);
+
+		pResult->origScore = tree.calcScoreName(pResult->origName);
+
+		tree.eval(pEval);
+		footprint_t origFoot = pEval[tree.root];
+#ifdef ENABLE_REWRITE_DESTRUCTIVE
+		pResult->origFoot = origFoot;
+#endif
+
+		uint32_t origData = pPattern->tlTi << 12 | normMap[pPattern->tlQ] << 8 | normMap[pPattern->tlTu] << 4 | normMap[pPattern->tlF];
+
+		char     bestName[NAMELENGTH + 1] = {0};
+		uint32_t bestScore                = 0;
+		uint32_t bestSize                 = 0;
+		uint32_t bestData                 = 0;
+
+		// copy tree
+		testTree.N[NSTART + 0] = tree.N[NSTART + 0];
+		testTree.N[NSTART + 1] = tree.N[NSTART + 1];
+		testTree.N[NSTART + 2] = tree.N[NSTART + 2];
+		testTree.N[NSTART + 3] = tree.N[NSTART + 3];
+		testTree.root  = tree.root;
+		testTree.count = tree.count;
+
+		//@formatter:off
+		for (uint32_t testQ = 0; testQ < nextNode3; testQ++)
+		for (uint32_t testTu = 0; testTu < nextNode3; testTu++)
+		for (uint32_t testTi = 0; testTi < 2; testTi++)
+		for (uint32_t testF = 0; testF < nextNode3; testF++) {
+		//@formatter:on
+
+			if (testQ < NSTART && testQ > nextSlot3) continue;
+			if (testTu < NSTART && testTu > nextSlot3) continue;
+			if (testF < NSTART && testF > nextSlot3) continue;
+
+			// validate
+			if (testQ != testTu || testQ != testF || testTi) {
+				if (testQ == 0 && (testTu || testTi || testF)) continue;
+				if (testQ == testTu) continue;             // Q/T collapse
+				if (testQ == testF) continue;              // Q/F collapse
+				if (testTu == testF && testTi == 0) continue; // T/F collapse
+				if (testTu == 0 && testTi == 0) continue;  // Q?0:F -> F?!Q:0
+				if (testTu == 0 && testF == 0) continue;   // Q?!0:0 -> Q
+			}
+
+			/*
+			 * Load into a test tree
+			 */
+
+			testTree.N[NSTART + 0] = tree.N[NSTART + 0];
+			testTree.N[NSTART + 1] = tree.N[NSTART + 1];
+			testTree.N[NSTART + 2] = tree.N[NSTART + 2];
+			testTree.count = tree.count;
+			testTree.root = testTree.addNode(testQ, testTu ^ (testTi ? IBIT : 0), testF);
+
+			// create a data word before tree changes (references will change when tree shrinks)
+			uint32_t testData = (testTi ? 1 : 0) << 12 | normMap[testQ] << 8 | normMap[testTu] << 4 | normMap[testF];
+
+			// reload tree for optimal name and origScore
+			// NOTE: use private name storage, the static `saveString()` wrapper is shared between threads
+			char name[NAMELENGTH + 1];
+			testTree.saveString(testTree.root, name, NULL);
+			testTree.loadStringFast(name);
+
+			// test if footprint match
+			testTree.eval(pEval);
+			if (!origFoot.equals(pEval[testTree.root]))
+				continue;
+
+			// determine if better target
+			uint64_t testScore = testTree.calcScoreName(name);
+			if (bestName[0] == 0 || testScore < bestScore || (testScore == bestScore && testTree.compare(testTree.root, bestTree, bestTree.root) < 0)) {
+				// rember best candidate
+				for (uint32_t iNode=NSTART; iNode<tree.count; iNode++)
+					bestTree.N[iNode] = tree.N[iNode];
+				bestTree.root = tree.root;
+				testTree.saveString(testTree.root, bestName, NULL);
+				bestScore = testScore;
+				bestSize  = testTree.count - NSTART;
+
+				if (testTree.root < NSTART) {
+					bestData = REWRITEMASK_COLLAPSE | normMap[testTree.root]; // collapse
+				} else {
+					bestData = testData;
+					if (bestData == origData)
+						bestData |= REWRITEMASK_FOUND; // mark no rewrite required
+
+					// merge power for statistics
+					bestData |= (tree.count - testTree.count) << REWRITEFLAG_POWER;
+				}
+			}
+		}
+		assert(bestName[0]);
+
+		strcpy(pResult->bestName, bestName);
+		pResult->bestScore = bestScore;
+		pResult->bestSize  = bestSize;
+		pResult->bestData  = bestData;
+	}
+
+	/**
+	 * @date 2026-10-17 16:31:20
+	 *
+	 * Worker entry. Claim chunks of patterns until exhausted.
+	 */
+	static void *workerEntry(void *arg) {
+		worker_t                *pWorker = (worker_t *) arg;
+		genrewritedataContext_t *pApp    = pWorker->pApp;
+
+		for (;;) {
+			uint32_t iLo = __sync_fetch_and_add(&pApp->nextPattern, CHUNKSIZE);
+			if (iLo >= pApp->numPatterns)
+				break;
+
+			uint32_t iHi = iLo + CHUNKSIZE;
+			if (iHi > pApp->numPatterns)
+				iHi = pApp->numPatterns;
+
+			for (uint32_t iPattern = iLo; iPattern < iHi; iPattern++)
+				pApp->searchPattern(pWorker, pApp->pPatterns + iPattern, pApp->pResults + iPattern);
+
+			__sync_fetch_and_add(&pApp->numSearched, iHi - iLo);
+		}
+
+		return NULL;
+	}
+
+	void main(void) {
 		/*
 		 * Create trees.
 		 * NOTE: `baseTree_t` are not allowed because they depend on data this program generates
 		 */
 		tinyTree_t tree(ctx);
-		tinyTree_t testTree(ctx);
 
 		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
-			fprintf(stderr, "\r\e[K[%s] Find sources [progress(speed) eta cntFound cntShrink cntNode0 cntNode1 cntNode2 cntNode3 cntNode4]\n", ctx.timeAsString());
+			fprintf(stderr, "\r\e[K[%s] Find sources\n", ctx.timeAsString());
 
 		// setup first block
 		numData = opt_first;
@@ -899,12 +1141,15 @@ struct genrewritedataContext_t {
 		 *
 		 * Construction is old (not ancient) code.
 		 * Keeping it for posterity and as an independent implementation to optionally compare with the generator.
+		 *
+		 * @date 2026-10-17 16:35:08
+		 * Enumeration and state allocation is serial and fast, it determines the state-machine numbering.
+		 * The expensive target search is deferred to worker threads, results are committed in enumeration order.
 		 */
 
 		ctx.setupSpeed(940140); // 198072;
 
 		const unsigned NSTART     = tinyTree_t::TINYTREE_NSTART;
-		const unsigned NAMELENGTH = tinyTree_t::TINYTREE_NAMELEN;
 
 		//@formatter:off
 		for (uint32_t Q1 = 1; Q1 < NSTART+0; Q1++)
@@ -1044,29 +1289,6 @@ struct genrewritedataContext_t {
 					for (uint32_t tlTi = 0; tlTi < 2; tlTi++) {
 						ctx.progress++;
 
-						if (ctx.tick && ctx.opt_verbose >= ctx.VERBOSE_TICK) {
-							int perSecond = ctx.updateSpeed();
-
-							int eta = (int) ((ctx.progressHi - ctx.progress) / perSecond);
-
-							int etaH = eta / 3600;
-							eta %= 3600;
-							int etaM = eta / 60;
-							eta %= 60;
-							int etaS = eta;
-
-							fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) %.5f%% %3d:%02d:%02d %d %d %d(%.2f%%) %d(%.2f%%) %d(%.2f%%) %d(%.2f%%) %d(%.2f%%)",
-								ctx.timeAsString(), ctx.progress, perSecond, ctx.progress * 100.0 / ctx.progressHi, etaH, etaM, etaS,
-								gCntFound, gCntTree,
-								gCntNode[0], gCntNode[0] * 100.0 / gCntFound,
-								gCntNode[1], gCntNode[1] * 100.0 / gCntFound,
-								gCntNode[2], gCntNode[2] * 100.0 / gCntFound,
-								gCntNode[3], gCntNode[3] * 100.0 / gCntFound,
-								gCntNode[4], gCntNode[4] * 100.0 / gCntFound);
-
-							ctx.tick = 0;
-						}
-
 						// construct a tree
 						tree.count = nextNode3;
 						tree.root  = tree.addNode(tlQ, tlTu ^ (tlTi ? IBIT : 0), tlF);
@@ -1104,178 +1326,6 @@ struct genrewritedataContext_t {
 						if (numData >= this->maxData)
 							ctx.fatal("\n[%s %s:%u storage full %d]\n", __FUNCTION__, __FILE__, __LINE__, this->maxData);
 
-						/*
-						 * capture name, origScore, footprint and top-level Q/T/F
-						 */
-
-						char origName[NAMELENGTH + 1];
-						char skin[31];
-						tree.saveString(tree.root, origName, skin);
-
-//						printf("@@ %s\n", origName);
-
-						uint32_t origScore = tree.calcScoreName(origName);
-
-						tree.eval(pEval);
-						footprint_t origFoot = pEval[tree.root];
-
-						uint32_t origData = tlTi << 12 | normMap[tlQ] << 8 | normMap[tlTu] << 4 | normMap[tlF];
-
-						/*
-						 * Find highest scoring target
-						 * Candidates are all permutations of 3-out-of-N slots
-						 */
-
-						tinyTree_t bestTree(ctx);
-						char       bestName[NAMELENGTH + 1] = {0};
-						uint32_t   bestScore                = 0;
-						uint32_t   bestSize                 = 0;
-						uint32_t   bestData                 = 0;
-
-						{
-							// copy tree
-							testTree.N[NSTART + 0] = tree.N[NSTART + 0];
-							testTree.N[NSTART + 1] = tree.N[NSTART + 1];
-							testTree.N[NSTART + 2] = tree.N[NSTART + 2];
-							testTree.N[NSTART + 3] = tree.N[NSTART + 3];
-							testTree.root  = tree.root;
-							testTree.count = tree.count;
-
-
-							//@formatter:off
-							for (uint32_t testQ = 0; testQ < nextNode3; testQ++)
-							for (uint32_t testTu = 0; testTu < nextNode3; testTu++)
-							for (uint32_t testTi = 0; testTi < 2; testTi++)
-							for (uint32_t testF = 0; testF < nextNode3; testF++) {
-							//@formatter:on
-
-								if (testQ < NSTART && testQ > nextSlot3) continue;
-								if (testTu < NSTART && testTu > nextSlot3) continue;
-								if (testF < NSTART && testF > nextSlot3) continue;
-
-								// validate
-								if (testQ != testTu || testQ != testF || testTi) {
-									if (testQ == 0 && (testTu || testTi || testF)) continue;
-									if (testQ == testTu) continue;             // Q/T collapse
-									if (testQ == testF) continue;              // Q/F collapse
-									if (testTu == testF && testTi == 0) continue; // T/F collapse
-									if (testTu == 0 && testTi == 0) continue;  // Q?0:F -> F?!Q:0
-									if (testTu == 0 && testF == 0) continue;   // Q?!0:0 -> Q
-								}
-
-								/*
-								 * Load into a test tree
-								 */
-
-								testTree.N[NSTART + 0] = tree.N[NSTART + 0];
-								testTree.N[NSTART + 1] = tree.N[NSTART + 1];
-								testTree.N[NSTART + 2] = tree.N[NSTART + 2];
-								testTree.count = tree.count;
-								testTree.root = testTree.addNode(testQ, testTu ^ (testTi ? IBIT : 0), testF);
-
-								// create a data word before tree changes (references will change when tree shrinks)
-								uint32_t testData = (testTi ? 1 : 0) << 12 | normMap[testQ] << 8 | normMap[testTu] << 4 | normMap[testF];
-
-								// reload tree for optimal name and origScore
-								const char *pName = testTree.saveString(testTree.root);
-								testTree.loadStringFast(pName);
-
-								// test if footprint match
-								testTree.eval(pEval);
-								if (!origFoot.equals(pEval[testTree.root]))
-									continue;
-
-								// determine if better target
-								uint64_t testScore = testTree.calcScoreName(pName);
-								if (bestName[0] == 0 || testScore < bestScore || (testScore == bestScore && testTree.compare(testTree.root, bestTree, bestTree.root) < 0)) {
-									// rember best candidate
-									for (uint32_t iNode=NSTART; iNode<tree.count; iNode++)
-										bestTree.N[iNode] = tree.N[iNode];
-									bestTree.root = tree.root;
-									strcpy(bestName, testTree.saveString(testTree.root));
-									bestScore = testScore;
-									bestSize  = testTree.count - NSTART;
-
-									if (testTree.root < NSTART) {
-										bestData = REWRITEMASK_COLLAPSE | normMap[testTree.root]; // collapse
-									} else {
-										bestData = testData;
-										if (bestData == origData)
-											bestData |= REWRITEMASK_FOUND; // mark no rewrite required
-
-										// merge power for statistics
-										bestData |= (tree.count - testTree.count) << REWRITEFLAG_POWER;
-									}
-								}
-							}
-							assert(bestName[0]);
-						}
-
-#ifdef ENABLE_REWRITE_DESTRUCTIVE
-						/*
-						 * OPTIONAL: Test if there is a rewrite that shrinks but is destructive
-						 */
-						{
-							// start with footprint
-							uint32_t ix     = lookupPrint(origFoot);
-							uint32_t iPrint = printIndex[ix];
-
-							if (iPrint) {
-								print_t *pPrint = prints + iPrint;
-								if (pPrint->size < bestSize) {
-									strcpy(bestName, pPrint->name);
-									bestScore = pPrint->origScore;
-									bestSize = pPrint->size;
-
-									// encode tree, max 3 nodes
-									assert(pPrint->size > 0 && pPrint->size <= 3);
-
-									testTree.loadStringFast(pPrint->name);
-
-									uint64_t treedata = 0;
-
-									for (uint32_t i=testTree.root; i>=NSTART; i--) {
-										const tinyNode_t *pNode = testTree.N + i;
-										uint32_t Q  = pNode->Q;
-										uint32_t Tu = pNode->T & ~IBIT;
-										uint32_t Ti = pNode->T & IBIT;
-										uint32_t F  = pNode->F;
-
-										// encode the runtime endpoints
-										if (Q < NSTART)
-											Q =  normMap[Q];
-										if (Tu < NSTART)
-											Tu =  normMap[Tu];
-										if (F < NSTART)
-											F =  normMap[F];
-
-										treedata = treedata << 16 | (Ti?1:0) << 12 | Q << 8 | Tu << 4 | F << 0;
-									}
-
-									bestData = REWRITEMASK_TREE | numDataTree; // encode tree id
-
-									gDataTree[numDataTree++] = treedata; // save 64bits data
-
-									if (this->numDataTree >= this->maxDataTree)
-										context_t::fatal("\n[%s %s:%u gDataTree full %d]\n", __FUNCTION__, __FILE__, __LINE__, this->maxDataTree);
-								}
-							}
-						}
-#endif
-
-						/*
-						 * update counters
-						 */
-						gCntFound++;
-
-
-						if (bestData & REWRITEMASK_TREE) {
-							gCntTree++;
-							gCntNode[bestSize]++;
-						} else if (!(bestData & (1 << 31))) {
-							gCntNode[bestSize]++;
-						}
-
 						/*
 						 * Note, last Ti is not an index but an offset
 						 */
@@ -1287,19 +1337,33 @@ struct genrewritedataContext_t {
 						}
 						assert(gDataLength[dataPos] == 2);
 
-						// add state
-						// Collisions might exist (like "a0b!000?a0b!?"), as long as their rewrite are the same
-						assert(gData[dataPos + tlTi] == 0 || gData[dataPos + tlTi] == bestData);
-
-						// save rewrite data
-						gData[dataPos + tlTi]      = bestData;
-						gDataOwner[dataPos + tlTi] = ctx.progress;
+						/*
+						 * Capture pattern for target search
+						 */
+						if (numPatterns >= maxPatterns)
+							ctx.fatal("\n[%s %s:%u storage full %d]\n", __FUNCTION__, __FILE__, __LINE__, this->maxPatterns);
+
+						pattern_t *pPattern = pPatterns + numPatterns++;
+
+						for (uint32_t iNode = 0; iNode < 4; iNode++)
+							pPattern->N[iNode] = tree.N[NSTART + iNode];
+						for (uint32_t iSlot = 0; iSlot < NSTART + 4; iSlot++)
+							pPattern->normMap[iSlot] = normMap[iSlot];
+						pPattern->root      = tree.root;
+						pPattern->count     = tree.count;
+						pPattern->nextNode3 = nextNode3;
+						pPattern->nextSlot3 = nextSlot3;
+						pPattern->tlQ       = tlQ;
+						pPattern->tlTu      = tlTu;
+						pPattern->tlF       = tlF;
+						pPattern->tlTi      = tlTi;
+						pPattern->dataPos   = dataPos;
+						pPattern->progress  = ctx.progress;
 
 						// save name
 						label[lenLabel] = tlTi ? '!' : '?';
-						asprintf(&gDataLabel[dataPos + tlTi],
-							 "%s %c%c%c%c%c%c%c%c%c%c%c%c%c (%x) -> %s (%x)",
-							 label,
+						strcpy(pPattern->label, label);
+						snprintf(pPattern->desc, sizeof(pPattern->desc), "%c%c%c%c%c%c%c%c%c%c%c%c%c",
 							 "0abcdefghiQTF..."[Q1],
 							 "0abcdefghiQTF..."[Tu1],
 							 "0abcdefghiQTF..."[F1],
@@ -1312,18 +1376,177 @@ struct genrewritedataContext_t {
 							 "0abcdefghiQTF..."[Tu3],
 							 "0abcdefghiQTF..."[F3],
 							 "?!.............."[Ti3],
-							 "?!.............."[tlTi],
-							 origScore,
-							 bestName, bestScore
-						);
+							 "?!.............."[tlTi]);
+					}
+				}
+			}
+		}
+		if (ctx.progress != ctx.progressHi)
+			fprintf(stderr, "[progressHi=%ld]\n", ctx.progress);
+
+		/*
+		 * Search targets in parallel
+		 */
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "\r\e[K[%s] Search targets threads=%u [progress(speed) eta]\n", ctx.timeAsString(), opt_threads);
+
+		worker_t *pWorkers = new worker_t[opt_threads];
+
+		// NOTE: allocate from main thread, `myAlloc()` is not thread-safe
+		for (unsigned iThread = 0; iThread < opt_threads; iThread++) {
+			worker_t *pWorker = pWorkers + iThread;
+
+			pWorker->pApp      = this;
+			pWorker->pTree     = new tinyTree_t(ctx);
+			pWorker->pTestTree = new tinyTree_t(ctx);
+			pWorker->pBestTree = new tinyTree_t(ctx);
+			pWorker->pEval     = (footprint_t *) ctx.myAlloc("pEval", tinyTree_t::TINYTREE_NEND, sizeof(*pWorker->pEval));
+			initEvaluator(pWorker->pEval);
+		}
+
+		ctx.setupSpeed(numPatterns);
+		ctx.tick    = 0;
+		nextPattern = 0;
+		numSearched = 0;
+
+		for (unsigned iThread = 0; iThread < opt_threads; iThread++) {
+			int ret = pthread_create(&pWorkers[iThread].thread, NULL, workerEntry, pWorkers + iThread);
+			if (ret)
+				ctx.fatal("\n{\"error\":\"pthread_create() failed\",\"where\":\"%s:%s:%d\",\"return\":%d}\n",
+					  __FUNCTION__, __FILE__, __LINE__, ret);
+		}
+
+		while (numSearched < numPatterns) {
+			usleep(100000);
+
+			if (ctx.tick && ctx.opt_verbose >= ctx.VERBOSE_TICK) {
+				ctx.progress = numSearched;
+
+				int perSecond = ctx.updateSpeed();
+
+				int eta = (int) ((ctx.progressHi - ctx.progress) / perSecond);
+
+				int etaH = eta / 3600;
+				eta %= 3600;
+				int etaM = eta / 60;
+				eta %= 60;
+				int etaS = eta;
+
+				fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) %.5f%% %3d:%02d:%02d",
+					ctx.timeAsString(), ctx.progress, perSecond, ctx.progress * 100.0 / ctx.progressHi, etaH, etaM, etaS);
+
+				ctx.tick = 0;
+			}
+		}
+
+		for (unsigned iThread = 0; iThread < opt_threads; iThread++) {
+			pthread_join(pWorkers[iThread].thread, NULL);
+
+			ctx.myFree("pEval", pWorkers[iThread].pEval);
+			delete pWorkers[iThread].pTree;
+			delete pWorkers[iThread].pTestTree;
+			delete pWorkers[iThread].pBestTree;
+		}
+		delete[] pWorkers;
+
+		/*
+		 * Commit results in enumeration order
+		 */
+		for (uint32_t iPattern = 0; iPattern < numPatterns; iPattern++) {
+			const pattern_t *pPattern = pPatterns + iPattern;
+			result_t        *pResult  = pResults + iPattern;
+			uint32_t        dataPos   = pPattern->dataPos;
+			uint32_t        tlTi      = pPattern->tlTi;
+
+#ifdef ENABLE_REWRITE_DESTRUCTIVE
+			/*
+			 * OPTIONAL: Test if there is a rewrite that shrinks but is destructive
+			 */
+			{
+				const uint8_t *normMap = pPattern->normMap;
+				tinyTree_t    testTree(ctx);
+
+				// start with footprint
+				uint32_t ix     = lookupPrint(pResult->origFoot);
+				uint32_t iPrint = printIndex[ix];
+
+				if (iPrint) {
+					print_t *pPrint = prints + iPrint;
+					if (pPrint->size < pResult->bestSize) {
+						strcpy(pResult->bestName, pPrint->name);
+						pResult->bestScore = pPrint->origScore;
+						pResult->bestSize = pPrint->size;
+
+						// encode tree, max 3 nodes
+						assert(pPrint->size > 0 && pPrint->size <= 3);
+
+						testTree.loadStringFast(pPrint->name);
+
+						uint64_t treedata = 0;
+
+						for (uint32_t i=testTree.root; i>=NSTART; i--) {
+							const tinyNode_t *pNode = testTree.N + i;
+							uint32_t Q  = pNode->Q;
+							uint32_t Tu = pNode->T & ~IBIT;
+							uint32_t Ti = pNode->T & IBIT;
+							uint32_t F  = pNode->F;
+
+							// encode the runtime endpoints
+							if (Q < NSTART)
+								Q =  normMap[Q];
+							if (Tu < NSTART)
+								Tu =  normMap[Tu];
+							if (F < NSTART)
+								F =  normMap[F];
+
+							treedata = treedata << 16 | (Ti?1:0) << 12 | Q << 8 | Tu << 4 | F << 0;
+						}
+
+						pResult->bestData = REWRITEMASK_TREE | numDataTree; // encode tree id
+
+						gDataTree[numDataTree++] = treedata; // save 64bits data
+
+						if (this->numDataTree >= this->maxDataTree)
+							context_t::fatal("\n[%s %s:%u gDataTree full %d]\n", __FUNCTION__, __FILE__, __LINE__, this->maxDataTree);
 					}
 				}
 			}
+#endif
+
+			/*
+			 * update counters
+			 */
+			gCntFound++;
+
+			if (pResult->bestData & REWRITEMASK_TREE) {
+				gCntTree++;
+				gCntNode[pResult->bestSize]++;
+			} else if (!(pResult->bestData & (1 << 31))) {
+				gCntNode[pResult->bestSize]++;
+			}
+
+			// add state
+			// Collisions might exist (like "a0b!000?a0b!?"), as long as their rewrite are the same
+			assert(gData[dataPos + tlTi] == 0 || gData[dataPos + tlTi] == pResult->bestData);
+
+			// save rewrite data
+			gData[dataPos + tlTi]      = pResult->bestData;
+			gDataOwner[dataPos + tlTi] = pPattern->progress;
+
+			// save name
+			asprintf(&gDataLabel[dataPos + tlTi],
+				 "%s %s (%x) -> %s (%x)",
+				 pPattern->label,
+				 pPattern->desc,
+				 pResult->origScore,
+				 pResult->bestName, pResult->bestScore
+			);
 		}
+
 		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY)
-			fprintf(stderr, "\r\e[K[%s] numData=%d numDataTree=%d\n",
+			fprintf(stderr, "\r\e[K[%s] numData=%d numDataTree=%d numPatterns=%u\n",
 				ctx.timeAsString(),
-				numData, numDataTree);
+				numData, numDataTree, numPatterns);
 
 		fprintf(stderr, "\r\e[K[%s] cntFound=%d cntTree=%d cntNode0=%d(%.2f%%) cntNode1=%d(%.2f%%) cntNode2=%d(%.2f%%) cntNode3=%d(%.2f%%) cntNode4=%d(%.2f%%)\n",
 			ctx.timeAsString(),
@@ -1333,8 +1556,6 @@ struct genrewritedataContext_t {
 			gCntNode[2], gCntNode[2] * 100.0 / gCntFound,
 			gCntNode[3], gCntNode[3] * 100.0 / gCntFound,
 			gCntNode[4], gCntNode[4] * 100.0 / gCntFound);
-		if (ctx.progress != ctx.progressHi)
-			fprintf(stderr, "[progressHi=%ld]\n", ctx.progress);
 
 		fprintf(stderr, "numData=%d\n", numData);
 
@@ -1409,6 +1630,7 @@ void usage(char *const *argv, bool verbose) {
 	if (verbose) {
 		fprintf(stderr, "\t   --first=<number> [default=%d]\n", app.opt_first);
 		fprintf(stderr, "\t-q --quiet\n");
+		fprintf(stderr, "\t   --threads=<number> [default=%u]\n", app.opt_threads);
 		fprintf(stderr, "\t   --timer=<seconds> [default=%d]\n", ctx.opt_timer);
 		fprintf(stderr, "\t-v --verbose\n");
 	}
@@ -1429,7 +1651,7 @@ int main(int argc, char *argv[]) {
 	for (;;) {
 		// Long option shortcuts
 		enum {
-			LO_HELP  = 1, LO_DEBUG, LO_TIMER, LO_FIRST,
+			LO_HELP  = 1, LO_DEBUG, LO_TIMER, LO_FIRST, LO_THREADS,
 			LO_QUIET = 'q', LO_VERBOSE = 'v'
 		};
 
@@ -1439,6 +1661,7 @@ int main(int argc, char *argv[]) {
 			{"first",   1, 0, LO_FIRST},
 			{"help",    0, 0, LO_HELP},
 			{"quiet",   2, 0, LO_QUIET},
+			{"threads", 1, 0, LO_THREADS},
 			{"timer",   1, 0, LO_TIMER},
 			{"verbose", 2, 0, LO_VERBOSE},
 
@@ -1477,6 +1700,11 @@ int main(int argc, char *argv[]) {
 		case LO_FIRST:
 			app.opt_first = (unsigned) strtoul(optarg, NULL, 10);
 			break;
+		case LO_THREADS:
+			app.opt_threads = (unsigned) strtoul(optarg, NULL, 10);
+			if (app.opt_threads < 1)
+				app.opt_threads = 1;
+			break;
 		case LO_TIMER:
 			ctx.opt_timer = (unsigned) strtoul(optarg, NULL, 10);
 			break;
@@ -174,6 +174,10 @@
 #include "dbtool.h"
 #include "generator.h"
 #include "metrics.h"
+#include "decorsort.h"
+#include "lookupcache.h"
+#include "pipeline.h"
+#include "restartcost.h"
 #include "restartdata.h"
 #include "tinytree.h"
 
@@ -212,18 +216,34 @@ struct gensignatureContext_t : dbtool_t {
 	unsigned   opt_generate;
 	/// @var {string} name of file containing members
 	const char *opt_load;
+	/// @var {number} prune associative lookups with imprint invariants
+	unsigned   opt_invariant;
+	/// @var {number} entries of candidate lookup cache, zero to disable
+	unsigned   opt_lookupCache;
 	/// @var {number} save level-1 indices (hintIndex, signatureIndex, ImprintIndex) and level-2 index (imprints)
 	unsigned   opt_saveIndex;
 	/// @var {number} save imprints with given interleave
 	unsigned   opt_saveInterleave;
 	/// @var {number} sort signatures before saving
 	unsigned   opt_sort;
+	/// @var {string} write restart tab cost profile
+	const char *opt_costProfile;
+	/// @var {string} shared claim file for `--dynamic`
+	const char *opt_dynamic;
+	/// @var {number} number of windows for `--dynamic`
+	unsigned   opt_dynamicWindows;
+	/// @var {string} restart tab cost profile for `--task`/`--dynamic`
+	const char *opt_restartCost;
+	/// @var {number} candidates timed per restart tab for `--costprofile`
+	unsigned   opt_sample;
 	/// @var {number} task Id. First task=1
 	unsigned   opt_taskId;
 	/// @var {number} Number of tasks / last task
 	unsigned   opt_taskLast;
 	/// @var {number} --text, textual output instead of binary database
 	unsigned   opt_text;
+	/// @var {number} worker threads for pipelined lookups and sorting, zero for serial
+	unsigned   opt_threads;
 	/// @var {number} truncate on database overflow
 	double     opt_truncate;
 	/// @var {number} generator upper bound
@@ -236,6 +256,10 @@ struct gensignatureContext_t : dbtool_t {
 
 	/// @var {number} - THE generator
 	generatorTree_t generator;
+	/// @var {candidatePipeline_t} pipelined lookups when `--threads`
+	candidatePipeline_t *pPipeline;
+	/// @var {lookupCache_t} cached serial lookups during generation
+	lookupCache_t   *pLookupCache;
 	/// @var {number} `foundTree()` duplicate by name
 	unsigned        skipDuplicate;
 	/// @var {number} Where database overflow was caught
@@ -254,17 +278,27 @@ struct gensignatureContext_t : dbtool_t {
 		opt_force          = 0;
 		opt_generate       = 1;
 		opt_load           = NULL;
+		opt_invariant      = 1;
+		opt_lookupCache    = LOOKUPCACHE_DEFAULT;
 		opt_saveIndex      = 1;
 		opt_saveInterleave = 0;
 		opt_sort           = 1;
+		opt_costProfile    = NULL;
+		opt_dynamic        = NULL;
+		opt_dynamicWindows = 256;
+		opt_restartCost    = NULL;
+		opt_sample         = 10000;
 		opt_taskId         = 0;
 		opt_taskLast       = 0;
 		opt_text           = 0;
+		opt_threads        = 0;
 		opt_truncate       = 0;
 		opt_windowHi       = 0;
 		opt_windowLo       = 0;
 
 		pStore        = NULL;
+		pPipeline     = NULL;
+		pLookupCache  = NULL;
 		skipDuplicate = 0;
 		truncated     = 0;
 		truncatedName[0] = 0;
@@ -299,6 +333,75 @@ struct gensignatureContext_t : dbtool_t {
 	 * @return {boolean} return `true` to continue with recursion (this should be always the case except for `genrestartdata`)
 	 */
 	bool foundTreeSignature(const generatorTree_t &treeR, const char *pNameR, unsigned numPlaceholder, unsigned numEndpoint, unsigned numBackRef) {
+		return foundSignature(treeR, pNameR, numPlaceholder, numEndpoint, numBackRef, NULL);
+	}
+
+	/**
+	 * @date 2026-10-17 15:20:48
+	 *
+	 * `foundTreeSignature()` for `--threads`, queue candidate for pipelined lookup
+	 *
+	 * @param {generatorTree_t} tree - candidate tree
+	 * @param {string} pName - tree notation/name
+	 * @param {number} numPlaceholder - number of unique endpoints/placeholders in tree
+	 * @param {number} numEndpoint - number of non-zero endpoints in tree
+	 * @param {number} numBackRef - number of back-references
+	 * @return {boolean} return `true` to continue with recursion
+	 */
+	bool foundTreePipeline(const generatorTree_t &treeR, const char *pNameR, unsigned numPlaceholder, unsigned numEndpoint, unsigned numBackRef) {
+		if (this->truncated)
+			return false; // quit as fast as possible
+
+		if (pPipeline->push(pNameR, numPlaceholder, numEndpoint, numBackRef))
+			commitPipeline();
+
+		return !this->truncated;
+	}
+
+	/**
+	 * @date 2026-10-17 15:24:16
+	 *
+	 * Commit batch finished by pipeline workers in candidate order, then dispatch the filled batch.
+	 */
+	void commitPipeline(void) {
+		const candidatePipeline_t::candidate_t *pBatch;
+		unsigned                               numBatch;
+
+		pPipeline->wait(&pBatch, &numBatch);
+
+		uint64_t   saveProgress = ctx.progress;
+		tinyTree_t tree(ctx);
+
+		for (unsigned i = 0; i < numBatch && !this->truncated; i++) {
+			const candidatePipeline_t::candidate_t *pCandidate = pBatch + i;
+
+			// replay generator state of candidate
+			ctx.progress = pCandidate->progress;
+			tree.loadStringFast(pCandidate->name);
+
+			foundSignature(tree, pCandidate->name, pCandidate->numPlaceholder, pCandidate->numEndpoint, pCandidate->numBackRef, pCandidate);
+		}
+
+		ctx.progress = saveProgress;
+
+		pPipeline->dispatch();
+	}
+
+	/**
+	 * @date 2026-10-17 15:27:39
+	 *
+	 * Body of `foundTreeSignature()`.
+	 * With `pSpeculative` the associative lookup result of the pipeline is used when still valid.
+	 *
+	 * @param {tinyTree_t} tree - candidate tree
+	 * @param {string} pName - tree notation/name
+	 * @param {number} numPlaceholder - number of unique endpoints/placeholders in tree
+	 * @param {number} numEndpoint - number of non-zero endpoints in tree
+	 * @param {number} numBackRef - number of back-references
+	 * @param {candidate_t} pSpeculative - pipelined lookup result, or NULL
+	 * @return {boolean} return `true` to continue with recursion
+	 */
+	bool foundSignature(const tinyTree_t &treeR, const char *pNameR, unsigned numPlaceholder, unsigned numEndpoint, unsigned numBackRef, const candidatePipeline_t::candidate_t *pSpeculative) {
 
 		if (this->truncated)
 			return false; // quit as fast as possible
@@ -326,10 +429,10 @@ struct gensignatureContext_t : dbtool_t {
 				 *
 				 *   ctx.progress is candidateId
 				 *   ctx.progressHi is ticker upper limit
-				 *   treeR.windowLo/treeR.windowHi is ctx.progress limits. windowHi can be zero
+				 *   generator.windowLo/generator.windowHi is ctx.progress limits. windowHi can be zero
 				 */
 				fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) %.5f%% eta=%d:%02d:%02d | numSignature=%u(%.0f%%) numImprint=%u(%.0f%%) | skipDuplicate=%u hash=%.3f %s",
-					ctx.timeAsString(), ctx.progress, perSecond, (ctx.progress - treeR.windowLo) * 100.0 / (ctx.progressHi - treeR.windowLo), etaH, etaM, etaS,
+					ctx.timeAsString(), ctx.progress, perSecond, (ctx.progress - generator.windowLo) * 100.0 / (ctx.progressHi - generator.windowLo), etaH, etaM, etaS,
 					pStore->numSignature, pStore->numSignature * 100.0 / pStore->maxSignature,
 					pStore->numImprint, pStore->numImprint * 100.0 / pStore->maxImprint,
 					skipDuplicate, (double) ctx.cntCompare / ctx.cntHash, pNameR);
@@ -397,6 +500,13 @@ struct gensignatureContext_t : dbtool_t {
 			 */
 			// add to imprints to index
 			sid = pStore->addImprintAssociative(&treeR, pStore->fwdEvaluator, pStore->revEvaluator, markSid);
+		} else if (pSpeculative && pPipeline->isValid(pSpeculative)) {
+			// pipelined lookup still valid
+			sid = pSpeculative->sid;
+		} else if (pLookupCache) {
+			// candidates sharing a footprint share the lookup result
+			unsigned tid = 0;
+			pLookupCache->lookupImprintAssociative(pStore, &treeR, pStore->fwdEvaluator, pStore->revEvaluator, &sid, &tid);
 		} else {
 			unsigned tid = 0;
 			pStore->lookupImprintAssociative(&treeR, pStore->fwdEvaluator, pStore->revEvaluator, &sid, &tid);
@@ -510,17 +620,45 @@ struct gensignatureContext_t : dbtool_t {
 	/**
 	 * @date 2020-03-27 17:05:07
 	 *
-	 * Compare function for `qsort_r`
+	 * Sort key for `decoratedSort_t`, replaces the leading part of the former `qsort_r` comparator
+	 *
+	 * @date 2026-10-17 18:47:50
+	 *
+	 * Ordering: number of nodes, placeholders, endpoints and back-references.
+	 * The tree is parsed once per signature instead of twice per comparison.
+	 *
+	 * @param {signature_t} pElement - signature
+	 * @param {context_t} arg - I/O context
+	 * @return {number} packed sort key
+	 */
+	static uint64_t keySignature(const void *pElement, void *arg) {
+		const signature_t *pSignature = static_cast<const signature_t *>(pElement);
+		context_t         *pApp       = static_cast<context_t *>(arg);
+
+		tinyTree_t tree(*pApp);
+		tree.loadStringFast(pSignature->name);
+
+		uint64_t key = 0;
+
+		key |= (uint64_t) tree.count << 48;                 // prime goal: reducing number of nodes
+		key |= (uint64_t) pSignature->numPlaceholder << 40; // secondary goal: reduce number of unique endpoints, thus connections
+		key |= (uint64_t) pSignature->numEndpoint << 32;    // preferred display selection: least number of endpoints
+		key |= (uint64_t) pSignature->numBackRef << 24;     // preferred display selection: least number of back-references
+
+		return key;
+	}
+
+	/**
+	 * @date 2026-10-17 18:47:50
+	 *
+	 * Tie comparator for `decoratedSort_t`, only called for signatures with equal keys
 	 *
 	 * @param {signature_t} lhs - left hand side signature
 	 * @param {signature_t} rhs - right hand side signature
 	 * @param {context_t} arg - I/O context
 	 * @return "<0" if "L<R", "0" if "L==R", ">0" if "L>R"
 	 */
-	static int comparSignature(const void *lhs, const void *rhs, void *arg) {
-		if (lhs == rhs)
-			return 0;
-
+	static int tieSignature(const void *lhs, const void *rhs, void *arg) {
 		const signature_t *pSignatureL = static_cast<const signature_t *>(lhs);
 		const signature_t *pSignatureR = static_cast<const signature_t *>(rhs);
 		context_t         *pApp        = static_cast<context_t *>(arg);
@@ -532,35 +670,8 @@ struct gensignatureContext_t : dbtool_t {
 		treeL.loadStringFast(pSignatureL->name);
 		treeR.loadStringFast(pSignatureR->name);
 
-		/*
-		 * Compare
-		 */
-
-		int cmp = 0;
-
-		// Test for prime goal: reducing number of nodes
-		cmp = treeL.count - treeR.count;
-		if (cmp)
-			return cmp;
-
-		// Test for secondary goal: reduce number of unique endpoints, thus connections
-		cmp = pSignatureL->numPlaceholder - pSignatureR->numPlaceholder;
-		if (cmp)
-			return cmp;
-
-		// Test for preferred display selection: least number of endpoints
-		cmp = pSignatureL->numEndpoint - pSignatureR->numEndpoint;
-		if (cmp)
-			return cmp;
-
-		// Test for preferred display selection: least number of back-references
-		cmp = pSignatureL->numBackRef - pSignatureR->numBackRef;
-		if (cmp)
-			return cmp;
-
 		// Compare layouts, expensive
-		cmp = treeL.compare(treeL.root, treeR, treeR.root);
-		return cmp;
+		return treeL.compare(treeL.root, treeR, treeR.root);
 	}
 
 	/**
@@ -571,6 +682,7 @@ struct gensignatureContext_t : dbtool_t {
 	void rebuildImprints(void) {
 		// clear signature and imprint index
 		::memset(pStore->imprintIndex, 0, pStore->imprintIndexSize * sizeof(*pStore->imprintIndex));
+		pStore->clearImprintFilter();
 
 		if (pStore->numSignature < 2)
 			return; //nothing to do
@@ -817,6 +929,14 @@ struct gensignatureContext_t : dbtool_t {
 		ctx.tick = 0;
 		skipDuplicate = 0;
 
+		// cache lookups of candidates with identical footprints
+		lookupCache_t lookupCache(ctx, opt_lookupCache);
+		uint64_t      cntCacheHit = 0, cntCacheMiss = 0;
+		pLookupCache = &lookupCache;
+
+		// skip rows that can not match by cofactor weights
+		if (opt_invariant)
+			pStore->enableImprintInvariant();
 
 		/*
 		 * Generate candidates
@@ -834,9 +954,30 @@ struct gensignatureContext_t : dbtool_t {
 
 			generator.initialiseGenerator(ctx.flags & context_t::MAGICMASK_PURE);
 			generator.clearGenerator();
-			generator.generateTrees(arg_numNodes, endpointsLeft, 0, 0, this, static_cast<generatorTree_t::generateTreeCallback_t>(&gensignatureContext_t::foundTreeSignature));
+
+			if (opt_threads && !((ctx.flags & context_t::MAGICMASK_AINF) && !this->readOnlyMode)) {
+				// pipelined, enumerate here and lookup in worker threads
+				candidatePipeline_t pipeline(ctx, pStore, opt_threads, 1 << 16, opt_lookupCache);
+				pPipeline = &pipeline;
+
+				generator.generateTrees(arg_numNodes, endpointsLeft, 0, 0, this, static_cast<generatorTree_t::generateTreeCallback_t>(&gensignatureContext_t::foundTreePipeline));
+
+				// flush in-flight and partially filled batch
+				commitPipeline();
+				commitPipeline();
+
+				pipeline.cacheStats(&cntCacheHit, &cntCacheMiss);
+
+				pPipeline = NULL;
+			} else {
+				generator.generateTrees(arg_numNodes, endpointsLeft, 0, 0, this, static_cast<generatorTree_t::generateTreeCallback_t>(&gensignatureContext_t::foundTreeSignature));
+			}
 		}
 
+		pLookupCache = NULL;
+		cntCacheHit += lookupCache.cntHit;
+		cntCacheMiss += lookupCache.cntMiss;
+
 		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
 			fprintf(stderr, "\r\e[K");
 
@@ -859,6 +1000,46 @@ struct gensignatureContext_t : dbtool_t {
 				pStore->numImprint, pStore->numImprint * 100.0 / pStore->maxImprint,
 				skipDuplicate);
 
+		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY && opt_lookupCache)
+			fprintf(stderr, "[%s] lookupCache: hit=%lu miss=%lu rate=%.1f%%\n",
+				ctx.timeAsString(), cntCacheHit, cntCacheMiss,
+				cntCacheHit + cntCacheMiss ? cntCacheHit * 100.0 / (cntCacheHit + cntCacheMiss) : 0.0);
+	}
+
+	/**
+	 * @date 2026-10-17 12:21:44
+	 *
+	 * Write restart tab cost profile for `--restartcost`.
+	 * Times `foundTreeSignature()` on the first `--sample` candidates of every restart tab, signatures found are added as in a normal run.
+	 *
+	 * @param {restartCost_t} restartCost - profile writer
+	 */
+	void costFromGenerator(restartCost_t &restartCost) {
+
+		unsigned ofs = 0;
+		if (this->arg_numNodes > 4 && this->arg_numNodes < tinyTree_t::TINYTREE_MAXNODES)
+			ofs = restartIndex[this->arg_numNodes][(ctx.flags & context_t::MAGICMASK_PURE) ? 1 : 0];
+		const metricsGenerator_t *pMetrics = getMetricsGenerator(MAXSLOTS, ctx.flags & context_t::MAGICMASK_PURE, arg_numNodes);
+		if (!ofs || !pMetrics)
+			ctx.fatal("\n{\"error\":\"no restart data or metrics\",\"where\":\"%s:%s:%d\",\"numNode\":%u}\n", __FUNCTION__, __FILE__, __LINE__, arg_numNodes);
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "[%s] Sampling restart tabs for %un%u%s\n", ctx.timeAsString(), arg_numNodes, MAXSLOTS, ctx.flags & context_t::MAGICMASK_PURE ? "-pure" : "");
+
+		// same lookup shortcuts as a normal run
+		lookupCache_t lookupCache(ctx, opt_lookupCache);
+		pLookupCache = &lookupCache;
+		if (opt_invariant)
+			pStore->enableImprintInvariant();
+
+		ctx.setupSpeed(pMetrics->numProgress);
+		ctx.tick = 0;
+		skipDuplicate = 0;
+
+		generator.initialiseGenerator(ctx.flags & context_t::MAGICMASK_PURE);
+		restartCost.sampleProfile(opt_costProfile, generator, restartData + ofs, pMetrics->numProgress, arg_numNodes, opt_sample, this, static_cast<generatorTree_t::generateTreeCallback_t>(&gensignatureContext_t::foundTreeSignature));
+
+		pLookupCache = NULL;
 	}
 
 };
@@ -926,18 +1107,26 @@ void usage(char *argv[], bool verbose) {
 	if (verbose) {
 		fprintf(stderr, "\n");
 		fprintf(stderr, "\t   --[no-]ainf                     Enable add-if-not-found [default=%s]\n", (ctx.flags & context_t::MAGICMASK_AINF) ? "enabled" : "disabled");
+		fprintf(stderr, "\t   --dynamic=<file>[,<number>]     Claim windows on demand from shared claim file [default=%s,%u]\n", app.opt_dynamic ? app.opt_dynamic : "", app.opt_dynamicWindows);
+		fprintf(stderr, "\t   --[no-]compress                 Save as block-compressed container [default=%s]\n", app.opt_compress ? "enabled" : "disabled");
+		fprintf(stderr, "\t   --costprofile=<file>            Write restart tab cost profile for `--restartcost` instead of output [default=%s]\n", app.opt_costProfile ? app.opt_costProfile : "");
 		fprintf(stderr, "\t   --force                         Force overwriting of database if already exists\n");
 		fprintf(stderr, "\t   --[no-]generate                 Invoke generator for new candidates [default=%s]\n", app.opt_generate ? "enabled" : "disabled");
+		fprintf(stderr, "\t   --[no-]grow                     Grow full sections instead of \"storage full\" [default=%s]\n", app.opt_grow ? "enabled" : "disabled");
 		fprintf(stderr, "\t-h --help                          This list\n");
 		fprintf(stderr, "\t   --imprintindexsize=<number>     Size of imprint index [default=%u]\n", app.opt_imprintIndexSize);
 		fprintf(stderr, "\t   --interleave=<number>           Imprint index interleave [default=%u]\n", app.opt_interleave);
+		fprintf(stderr, "\t   --[no-]invariant                Prune associative lookups by cofactor weights [default=%s]\n", app.opt_invariant ? "enabled" : "disabled");
 		fprintf(stderr, "\t   --load=<file>                   Read candidates from file instead of generating [default=%s]\n", app.opt_load ? app.opt_load : "");
+		fprintf(stderr, "\t   --lookupcache=<number>          Entries of candidate lookup cache, 0=disable [default=%u]\n", app.opt_lookupCache);
 		fprintf(stderr, "\t   --maximprint=<number>           Maximum number of imprints [default=%u]\n", app.opt_maxImprint);
 		fprintf(stderr, "\t   --maxsignature=<number>         Maximum number of signatures [default=%u]\n", app.opt_maxSignature);
 		fprintf(stderr, "\t   --[no-]pure                     QTF->QnTF rewriting [default=%s]\n", (ctx.flags & context_t::MAGICMASK_PURE) ? "enabled" : "disabled");
 		fprintf(stderr, "\t   --[no-]paranoid                 Enable expensive assertions [default=%s]\n", (ctx.flags & context_t::MAGICMASK_PARANOID) ? "enabled" : "disabled");
 		fprintf(stderr, "\t-q --quiet                         Say less\n");
 		fprintf(stderr, "\t   --ratio=<number>                Index/data ratio [default=%.1f]\n", app.opt_ratio);
+		fprintf(stderr, "\t   --restartcost=<file>            Restart tab cost profile from `--costprofile` [default=%s]\n", app.opt_restartCost ? app.opt_restartCost : "");
+		fprintf(stderr, "\t   --sample=<number>               Candidates timed per restart tab for `--costprofile` [default=%u]\n", app.opt_sample);
 		fprintf(stderr, "\t   --[no-]saveindex                Save with indices [default=%s]\n", app.opt_saveIndex ? "enabled" : "disabled");
 		fprintf(stderr, "\t   --saveinterleave=<number>       Save with interleave [default=%u]\n", app.opt_saveInterleave);
 		fprintf(stderr, "\t   --signatureindexsize=<number>   Size of signature index [default=%u]\n", app.opt_signatureIndexSize);
@@ -948,9 +1137,11 @@ void usage(char *argv[], bool verbose) {
 		fprintf(stderr, "\t   --text=2                        All signatures calling `foundTree()` with extra info for `compare()`\n");
 		fprintf(stderr, "\t   --text=3                        Brief signatures stored in database\n");
 		fprintf(stderr, "\t   --text=4                        Verbose signatures stored in database\n");
+		fprintf(stderr, "\t   --threads=<number>              Worker threads for pipelined lookups and sorting, 0=serial [default=%u]\n", app.opt_threads);
 		fprintf(stderr, "\t   --timer=<seconds>               Interval timer for verbose updates [default=%u]\n", ctx.opt_timer);
 		fprintf(stderr, "\t-v --truncate                      Truncate on database overflow\n");
 		fprintf(stderr, "\t-v --verbose                       Say more\n");
+		fprintf(stderr, "\t   --verify[=<threads>]            Verify input checksums before use, otherwise on first copy\n");
 		fprintf(stderr, "\t   --window=[<low>,]<high>         Upper end restart window [default=%lu,%lu]\n", app.opt_windowLo, app.opt_windowHi);
 	}
 }
@@ -978,15 +1169,24 @@ int main(int argc, char *argv[]) {
 			// long-only opts
 			LO_AINF    = 0,
 			LO_DEBUG,
+			LO_DYNAMIC,
+			LO_COMPRESS,
+			LO_COSTPROFILE,
 			LO_FORCE,
 			LO_GENERATE,
+			LO_GROW,
 			LO_IMPRINTINDEXSIZE,
 			LO_INTERLEAVE,
+			LO_INVARIANT,
 			LO_LOAD,
+			LO_LOOKUPCACHE,
 			LO_MAXIMPRINT,
 			LO_MAXSIGNATURE,
 			LO_NOAINF,
+			LO_NOCOMPRESS,
 			LO_NOGENERATE,
+			LO_NOGROW,
+			LO_NOINVARIANT,
 			LO_NOPARANOID,
 			LO_NOPURE,
 			LO_NOSAVEINDEX,
@@ -995,14 +1195,18 @@ int main(int argc, char *argv[]) {
 			LO_PARANOID,
 			LO_PURE,
 			LO_RATIO,
+			LO_RESTARTCOST,
+			LO_SAMPLE,
 			LO_SAVEINDEX,
 			LO_SIGNATUREINDEXSIZE,
 			LO_SORT,
 			LO_TASK,
 			LO_TEXT,
+			LO_THREADS,
 			LO_TIMER,
 			LO_TRUNCATE,
 			LO_WINDOW,
+			LO_VERIFY,
 			// short opts
 			LO_HELP    = 'h',
 			LO_QUIET   = 'q',
@@ -1014,16 +1218,25 @@ int main(int argc, char *argv[]) {
 			/* name, has_arg, flag, val */
 			{"ainf",               0, 0, LO_AINF},
 			{"debug",              1, 0, LO_DEBUG},
+			{"dynamic",            1, 0, LO_DYNAMIC},
+			{"compress",           0, 0, LO_COMPRESS},
+			{"costprofile",        1, 0, LO_COSTPROFILE},
 			{"force",              0, 0, LO_FORCE},
 			{"generate",           0, 0, LO_GENERATE},
+			{"grow",               0, 0, LO_GROW},
 			{"help",               0, 0, LO_HELP},
 			{"imprintindexsize",   1, 0, LO_IMPRINTINDEXSIZE},
 			{"interleave",         1, 0, LO_INTERLEAVE},
+			{"invariant",          0, 0, LO_INVARIANT},
 			{"load",               1, 0, LO_LOAD},
+			{"lookupcache",        1, 0, LO_LOOKUPCACHE},
 			{"maximprint",         1, 0, LO_MAXIMPRINT},
 			{"maxsignature",       1, 0, LO_MAXSIGNATURE},
 			{"no-ainf",            0, 0, LO_NOAINF},
+			{"no-compress",        0, 0, LO_NOCOMPRESS},
 			{"no-generate",        0, 0, LO_NOGENERATE},
+			{"no-grow",            0, 0, LO_NOGROW},
+			{"no-invariant",       0, 0, LO_NOINVARIANT},
 			{"no-paranoid",        0, 0, LO_NOPARANOID},
 			{"no-pure",            0, 0, LO_NOPURE},
 			{"no-saveindex",       0, 0, LO_NOSAVEINDEX},
@@ -1032,15 +1245,19 @@ int main(int argc, char *argv[]) {
 			{"pure",               0, 0, LO_PURE},
 			{"quiet",              2, 0, LO_QUIET},
 			{"ratio",              1, 0, LO_RATIO},
+			{"restartcost",        1, 0, LO_RESTARTCOST},
+			{"sample",             1, 0, LO_SAMPLE},
 			{"saveindex",          0, 0, LO_SAVEINDEX},
 			{"saveinterleave",     1, 0, LO_SAVEINTERLEAVE},
 			{"signatureindexsize", 1, 0, LO_SIGNATUREINDEXSIZE},
 			{"sort",               0, 0, LO_SORT},
 			{"task",               1, 0, LO_TASK},
 			{"text",               2, 0, LO_TEXT},
+			{"threads",            1, 0, LO_THREADS},
 			{"timer",              1, 0, LO_TIMER},
 			{"truncate",           0, 0, LO_TRUNCATE},
 			{"verbose",            2, 0, LO_VERBOSE},
+			{"verify",             2, 0, LO_VERIFY},
 			{"window",             1, 0, LO_WINDOW},
 			//
 			{NULL,                 0, 0, 0}
@@ -1073,15 +1290,41 @@ int main(int argc, char *argv[]) {
 		case LO_DEBUG:
 			ctx.opt_debug = ::strtoul(optarg, NULL, 0);
 			break;
+		case LO_DYNAMIC: {
+			static char claimFile[256];
+
+			// <claimfile>[,<numWindows>]
+			::strncpy(claimFile, optarg, sizeof(claimFile) - 1);
+			char *p = ::strchr(claimFile, ',');
+			if (p) {
+				*p++ = 0;
+				app.opt_dynamicWindows = ::strtoul(p, NULL, 0);
+			}
+			if (!claimFile[0] || app.opt_dynamicWindows == 0) {
+				usage(argv, true);
+				exit(1);
+			}
+			app.opt_dynamic = claimFile;
+			break;
+		}
 		case LO_AINF:
 			ctx.flags |= context_t::MAGICMASK_AINF;
 			break;
+		case LO_COMPRESS:
+			app.opt_compress++;
+			break;
+		case LO_COSTPROFILE:
+			app.opt_costProfile = optarg;
+			break;
 		case LO_FORCE:
 			app.opt_force++;
 			break;
 		case LO_GENERATE:
 			app.opt_generate++;
 			break;
+		case LO_GROW:
+			app.opt_grow++;
+			break;
 		case LO_HELP:
 			usage(argv, true);
 			exit(0);
@@ -1093,9 +1336,15 @@ int main(int argc, char *argv[]) {
 			if (!getMetricsInterleave(MAXSLOTS, app.opt_interleave))
 				ctx.fatal("--interleave must be one of [%s]\n", getAllowedInterleaves(MAXSLOTS));
 			break;
+		case LO_INVARIANT:
+			app.opt_invariant++;
+			break;
 		case LO_LOAD:
 			app.opt_load = optarg;
 			break;
+		case LO_LOOKUPCACHE:
+			app.opt_lookupCache = ::strtoul(optarg, NULL, 0);
+			break;
 		case LO_MAXIMPRINT:
 			app.opt_maxImprint = ctx.dToMax(::strtod(optarg, NULL));
 			break;
@@ -1105,9 +1354,18 @@ int main(int argc, char *argv[]) {
 		case LO_NOAINF:
 			ctx.flags &= ~context_t::MAGICMASK_AINF;
 			break;
+		case LO_NOCOMPRESS:
+			app.opt_compress = 0;
+			break;
 		case LO_NOGENERATE:
 			app.opt_generate = 0;
 			break;
+		case LO_NOGROW:
+			app.opt_grow = 0;
+			break;
+		case LO_NOINVARIANT:
+			app.opt_invariant = 0;
+			break;
 		case LO_NOPARANOID:
 			ctx.flags &= ~context_t::MAGICMASK_PARANOID;
 			break;
@@ -1137,6 +1395,16 @@ int main(int argc, char *argv[]) {
 		case LO_RATIO:
 			app.opt_ratio = strtof(optarg, NULL);
 			break;
+		case LO_RESTARTCOST:
+			app.opt_restartCost = optarg;
+			break;
+		case LO_SAMPLE:
+			app.opt_sample = ::strtoul(optarg, NULL, 0);
+			if (app.opt_sample == 0) {
+				fprintf(stderr, "--sample must be non-zero\n");
+				exit(1);
+			}
+			break;
 		case LO_SAVEINDEX:
 			app.opt_saveIndex = optarg ? ::strtoul(optarg, NULL, 0) : app.opt_saveIndex + 1;
 			break;
@@ -1190,6 +1458,9 @@ int main(int argc, char *argv[]) {
 		case LO_TEXT:
 			app.opt_text = optarg ? ::strtoul(optarg, NULL, 0) : app.opt_text + 1;
 			break;
+		case LO_THREADS:
+			app.opt_threads = ::strtoul(optarg, NULL, 0);
+			break;
 		case LO_TIMER:
 			ctx.opt_timer = ::strtoul(optarg, NULL, 0);
 			break;
@@ -1199,6 +1470,9 @@ int main(int argc, char *argv[]) {
 		case LO_VERBOSE:
 			ctx.opt_verbose = optarg ? ::strtoul(optarg, NULL, 0) : ctx.opt_verbose + 1;
 			break;
+		case LO_VERIFY:
+			app.opt_verify = optarg ? (unsigned) ::strtoul(optarg, NULL, 0) : (unsigned) sysconf(_SC_NPROCESSORS_ONLN);
+			break;
 		case LO_WINDOW: {
 			uint64_t m, n;
 
@@ -1256,28 +1530,48 @@ int main(int argc, char *argv[]) {
 	/*
 	 * `--task` post-processing
 	 */
-	if (app.opt_taskId || app.opt_taskLast) {
+	restartCost_t restartCost(ctx);
+	unsigned      numDynamic = 0; // windows claimed with `--dynamic`
+
+	if (app.opt_taskId || app.opt_taskLast || app.opt_dynamic) {
 		const metricsGenerator_t *pMetrics = getMetricsGenerator(MAXSLOTS, ctx.flags & context_t::MAGICMASK_PURE, app.arg_numNodes);
-		if (!pMetrics)
-			ctx.fatal("no preset for --task\n");
 
-		// split progress into chunks
-		uint64_t taskSize = pMetrics->numProgress / app.opt_taskLast;
-		if (taskSize == 0)
-			taskSize = 1;
-		app.opt_windowLo = taskSize * (app.opt_taskId - 1);
-		app.opt_windowHi = taskSize * app.opt_taskId;
+		if (app.opt_restartCost) {
+			// boundaries balanced on predicted cost
+			restartCost.load(app.opt_restartCost);
+			if (pMetrics && pMetrics->numProgress != restartCost.numProgress)
+				ctx.fatal("\n{\"error\":\"restartcost does not match metrics\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"encountered\":%lu,\"expected\":%lu}\n",
+					  __FUNCTION__, __FILE__, __LINE__, app.opt_restartCost, restartCost.numProgress, pMetrics->numProgress);
+		} else {
+			// split progress into equal chunks
+			if (!pMetrics)
+				ctx.fatal("no preset for --task\n");
+			restartCost.numProgress = pMetrics->numProgress;
+		}
 
 		// last task is open ended in case metrics are off
-		if (app.opt_taskId == app.opt_taskLast)
-			app.opt_windowHi = 0;
+		if (app.opt_taskId || app.opt_taskLast) {
+			restartCost.taskWindow(app.opt_taskId, app.opt_taskLast, &app.opt_windowLo, &app.opt_windowHi);
+
+			// costly tabs can absorb multiple boundaries
+			if (app.opt_windowHi && app.opt_windowLo >= app.opt_windowHi) {
+				if (ctx.opt_verbose >= ctx.VERBOSE_WARNING)
+					fprintf(stderr, "[%s] INFO: task=%u,%u empty window\n", ctx.timeAsString(), app.opt_taskId, app.opt_taskLast);
+				exit(0);
+			}
+		}
 	}
 	if (app.opt_windowHi && app.opt_windowLo >= app.opt_windowHi) {
 		fprintf(stderr, "--window low exceeds high\n");
 		exit(1);
 	}
 
-	if (app.opt_windowLo || app.opt_windowHi) {
+	if (app.opt_costProfile && (app.arg_outputDatabase || app.opt_taskLast || app.opt_dynamic || app.opt_windowLo || app.opt_windowHi)) {
+		fprintf(stderr, "--costprofile samples the whole run and has no output database\n");
+		exit(1);
+	}
+
+	if (app.opt_windowLo || app.opt_windowHi || app.opt_dynamic) {
 		if (app.arg_numNodes > tinyTree_t::TINYTREE_MAXNODES || restartIndex[app.arg_numNodes][(ctx.flags & context_t::MAGICMASK_PURE) ? 1 : 0] == 0) {
 			fprintf(stderr, "No restart data for --window\n");
 			exit(1);
@@ -1329,10 +1623,16 @@ int main(int argc, char *argv[]) {
 	database_t db(ctx);
 
 	// test readOnly mode
-	app.readOnlyMode = (app.arg_outputDatabase == NULL && app.opt_text != app.OPTTEXT_BRIEF && app.opt_text != app.OPTTEXT_VERBOSE);
+	app.readOnlyMode = (app.arg_outputDatabase == NULL && app.opt_text != app.OPTTEXT_BRIEF && app.opt_text != app.OPTTEXT_VERBOSE && app.opt_costProfile == NULL);
 
 	db.open(app.arg_inputDatabase);
 
+	// sections copied/scanned during startup, evaluators are fully used
+	db.adviseSections(database_t::ALLOCMASK_SIGNATURE | database_t::ALLOCMASK_IMPRINT, database_t::ACCESS_SEQUENTIAL);
+	db.adviseSections(database_t::ALLOCMASK_EVALUATOR, database_t::ACCESS_WILLNEED);
+
+	app.verifyDatabaseSections(db);
+
 	// display system flags when database was created
 	if (ctx.opt_verbose >= ctx.VERBOSE_WARNING) {
 		char dbText[128], ctxText[128];
@@ -1432,6 +1732,9 @@ int main(int argc, char *argv[]) {
 	if (app.rebuildSections)
 		store.rebuildIndices(app.rebuildSections);
 
+	// shared input sections must be verified before lookups
+	app.waitVerifySections();
+
 	/*
 	 * Where to look for new candidates
 	 */
@@ -1442,6 +1745,12 @@ int main(int argc, char *argv[]) {
 		assert(store.numImprint > 0);
 	}
 
+	if (app.opt_costProfile) {
+		// store is updated as in a normal run but not saved
+		app.costFromGenerator(restartCost);
+		return 0;
+	}
+
 	if (app.opt_load)
 		app.signaturesFromFile();
 	if (app.opt_generate) {
@@ -1451,7 +1760,22 @@ int main(int argc, char *argv[]) {
 			app.signaturesFromGenerator();
 			app.arg_numNodes = 1;
 		}
-		app.signaturesFromGenerator();
+		if (app.opt_dynamic) {
+			// claim windows until exhausted
+			unsigned windowId;
+			while (!app.truncated && restartCost.claimWindow(app.opt_dynamic, app.opt_dynamicWindows, &windowId, &app.opt_windowLo, &app.opt_windowHi)) {
+				if (ctx.opt_verbose >= ctx.VERBOSE_WARNING)
+					fprintf(stderr, "[%s] INFO: claimed window %u/%u\n", ctx.timeAsString(), windowId, app.opt_dynamicWindows);
+				app.signaturesFromGenerator();
+				numDynamic++;
+
+				// incomplete windows are re-issued to other workers
+				if (!app.truncated)
+					restartCost.completeWindow();
+			}
+		} else {
+			app.signaturesFromGenerator();
+		}
 	}
 
 	/*
@@ -1465,7 +1789,8 @@ int main(int argc, char *argv[]) {
 			fprintf(stderr, "[%s] Sorting signatures\n", ctx.timeAsString());
 
 		assert(store.numSignature >= 1);
-		qsort_r(store.signatures + 1, store.numSignature - 1, sizeof(*store.signatures), app.comparSignature, &app);
+		decoratedSort_t sorter(ctx, app.opt_threads);
+		sorter.sort(store.signatures + 1, store.numSignature - 1, sizeof(*store.signatures), app.keySignature, app.tieSignature, &ctx);
 
 		// clear name index
 		::memset(store.signatureIndex, 0, store.signatureIndexSize * sizeof(*store.signatureIndex));
@@ -1551,6 +1876,8 @@ int main(int argc, char *argv[]) {
 			json_object_set_new_nocheck(jResult, "taskId", json_integer(app.opt_taskId));
 			json_object_set_new_nocheck(jResult, "taskLast", json_integer(app.opt_taskLast));
 		}
+		if (app.opt_dynamic)
+			json_object_set_new_nocheck(jResult, "dynamicWindows", json_integer(numDynamic));
 		if (app.opt_windowLo || app.opt_windowHi) {
 			json_object_set_new_nocheck(jResult, "windowLo", json_integer(app.opt_windowLo));
 			json_object_set_new_nocheck(jResult, "windowHi", json_integer(app.opt_windowHi));
@@ -82,6 +82,7 @@
 #include <assert.h>
 #include <ctype.h>
 #include <getopt.h>
+#include <pthread.h>
 #include <signal.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -111,6 +112,8 @@ struct genswapContext_t : dbtool_t {
 		OPTTEXT_BRIEF   = 3,
 		OPTTEXT_VERBOSE = 4,
 
+		/// @constant {number} - signatures per threaded batch
+		SWAPBATCH       = 4096,
 	};
 
 	/*
@@ -139,18 +142,56 @@ struct genswapContext_t : dbtool_t {
 	unsigned   opt_taskLast;
 	/// @var {number} --text, textual output instead of binary database
 	unsigned   opt_text;
+	/// @var {number} --threads, worker threads for swap discovery, 0=serial
+	unsigned   opt_threads;
 
 	/// @var {database_t} - Database store to place results
 	database_t  *pStore;
 
-	/// @var {number} current version incarnation
-	uint32_t iVersion;
+	/**
+	 * @date 2026-10-17 21:20:44
+	 *
+	 * Scratch for swap discovery, one per worker thread
+	 */
+	struct swapScratch_t {
+		/// @var {number} current version incarnation
+		uint32_t    iVersion;
+		/// @var {number[]} - Versioned memory of active swaps/transforms
+		uint32_t    *swapsActive;
+		/// @var {number[]} - List of found swaps/transforms for signature under investigation. IBET set indicates they are disabled
+		uint32_t    *swapsFound;
+		/// @var {footprint_t[]} - private evaluator nodes, NULL to evaluate in-place in store
+		footprint_t *pEval;
+	};
+
+	/**
+	 * @date 2026-10-17 21:21:30
+	 *
+	 * Worker thread processing a share of a batch of signatures
+	 */
+	struct swapWorker_t {
+		/// @var {genswapContext_t} owner
+		genswapContext_t *pApp;
+		/// @var {pthread_t} thread handle
+		pthread_t        thread;
+		/// @var {swapScratch_t} private scratch
+		swapScratch_t    scratch;
+	};
+
 	/// @var {number} duplicate swaps in database
 	unsigned skipDuplicate;
-	/// @var {number[]} - Versioned memory of active swaps/transforms
-	uint32_t *swapsActive;
-	/// @var {number[]} - List of found swaps/transforms for signature under investigation. IBET set indicates they are disabled
-	uint32_t *swapsFound;
+	/// @var {swapScratch_t} - scratch for serial discovery
+	swapScratch_t scratch;
+	/// @var {number} - first sid of threaded batch
+	unsigned batchLo;
+	/// @var {number} - end sid of threaded batch
+	unsigned batchHi;
+	/// @var {number} - next sid to claim by workers
+	unsigned batchNext;
+	/// @var {swap_t[]} - swaps found for batch, indexed by `sid-batchLo`
+	swap_t   *pBatchSwap;
+	/// @var {number[]} - non-zero if batch entry has swaps
+	uint8_t  *pBatchFound;
 	/// @var {number[]} - Versioned memory of active swaps/transforms
 	uint64_t *swapsWeight;
 	/// @var {number[]} - Weights to assist choosing in case of draws
@@ -172,14 +213,21 @@ struct genswapContext_t : dbtool_t {
 		opt_taskId         = 0;
 		opt_taskLast       = 0;
 		opt_text           = 0;
+		opt_threads        = 0;
 
-		iVersion = 0;
 		pStore   = NULL;
 
-		skipDuplicate = 0;
-		swapsActive   = (uint32_t *) ctx.myAlloc("genswapContext_t::swapsActive", MAXTRANSFORM, sizeof(*swapsActive));
-		swapsFound    = (uint32_t *) ctx.myAlloc("genswapContext_t::swapsFound", MAXTRANSFORM, sizeof(*swapsFound));
-		swapsWeight   = (uint64_t *) ctx.myAlloc("genswapContext_t::swapsWeight", MAXTRANSFORM, sizeof(*swapsWeight));
+		skipDuplicate       = 0;
+		scratch.iVersion    = 0;
+		scratch.swapsActive = (uint32_t *) ctx.myAlloc("genswapContext_t::swapsActive", MAXTRANSFORM, sizeof(*scratch.swapsActive));
+		scratch.swapsFound  = (uint32_t *) ctx.myAlloc("genswapContext_t::swapsFound", MAXTRANSFORM, sizeof(*scratch.swapsFound));
+		scratch.pEval       = NULL;
+		batchLo             = 0;
+		batchHi             = 0;
+		batchNext           = 0;
+		pBatchSwap          = NULL;
+		pBatchFound         = NULL;
+		swapsWeight         = (uint64_t *) ctx.myAlloc("genswapContext_t::swapsWeight", MAXTRANSFORM, sizeof(*swapsWeight));
 		for (unsigned j = 0; j <= MAXSLOTS; j++)
 			tidHi[j] = 0;
 	}
@@ -190,8 +238,8 @@ struct genswapContext_t : dbtool_t {
 	 * Release system resources
 	 */
 	~genswapContext_t() {
-		ctx.myFree("database_t::swapsActive", swapsActive);
-		ctx.myFree("database_t::swapsFound", swapsFound);
+		ctx.myFree("database_t::swapsActive", scratch.swapsActive);
+		ctx.myFree("database_t::swapsFound", scratch.swapsFound);
 		ctx.myFree("database_t::swapsWeight", swapsWeight);
 	}
 
@@ -203,18 +251,20 @@ struct genswapContext_t : dbtool_t {
 	 * Apply transform to collection to find pairs.
 	 * Flag better half of pair to pass to next round.
 	 *
+	 * @param {swapScratch_t} pScratch - versioned memory of caller
 	 * @param {signature_t} pSignature - signature for `--text` mode
 	 * @param {number} tidFocus - which transform to use
 	 * @param {number} numFound - total number of transforms
 	 * @param {number[]} pFound - list of transforms
 	 * @return {number} - number of transforms still active
 	 */
-	unsigned countNextActive(const signature_t *pSignature, unsigned tidFocus, unsigned numFound, uint32_t *pFound) {
+	unsigned countNextActive(swapScratch_t *pScratch, const signature_t *pSignature, unsigned tidFocus, unsigned numFound, uint32_t *pFound) const {
 		// result
 		unsigned numActiveNext = 0;
 
 		// bump version number
-		this->iVersion++;
+		uint32_t iVersion = ++pScratch->iVersion;
+		uint32_t *swapsActive = pScratch->swapsActive;
 
 		// get name of selected transform
 		const char *pFocus = pStore->fwdTransformNames[tidFocus];
@@ -244,15 +294,15 @@ struct genswapContext_t : dbtool_t {
 
 			if (cmp < 0) {
 				// original is better
-				if (this->swapsActive[tidOrig] != iVersion) {
+				if (swapsActive[tidOrig] != iVersion) {
 					numActiveNext++;
-					this->swapsActive[tidOrig] = iVersion;
+					swapsActive[tidOrig] = iVersion;
 				}
 			} else if (cmp > 0) {
 				// swapped is better
-				if (this->swapsActive[tidSwapped] != iVersion) {
+				if (swapsActive[tidSwapped] != iVersion) {
 					numActiveNext++;
-					this->swapsActive[tidSwapped] = iVersion;
+					swapsActive[tidSwapped] = iVersion;
 				}
 			} else {
 				assert(0);
@@ -281,6 +331,37 @@ struct genswapContext_t : dbtool_t {
 		return numActiveNext;
 	}
 
+	/**
+	 * @date 2026-10-17 21:23:12
+	 *
+	 * Display progress ticker
+	 */
+	void showProgress(void) {
+		int perSecond = ctx.updateSpeed();
+
+		if (perSecond == 0 || ctx.progress > ctx.progressHi) {
+			fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) numSwap=%u(%.0f%%) | skipDuplicate=%u",
+				ctx.timeAsString(), ctx.progress, perSecond,
+				pStore->numSwap, pStore->numSwap * 100.0 / pStore->maxSwap,
+				skipDuplicate);
+		} else {
+			int eta = (int) ((ctx.progressHi - ctx.progress) / perSecond);
+
+			int etaH = eta / 3600;
+			eta %= 3600;
+			int etaM = eta / 60;
+			eta %= 60;
+			int etaS = eta;
+
+			fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) %.5f%% eta=%d:%02d:%02d numSwap=%u(%.0f%%) | skipDuplicate=%u",
+				ctx.timeAsString(), ctx.progress, perSecond, (ctx.progress - this->opt_sidLo) * 100.0 / (ctx.progressHi - this->opt_sidLo), etaH, etaM, etaS,
+				pStore->numSwap, pStore->numSwap * 100.0 / pStore->maxSwap,
+				skipDuplicate);
+		}
+
+		ctx.tick = 0;
+	}
+
 	/**
 	 * @date 2020-05-02 23:06:26
 	 *
@@ -291,50 +372,18 @@ struct genswapContext_t : dbtool_t {
 	 * Drop all the worse alternatives.
 	 * Repeat applying other transforms until the collection consists of a single transparent (normalised) name.
 	 *
-	 * @param {signature_t} pName - signature requiring swaps
-	 * @return {number} swapId
+	 * Only reads the store, safe to call concurrently with private scratch.
+	 *
+	 * @param {swapScratch_t} pScratch - versioned memory and evaluator of caller
+	 * @param {signature_t} pSignature - signature requiring swaps
+	 * @param {swap_t} pSwap - swap record to populate
+	 * @return {boolean} - true if signature has swaps
 	 */
-	unsigned foundSignatureSwap(const char *pName) {
-
-		if (ctx.opt_verbose >= ctx.VERBOSE_TICK && ctx.tick) {
-			int perSecond = ctx.updateSpeed();
-
-			if (perSecond == 0 || ctx.progress > ctx.progressHi) {
-				fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) numSwap=%u(%.0f%%) | skipDuplicate=%u",
-					ctx.timeAsString(), ctx.progress, perSecond,
-					pStore->numSwap, pStore->numSwap * 100.0 / pStore->maxSwap,
-					skipDuplicate);
-			} else {
-				int eta = (int) ((ctx.progressHi - ctx.progress) / perSecond);
-
-				int etaH = eta / 3600;
-				eta %= 3600;
-				int etaM = eta / 60;
-				eta %= 60;
-				int etaS = eta;
-
-				fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) %.5f%% eta=%d:%02d:%02d numSwap=%u(%.0f%%) | skipDuplicate=%u",
-					ctx.timeAsString(), ctx.progress, perSecond, (ctx.progress - this->opt_sidLo) * 100.0 / (ctx.progressHi - this->opt_sidLo), etaH, etaM, etaS,
-					pStore->numSwap, pStore->numSwap * 100.0 / pStore->maxSwap,
-					skipDuplicate);
-			}
-
-			ctx.tick = 0;
-		}
-
-		/*
-		 * lookup signature
-		 */
-
-		unsigned       ix  = pStore->lookupSignature(pName);
-		const unsigned sid = pStore->signatureIndex[ix];
-		if (sid == 0)
-			ctx.fatal("\n{\"error\":\"missing signature\",\"where\":\"%s:%s:%d\",\"name\":\"%s\",\"progress\":%lu}\n",
-				  __FUNCTION__, __FILE__, __LINE__, pName, ctx.progress);
+	bool computeSignatureSwap(swapScratch_t *pScratch, const signature_t *pSignature, swap_t *pSwap) const {
 
 		tinyTree_t tree(ctx);
-
-		signature_t *pSignature = pStore->signatures + sid;
+		uint32_t   *swapsActive = pScratch->swapsActive;
+		uint32_t   *swapsFound  = pScratch->swapsFound;
 
 		/*
 		 * Create a list of transforms representing all permutations
@@ -343,36 +392,46 @@ struct genswapContext_t : dbtool_t {
 		tree.loadStringFast(pSignature->name);
 
 		// put untransformed result in reverse transform
-		tree.eval(pStore->revEvaluator);
+		footprint_t *pRev = pStore->revEvaluator;
+		if (pScratch->pEval) {
+			// private copy of endpoints, nodes are overwritten by `eval()`
+			pRev = pScratch->pEval + tinyTree_t::TINYTREE_NEND;
+			::memcpy(pRev, pStore->revEvaluator, tinyTree_t::TINYTREE_NSTART * sizeof(*pRev));
+		}
+		tree.eval(pRev);
 
-		this->iVersion++;
+		uint32_t      iVersion = ++pScratch->iVersion;
 		unsigned      numSwaps = 0;
 		for (unsigned tid      = 0; tid < tidHi[pSignature->numPlaceholder]; tid++) {
 			// point to evaluator for given transformId
 			footprint_t *v = pStore->fwdEvaluator + tid * tinyTree_t::TINYTREE_NEND;
 
+			if (pScratch->pEval) {
+				::memcpy(pScratch->pEval, v, tinyTree_t::TINYTREE_NSTART * sizeof(*v));
+				v = pScratch->pEval;
+			}
+
 			// evaluate
 			tree.eval(v);
 
 			// test if result is unchanged
-			if (pStore->revEvaluator[tree.root].equals(v[tree.root])) {
+			if (pRev[tree.root].equals(v[tree.root])) {
 				// remember tid
 				assert(numSwaps < MAXTRANSFORM);
-				this->swapsFound[numSwaps++] = tid;
+				swapsFound[numSwaps++] = tid;
 				// mark it as in use
-				this->swapsActive[tid]       = iVersion;
+				swapsActive[tid]       = iVersion;
 			}
 		}
 
 		// test if swaps are present
 		if (numSwaps <= 1)
-			return 0;
+			return false;
 
 		/*
 		 * Record to populate
 		 */
-		swap_t swap;
-		::memset(&swap, 0, sizeof(swap));
+		::memset(pSwap, 0, sizeof(*pSwap));
 		unsigned numEntry = 0;
 
 		/*
@@ -384,7 +443,7 @@ struct genswapContext_t : dbtool_t {
 		 */
 
 		for (unsigned iSelect = 0; iSelect < numSwaps; iSelect++) {
-			unsigned tidSelect = this->swapsFound[iSelect];
+			unsigned tidSelect = swapsFound[iSelect];
 
 			// selected may not be transparent (tid=0) because it has no effect
 			if (tidSelect == 0)
@@ -397,12 +456,12 @@ struct genswapContext_t : dbtool_t {
 			 * apply selected transform to collection and locate pair
 			 */
 			for (unsigned j = 0; j < numSwaps; j++) {
-				unsigned   tidOrig    = this->swapsFound[j] & ~IBIT;
+				unsigned   tidOrig    = swapsFound[j] & ~IBIT;
 				const char *pOrig     = pStore->fwdTransformNames[tidOrig];
 				unsigned   tidSwapped = pStore->lookupTransformSlot(pOrig, pSelect, pStore->fwdTransformNameIndex);
 
 				// test if other half pair present
-				if (this->swapsActive[tidSwapped] != iVersion)
+				if (swapsActive[tidSwapped] != iVersion)
 					okay = false;
 			}
 
@@ -427,12 +486,12 @@ struct genswapContext_t : dbtool_t {
 			unsigned      bestTid   = 0;
 			unsigned      bestCount = 0;
 			for (unsigned iFocus    = 0; iFocus < numSwaps; iFocus++) {
-				unsigned tidFocus = this->swapsFound[iFocus] & ~IBIT;
+				unsigned tidFocus = swapsFound[iFocus] & ~IBIT;
 				if (tidFocus == 0)
 					continue; // skip transparent or disabled transform
 
 				// calculate number active left after applying selected transform
-				unsigned activeLeft = this->countNextActive(pSignature, tidFocus, numSwaps, this->swapsFound);
+				unsigned activeLeft = this->countNextActive(pScratch, pSignature, tidFocus, numSwaps, swapsFound);
 
 				// remember which is best
 				if (bestTid == 0 || activeLeft < bestCount || (activeLeft == bestCount && swapsWeight[tidFocus] < swapsWeight[bestTid])) {
@@ -443,18 +502,18 @@ struct genswapContext_t : dbtool_t {
 			assert(bestCount);
 
 			// apply best transform
-			this->countNextActive(pSignature, bestTid, numSwaps, this->swapsFound);
+			this->countNextActive(pScratch, pSignature, bestTid, numSwaps, swapsFound);
 
 			// apply result
 			for (unsigned iFocus = 0; iFocus < numSwaps; iFocus++) {
-				unsigned tidFocus = this->swapsFound[iFocus];
+				unsigned tidFocus = swapsFound[iFocus];
 
-				if (this->swapsActive[tidFocus & ~IBIT] == this->iVersion) {
+				if (swapsActive[tidFocus & ~IBIT] == pScratch->iVersion) {
 					// focus remains active
-					this->swapsFound[iFocus] &= ~IBIT;
+					swapsFound[iFocus] &= ~IBIT;
 				} else {
 					// focus becomes inactive
-					this->swapsFound[iFocus] |= IBIT;
+					swapsFound[iFocus] |= IBIT;
 				}
 			}
 
@@ -462,22 +521,35 @@ struct genswapContext_t : dbtool_t {
 			assert(numEntry < swap_t::MAXENTRY);
 			bool found = false;
 
-			for (unsigned j = 0; j < numEntry && swap.tids[j]; j++) {
-				if (swap.tids[j] == bestTid)
+			for (unsigned j = 0; j < numEntry && pSwap->tids[j]; j++) {
+				if (pSwap->tids[j] == bestTid)
 					found = true;
 			}
 			if (!found)
-				swap.tids[numEntry++] = bestTid;
+				pSwap->tids[numEntry++] = bestTid;
 
 			if (bestCount == 1)
 				break;
 		}
 
+		return true;
+	}
+
+	/**
+	 * @date 2026-10-17 21:25:48
+	 *
+	 * Output and add swap to database
+	 *
+	 * @param {signature_t} pSignature - signature
+	 * @param {swap_t} pSwap - swap
+	 * @return {number} swapId
+	 */
+	unsigned commitSignatureSwap(const signature_t *pSignature, swap_t *pSwap) {
 		if (opt_text == OPTTEXT_WON) {
 			printf("%s\t", pSignature->name);
 
-			for (unsigned j = 0; j < swap_t::MAXENTRY && swap.tids[j]; j++)
-				printf("\t%u", swap.tids[j]);
+			for (unsigned j = 0; j < swap_t::MAXENTRY && pSwap->tids[j]; j++)
+				printf("\t%u", pSwap->tids[j]);
 
 			printf("\n");
 		}
@@ -485,10 +557,10 @@ struct genswapContext_t : dbtool_t {
 		// add to database
 		if (!this->readOnlyMode) {
 			// lookup/add swapId
-			unsigned ix     = pStore->lookupSwap(&swap);
+			unsigned ix     = pStore->lookupSwap(pSwap);
 			unsigned swapId = pStore->swapIndex[ix];
 			if (swapId == 0)
-				pStore->swapIndex[ix] = swapId = pStore->addSwap(&swap);
+				pStore->swapIndex[ix] = swapId = pStore->addSwap(pSwap);
 			else
 				skipDuplicate++;
 
@@ -499,6 +571,38 @@ struct genswapContext_t : dbtool_t {
 		return 0;
 	}
 
+	/**
+	 * @date 2026-10-17 21:26:30
+	 *
+	 * Determine and add swaps for a signature
+	 *
+	 * @param {signature_t} pName - signature requiring swaps
+	 * @return {number} swapId
+	 */
+	unsigned foundSignatureSwap(const char *pName) {
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_TICK && ctx.tick)
+			showProgress();
+
+		/*
+		 * lookup signature
+		 */
+
+		unsigned       ix  = pStore->lookupSignature(pName);
+		const unsigned sid = pStore->signatureIndex[ix];
+		if (sid == 0)
+			ctx.fatal("\n{\"error\":\"missing signature\",\"where\":\"%s:%s:%d\",\"name\":\"%s\",\"progress\":%lu}\n",
+				  __FUNCTION__, __FILE__, __LINE__, pName, ctx.progress);
+
+		signature_t *pSignature = pStore->signatures + sid;
+		swap_t      swap;
+
+		if (!computeSignatureSwap(&scratch, pSignature, &swap))
+			return 0;
+
+		return commitSignatureSwap(pSignature, &swap);
+	}
+
 	/**
 	 * @date 2020-05-02 23:07:05
 	 *
@@ -651,6 +755,107 @@ struct genswapContext_t : dbtool_t {
 				skipDuplicate);
 	}
 
+	/**
+	 * @date 2026-10-17 21:28:05
+	 *
+	 * Claim signatures of current batch and compute swaps, store is only read
+	 *
+	 * @param {swapWorker_t} pWorker - worker with private scratch
+	 */
+	void swapBatchWorker(swapWorker_t *pWorker) {
+		for (;;) {
+			unsigned iSid = __atomic_fetch_add(&batchNext, 1, __ATOMIC_RELAXED);
+			if (iSid >= batchHi)
+				break;
+
+			const signature_t *pSignature = pStore->signatures + iSid;
+			unsigned          ix          = iSid - batchLo;
+
+			pBatchFound[ix] = !pSignature->swapId && computeSignatureSwap(&pWorker->scratch, pSignature, pBatchSwap + ix);
+		}
+	}
+
+	/**
+	 * pthread entry point
+	 */
+	static void *swapBatchEntry(void *arg) {
+		swapWorker_t *pWorker = (swapWorker_t *) arg;
+		pWorker->pApp->swapBatchWorker(pWorker);
+		return NULL;
+	}
+
+	/**
+	 * @date 2026-10-17 21:30:17
+	 *
+	 * Threaded variant of `swapsFromSignatures()`.
+	 * Workers compute swaps of disjoint sids against the read-only store.
+	 * Results are committed in sid order after each batch, output is identical to a serial run.
+	 *
+	 * @param {number} sidLo - first sid
+	 * @param {number} sidHi - end sid
+	 */
+	void swapsFromSignaturesThreaded(unsigned sidLo, unsigned sidHi) {
+		swapWorker_t *pWorkers = (swapWorker_t *) ctx.myAlloc("genswapContext_t::pWorkers", opt_threads, sizeof(*pWorkers));
+
+		for (unsigned iWorker = 0; iWorker < opt_threads; iWorker++) {
+			swapWorker_t *pWorker = pWorkers + iWorker;
+
+			pWorker->pApp                = this;
+			pWorker->scratch.iVersion    = 0;
+			pWorker->scratch.swapsActive = (uint32_t *) ctx.myAlloc("genswapContext_t::swapsActive", MAXTRANSFORM, sizeof(uint32_t));
+			pWorker->scratch.swapsFound  = (uint32_t *) ctx.myAlloc("genswapContext_t::swapsFound", MAXTRANSFORM, sizeof(uint32_t));
+			// forward and reverse evaluator
+			pWorker->scratch.pEval       = (footprint_t *) ctx.myAlloc("genswapContext_t::pEval", 2 * tinyTree_t::TINYTREE_NEND, sizeof(footprint_t));
+		}
+
+		pBatchSwap  = (swap_t *) ctx.myAlloc("genswapContext_t::pBatchSwap", SWAPBATCH, sizeof(*pBatchSwap));
+		pBatchFound = (uint8_t *) ctx.myAlloc("genswapContext_t::pBatchFound", SWAPBATCH, sizeof(*pBatchFound));
+
+		ctx.progress = sidLo;
+
+		for (batchLo = sidLo; batchLo < sidHi; batchLo = batchHi) {
+			batchHi   = batchLo + SWAPBATCH < sidHi ? batchLo + SWAPBATCH : sidHi;
+			batchNext = batchLo;
+
+			if (opt_threads == 1) {
+				swapBatchWorker(pWorkers);
+			} else {
+				for (unsigned iWorker = 0; iWorker < opt_threads; iWorker++) {
+					int ret = pthread_create(&pWorkers[iWorker].thread, NULL, swapBatchEntry, pWorkers + iWorker);
+					if (ret)
+						ctx.fatal("\n{\"error\":\"pthread_create() failed\",\"where\":\"%s:%s:%d\",\"return\":%d}\n",
+							  __FUNCTION__, __FILE__, __LINE__, ret);
+				}
+				for (unsigned iWorker = 0; iWorker < opt_threads; iWorker++)
+					pthread_join(pWorkers[iWorker].thread, NULL);
+			}
+
+			// deterministic merge
+			for (unsigned iSid = batchLo; iSid < batchHi; iSid++) {
+				if (pBatchFound[iSid - batchLo]) {
+					signature_t *pSignature = pStore->signatures + iSid;
+					pSignature->swapId = commitSignatureSwap(pSignature, pBatchSwap + iSid - batchLo);
+				}
+			}
+
+			ctx.progress = batchHi;
+			if (ctx.opt_verbose >= ctx.VERBOSE_TICK && ctx.tick)
+				showProgress();
+		}
+
+		ctx.myFree("genswapContext_t::pBatchFound", pBatchFound);
+		ctx.myFree("genswapContext_t::pBatchSwap", pBatchSwap);
+
+		for (unsigned iWorker = 0; iWorker < opt_threads; iWorker++) {
+			swapWorker_t *pWorker = pWorkers + iWorker;
+
+			ctx.myFree("genswapContext_t::pEval", pWorker->scratch.pEval);
+			ctx.myFree("genswapContext_t::swapsFound", pWorker->scratch.swapsFound);
+			ctx.myFree("genswapContext_t::swapsActive", pWorker->scratch.swapsActive);
+		}
+		ctx.myFree("genswapContext_t::pWorkers", pWorkers);
+	}
+
 	/**
 	 * @date 2020-05-02 23:09:29
 	 *
@@ -683,22 +888,29 @@ struct genswapContext_t : dbtool_t {
 		ctx.setupSpeed(this->opt_sidHi ? this->opt_sidHi : pStore->numSignature);
 		ctx.tick = 0;
 
-		// create imprints for signature groups
-		ctx.progress++; // skip reserved entry;
-		for (unsigned iSid = 1; iSid < pStore->numSignature; iSid++) {
+		if (opt_threads && opt_text != OPTTEXT_COMPARE) {
+			unsigned sidLo = opt_sidLo > 1 ? opt_sidLo : 1;
+			unsigned sidHi = opt_sidHi && opt_sidHi < pStore->numSignature ? opt_sidHi : pStore->numSignature;
 
-			if ((opt_sidLo && iSid < opt_sidLo) || (opt_sidHi && iSid >= opt_sidHi)) {
-				ctx.progress++;
-				continue;
-			}
+			swapsFromSignaturesThreaded(sidLo, sidHi);
+		} else {
+			// create imprints for signature groups
+			ctx.progress++; // skip reserved entry;
+			for (unsigned iSid = 1; iSid < pStore->numSignature; iSid++) {
 
-			signature_t *pSignature = pStore->signatures + iSid;
-			if (!pSignature->swapId) {
-				uint32_t swapId = foundSignatureSwap(pStore->signatures[iSid].name);
-				pSignature->swapId = swapId;
-			}
+				if ((opt_sidLo && iSid < opt_sidLo) || (opt_sidHi && iSid >= opt_sidHi)) {
+					ctx.progress++;
+					continue;
+				}
 
-			ctx.progress++;
+				signature_t *pSignature = pStore->signatures + iSid;
+				if (!pSignature->swapId) {
+					uint32_t swapId = foundSignatureSwap(pStore->signatures[iSid].name);
+					pSignature->swapId = swapId;
+				}
+
+				ctx.progress++;
+			}
 		}
 
 		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
@@ -775,8 +987,10 @@ void usage(char *argv[], bool verbose) {
 
 	if (verbose) {
 		fprintf(stderr, "\n");
+		fprintf(stderr, "\t   --[no-]compress            Save as block-compressed container [default=%s]\n", app.opt_compress ? "enabled" : "disabled");
 		fprintf(stderr, "\t   --force                    Force overwriting of database if already exists\n");
 		fprintf(stderr, "\t   --[no-]generate            Invoke generator for new candidates [default=%s]\n", app.opt_generate ? "enabled" : "disabled");
+		fprintf(stderr, "\t   --[no-]grow                Grow full sections instead of \"storage full\" [default=%s]\n", app.opt_grow ? "enabled" : "disabled");
 		fprintf(stderr, "\t-h --help                     This list\n");
 		fprintf(stderr, "\t   --maxswap=<number>         Maximum number of swaps [default=%u]\n", app.opt_maxSwap);
 		fprintf(stderr, "\t   --[no-]paranoid            Enable expensive assertions [default=%s]\n", (ctx.flags & context_t::MAGICMASK_PARANOID) ? "enabled" : "disabled");
@@ -788,8 +1002,10 @@ void usage(char *argv[], bool verbose) {
 		fprintf(stderr, "\t   --task=sge                 Get sid task settings from SGE environment\n");
 		fprintf(stderr, "\t   --task=<id>,<last>         Task id/number of tasks. [default=%u,%u]\n", app.opt_taskId, app.opt_taskLast);
 		fprintf(stderr, "\t   --text                     Textual output instead of binary database\n");
+		fprintf(stderr, "\t   --threads=<number>         Worker threads for swap discovery, 0=serial, serial for --text=2 [default=%u]\n", app.opt_threads);
 		fprintf(stderr, "\t   --timer=<seconds>          Interval timer for verbose updates [default=%u]\n", ctx.opt_timer);
 		fprintf(stderr, "\t-v --verbose                  Say more\n");
+		fprintf(stderr, "\t   --verify[=<threads>]       Verify input checksums before use, otherwise on first copy\n");
 	}
 }
 
@@ -815,11 +1031,15 @@ int main(int argc, char *argv[]) {
 		enum {
 			// long-only opts
 			LO_DEBUG   = 1,
+			LO_COMPRESS,
 			LO_FORCE,
 			LO_GENERATE,
+			LO_GROW,
 			LO_LOAD,
 			LO_MAXSWAP,
+			LO_NOCOMPRESS,
 			LO_NOGENERATE,
+			LO_NOGROW,
 			LO_NOPARANOID,
 			LO_NOPURE,
 			LO_NOSAVEINDEX,
@@ -831,7 +1051,9 @@ int main(int argc, char *argv[]) {
 			LO_SWAPINDEXSIZE,
 			LO_TASK,
 			LO_TEXT,
+			LO_THREADS,
 			LO_TIMER,
+			LO_VERIFY,
 			// short opts
 			LO_HELP    = 'h',
 			LO_QUIET   = 'q',
@@ -842,14 +1064,18 @@ int main(int argc, char *argv[]) {
 		static struct option long_options[] = {
 			/* name, has_arg, flag, val */
 			{"debug",         1, 0, LO_DEBUG},
+			{"compress",      0, 0, LO_COMPRESS},
 			{"force",         0, 0, LO_FORCE},
 			{"generate",      0, 0, LO_GENERATE},
+			{"grow",          0, 0, LO_GROW},
 			{"help",          0, 0, LO_HELP},
 			{"load",          1, 0, LO_LOAD},
 			{"maxswap",       1, 0, LO_MAXSWAP},
 			{"paranoid",      0, 0, LO_PARANOID},
 			{"pure",          0, 0, LO_PURE},
+			{"no-compress",   0, 0, LO_NOCOMPRESS},
 			{"no-generate",   0, 0, LO_NOGENERATE},
+			{"no-grow",       0, 0, LO_NOGROW},
 			{"no-paranoid",   0, 0, LO_NOPARANOID},
 			{"no-pure",       0, 0, LO_NOPURE},
 			{"no-saveindex",  0, 0, LO_NOSAVEINDEX},
@@ -860,8 +1086,10 @@ int main(int argc, char *argv[]) {
 			{"swapindexsize", 1, 0, LO_SWAPINDEXSIZE},
 			{"task",          1, 0, LO_TASK},
 			{"text",          2, 0, LO_TEXT},
+			{"threads",       1, 0, LO_THREADS},
 			{"timer",         1, 0, LO_TIMER},
 			{"verbose",       2, 0, LO_VERBOSE},
+			{"verify",        2, 0, LO_VERIFY},
 			//
 			{NULL,            0, 0, 0}
 		};
@@ -893,12 +1121,18 @@ int main(int argc, char *argv[]) {
 		case LO_DEBUG:
 			ctx.opt_debug = ::strtoul(optarg, NULL, 0);
 			break;
+		case LO_COMPRESS:
+			app.opt_compress++;
+			break;
 		case LO_FORCE:
 			app.opt_force++;
 			break;
 		case LO_GENERATE:
 			app.opt_generate++;
 			break;
+		case LO_GROW:
+			app.opt_grow++;
+			break;
 		case LO_HELP:
 			usage(argv, true);
 			exit(0);
@@ -908,9 +1142,15 @@ int main(int argc, char *argv[]) {
 		case LO_MAXSWAP:
 			app.opt_maxSwap = ctx.nextPrime(::strtod(optarg, NULL));
 			break;
+		case LO_NOCOMPRESS:
+			app.opt_compress = 0;
+			break;
 		case LO_NOGENERATE:
 			app.opt_generate = 0;
 			break;
+		case LO_NOGROW:
+			app.opt_grow = 0;
+			break;
 		case LO_NOPARANOID:
 			ctx.flags &= ~context_t::MAGICMASK_PARANOID;
 			break;
@@ -1002,12 +1242,18 @@ int main(int argc, char *argv[]) {
 		case LO_TEXT:
 			app.opt_text = optarg ? ::strtoul(optarg, NULL, 0) : app.opt_text + 1;
 			break;
+		case LO_THREADS:
+			app.opt_threads = ::strtoul(optarg, NULL, 0);
+			break;
 		case LO_TIMER:
 			ctx.opt_timer = ::strtoul(optarg, NULL, 0);
 			break;
 		case LO_VERBOSE:
 			ctx.opt_verbose = optarg ? ::strtoul(optarg, NULL, 0) : ctx.opt_verbose + 1;
 			break;
+		case LO_VERIFY:
+			app.opt_verify = optarg ? (unsigned) ::strtoul(optarg, NULL, 0) : (unsigned) sysconf(_SC_NPROCESSORS_ONLN);
+			break;
 
 		case '?':
 			fprintf(stderr, "Try `%s --help' for more information.\n", argv[0]);
@@ -1077,6 +1323,12 @@ int main(int argc, char *argv[]) {
 
 	db.open(app.arg_inputDatabase);
 
+	// sections copied/scanned during startup, evaluators are fully used
+	db.adviseSections(database_t::ALLOCMASK_SIGNATURE | database_t::ALLOCMASK_SWAP, database_t::ACCESS_SEQUENTIAL);
+	db.adviseSections(database_t::ALLOCMASK_EVALUATOR, database_t::ACCESS_WILLNEED);
+
+	app.verifyDatabaseSections(db);
+
 	// display system flags when database was created
 	if (ctx.opt_verbose >= ctx.VERBOSE_WARNING) {
 		char dbText[128], ctxText[128];
@@ -1174,6 +1426,9 @@ int main(int argc, char *argv[]) {
 	if (app.rebuildSections)
 		store.rebuildIndices(app.rebuildSections);
 
+	// shared input sections must be verified before lookups
+	app.waitVerifySections();
+
 	/*
 	 * get upper limit for tid's for given number of placeholders
 	 */
@@ -0,0 +1,912 @@
+//#pragma GCC optimize ("O3") // optimize on demand
+
+/*
+ * kcompare.cc
+ *      Decide root-by-root equivalence of two trees with matching key/root names
+ *
+ * Every root passes through increasingly expensive stages until decided:
+ *
+ *   structural: bottom-up hash of both trees, keys hashed by name       -> identical
+ *   simulation: bit-sliced random patterns, biased densities           -> DIFFER
+ *   exhaustive: 64 patterns per slice over the keys of the root cone   -> equivalent/DIFFER
+ *
+ * Roots surviving simulation with too many cone keys are reported as `probable`.
+ * Simulation rounds and exhaustive roots are distributed over worker threads.
+ * Results do not depend on the number of threads.
+ */
+
+/*
+ *	This file is part of Untangle, Information in fractal structures.
+ *	Copyright (C) 2017-2026, xyzzy@rockingship.org
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <map>
+#include <string>
+#include <ctype.h>
+#include <errno.h>
+#include <getopt.h>
+#include <jansson.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "context.h"
+#include "basetree.h"
+
+/*
+ * Resource context.
+ * Needs to be global to be accessible by signal handlers.
+ *
+ * @global {context_t} Application context
+ */
+context_t ctx;
+
+/**
+ * @date 2021-05-17 22:45:37
+ *
+ * Signal handlers
+ *
+ * Bump interval timer
+ *
+ * @param {number} sig - signal (ignored)
+ */
+void sigalrmHandler(int __attribute__ ((unused)) sig) {
+	if (ctx.opt_timer) {
+		ctx.tick++;
+		alarm(ctx.opt_timer);
+	}
+}
+
+/**
+ * @date 2026-10-17 20:52:36
+ *
+ * Main program logic as application context
+ * It is contained as an independent `struct` so it can be easily included into projects/code
+ */
+struct kcompareContext_t {
+
+	/// @constant {number} verdicts
+	enum {
+		VERDICT_UNDECIDED = 0,  // still to be decided
+		VERDICT_IDENTICAL,      // structurally identical
+		VERDICT_EQUIVALENT,     // exhaustively proven
+		VERDICT_PROBABLE,       // survived simulation, cone too large to prove
+		VERDICT_DIFFER,         // counter example found
+	};
+
+	/**
+	 * Root being compared
+	 */
+	struct root_t {
+		/// @var {number} root in left tree
+		uint32_t L;
+		/// @var {number} root in right tree
+		uint32_t R;
+		/// @var {number} verdict
+		unsigned verdict;
+		/// @var {number} number of keys in combined cone, 0 if not yet counted
+		unsigned numKeys;
+	};
+
+	/**
+	 * Worker thread context
+	 */
+	struct worker_t {
+		/// @var {kcompareContext_t} owner
+		kcompareContext_t *pApp;
+		/// @var {pthread_t} thread handle
+		pthread_t         thread;
+		/// @var {number} worker number
+		unsigned          iWorker;
+		/// @var {uint64_t[]} values of left tree
+		uint64_t          *pValueL;
+		/// @var {uint64_t[]} values of right tree
+		uint64_t          *pValueR;
+		/// @var {uint32_t[]} version map left tree
+		uint32_t          *pVersionL;
+		/// @var {uint32_t[]} version map right tree
+		uint32_t          *pVersionR;
+		/// @var {number} current version
+		uint32_t          iVersion;
+		/// @var {uint32_t[]} cone of left tree, followed by stack
+		uint32_t          *pConeL;
+		/// @var {uint32_t[]} cone of right tree, followed by stack
+		uint32_t          *pConeR;
+		/// @var {uint32_t[]} keys of combined cone (left key id)
+		uint32_t          *pKeys;
+	};
+
+	/// @var {number} --exhaustive, Maximum number of cone keys for exhaustive confirmation
+	unsigned opt_exhaustive;
+	/// @var {number} --rounds, 64-bit simulation rounds
+	unsigned opt_rounds;
+	/// @global {number} --seed=n, Random seed to generate test patterns
+	unsigned opt_seed;
+	/// @var {number} --threads, worker threads
+	unsigned opt_threads;
+
+	/// @var {baseTree_t} left tree
+	baseTree_t *pTreeL;
+	/// @var {baseTree_t} right tree
+	baseTree_t *pTreeR;
+	/// @var {uint32_t[]} right key id for left key id
+	uint32_t   *pKeyMap;
+	/// @var {root_t[]} roots to compare
+	root_t     *pRoots;
+	/// @var {number} number of roots
+	unsigned   numRoots;
+	/// @var {number} next simulation round or root for workers
+	unsigned   nextJob;
+
+	kcompareContext_t() {
+		opt_exhaustive = 20;
+		opt_rounds     = 64;
+		opt_seed       = 0x20261017;
+		opt_threads    = 0;
+
+		pTreeL   = NULL;
+		pTreeR   = NULL;
+		pKeyMap  = NULL;
+		pRoots   = NULL;
+		numRoots = 0;
+		nextJob  = 0;
+	}
+
+	/**
+	 * @date 2026-10-17 20:54:11
+	 *
+	 * Deterministic 64-bit pattern for a key in a round, independent of threads
+	 *
+	 * @param {number} iRound - simulation round
+	 * @param {number} iKey - key id
+	 * @return {number} - pattern
+	 */
+	uint64_t pattern(unsigned iRound, uint32_t iKey) const {
+		uint64_t z = ((uint64_t) opt_seed << 32) ^ ((uint64_t) iRound << 20) ^ iKey;
+
+		// splitmix64, twice for biased densities
+		uint64_t w[2];
+		for (unsigned i = 0; i < 2; i++) {
+			z += 0x9e3779b97f4a7c15ULL;
+			uint64_t v = z;
+			v = (v ^ (v >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			v = (v ^ (v >> 27)) * 0x94d049bb133111ebULL;
+			w[i] = v ^ (v >> 31);
+		}
+
+		// densities 1/2, 1/4, 3/4. Wide AND/OR's are near-constant under unbiased patterns
+		if (iRound % 3 == 0)
+			return w[0];
+		else if (iRound % 3 == 1)
+			return w[0] & w[1];
+		else
+			return w[0] | w[1];
+	}
+
+	/**
+	 * @date 2026-10-17 20:55:40
+	 *
+	 * Evaluate a 64-bit slice of all nodes of a tree
+	 *
+	 * @param {baseTree_t} pTree - tree
+	 * @param {uint64_t[]} pValue - values indexed by node id, endpoints already set
+	 */
+	static void evaluateTree(const baseTree_t *pTree, uint64_t *pValue) {
+		for (uint32_t iNode = pTree->nstart; iNode < pTree->ncount; iNode++) {
+			const baseNode_t *pNode = pTree->N + iNode;
+			const uint64_t   Q      = pValue[pNode->Q];
+			const uint64_t   T      = pValue[pNode->T & ~IBIT];
+			const uint64_t   F      = pValue[pNode->F];
+
+			if (pNode->T & IBIT)
+				pValue[iNode] = (Q & ~T) | (~Q & F);
+			else
+				pValue[iNode] = (Q & T) | (~Q & F);
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 20:56:02
+	 *
+	 * Evaluate a 64-bit slice for a list of (ascending) nodes
+	 *
+	 * @param {baseTree_t} pTree - tree
+	 * @param {uint64_t[]} pValue - values indexed by node id, endpoints already set
+	 * @param {uint32_t[]} pCone - nodes to evaluate
+	 * @param {number} numCone - number of nodes
+	 */
+	static void evaluateCone(const baseTree_t *pTree, uint64_t *pValue, const uint32_t *pCone, unsigned numCone) {
+		for (unsigned i = 0; i < numCone; i++) {
+			const baseNode_t *pNode = pTree->N + pCone[i];
+			const uint64_t   Q      = pValue[pNode->Q];
+			const uint64_t   T      = pValue[pNode->T & ~IBIT];
+			const uint64_t   F      = pValue[pNode->F];
+
+			if (pNode->T & IBIT)
+				pValue[pCone[i]] = (Q & ~T) | (~Q & F);
+			else
+				pValue[pCone[i]] = (Q & T) | (~Q & F);
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 20:57:25
+	 *
+	 * Value of a root, applying inversion
+	 */
+	static inline uint64_t rootValue(const uint64_t *pValue, uint32_t R) {
+		return pValue[R & ~IBIT] ^ ((R & IBIT) ? ~0ULL : 0);
+	}
+
+	/**
+	 * @date 2026-10-17 20:58:47
+	 *
+	 * Structural hash of every node, keys hashed by name so trees with different key order hash alike
+	 *
+	 * @param {baseTree_t} pTree - tree
+	 * @return {uint64_t[]} - hash per node, caller frees
+	 */
+	uint64_t *structuralHash(baseTree_t *pTree) {
+		uint64_t *pHash = (uint64_t *) ctx.myAlloc("kcompareContext_t::pHash", pTree->ncount, sizeof(*pHash));
+
+		for (uint32_t iKey = 0; iKey < pTree->nstart; iKey++) {
+			// FNV-1a
+			uint64_t h = 0xcbf29ce484222325ULL;
+			for (const char *p = pTree->keyNames[iKey].c_str(); *p; p++)
+				h = (h ^ (uint8_t) *p) * 0x100000001b3ULL;
+			// zero is anonymous
+			pHash[iKey] = iKey ? h : 0;
+		}
+
+		for (uint32_t iNode = pTree->nstart; iNode < pTree->ncount; iNode++) {
+			const baseNode_t *pNode = pTree->N + iNode;
+			uint64_t         h      = pHash[pNode->Q];
+
+			h = (h ^ (h >> 29)) * 0xbf58476d1ce4e5b9ULL + pHash[pNode->T & ~IBIT] + ((pNode->T & IBIT) ? 1 : 0);
+			h = (h ^ (h >> 32)) * 0x94d049bb133111ebULL + pHash[pNode->F];
+			pHash[iNode] = h ^ (h >> 31);
+		}
+
+		return pHash;
+	}
+
+	/**
+	 * @date 2026-10-17 21:00:13
+	 *
+	 * Confirm two nodes with equal structural hash are structurally identical.
+	 * Endpoints match by name. Left nodes are matched to at most one right node,
+	 * a different right node for the same left node is reported as not identical and left to simulation.
+	 *
+	 * @param {number} L - left node
+	 * @param {number} R - right node
+	 * @param {uint32_t[]} pMatch - right node + 1 for left nodes, zero is unmatched. Confirmed matches are kept between calls.
+	 * @param {uint32_t[]} pStack - scratch, 7 entries per left node
+	 * @return {boolean} `true` if identical
+	 */
+	bool structuralEqual(uint32_t L, uint32_t R, uint32_t *pMatch, uint32_t *pStack) const {
+		// matches made by this call, undone when not identical
+		uint32_t *pJournal  = pStack + 6 * (size_t) pTreeL->ncount + 2;
+		unsigned numJournal = 0;
+		unsigned numStack   = 0;
+		bool     identical  = true;
+
+		pStack[numStack++] = L;
+		pStack[numStack++] = R;
+
+		while (identical && numStack > 0) {
+			uint32_t r = pStack[--numStack];
+			uint32_t l = pStack[--numStack];
+
+			if (l < pTreeL->nstart || r < pTreeR->nstart) {
+				if (l >= pTreeL->nstart || r >= pTreeR->nstart)
+					identical = false;
+				else if (l == 0 || r == 0)
+					identical = (l == r);
+				else
+					identical = (pTreeL->keyNames[l] == pTreeR->keyNames[r]);
+				continue;
+			}
+
+			if (pMatch[l]) {
+				identical = (pMatch[l] == r + 1);
+				continue;
+			}
+			pMatch[l] = r + 1;
+			pJournal[numJournal++] = l;
+
+			const baseNode_t *pNodeL = pTreeL->N + l;
+			const baseNode_t *pNodeR = pTreeR->N + r;
+
+			if ((pNodeL->T & IBIT) != (pNodeR->T & IBIT)) {
+				identical = false;
+				continue;
+			}
+
+			pStack[numStack++] = pNodeL->Q;
+			pStack[numStack++] = pNodeR->Q;
+			pStack[numStack++] = pNodeL->T & ~IBIT;
+			pStack[numStack++] = pNodeR->T & ~IBIT;
+			pStack[numStack++] = pNodeL->F;
+			pStack[numStack++] = pNodeR->F;
+		}
+
+		if (!identical) {
+			while (numJournal > 0)
+				pMatch[pJournal[--numJournal]] = 0;
+		}
+
+		return identical;
+	}
+
+	/**
+	 * @date 2026-10-17 21:00:13
+	 *
+	 * Simulate rounds, mark roots with counter examples
+	 *
+	 * @param {worker_t} pWorker - thread scratch
+	 */
+	void simulateRounds(worker_t *pWorker) {
+		uint64_t *pValueL = pWorker->pValueL;
+		uint64_t *pValueR = pWorker->pValueR;
+
+		for (;;) {
+			unsigned iRound = __atomic_fetch_add(&nextJob, 1, __ATOMIC_RELAXED);
+			if (iRound >= opt_rounds)
+				break;
+
+			for (uint32_t iKey = 0; iKey < pTreeL->nstart; iKey++)
+				pValueL[iKey] = 0;
+			for (uint32_t iKey = 0; iKey < pTreeR->nstart; iKey++)
+				pValueR[iKey] = 0;
+
+			for (uint32_t iKey = pTreeL->kstart; iKey < pTreeL->ostart; iKey++) {
+				uint64_t v = pattern(iRound, iKey);
+
+				pValueL[iKey]          = v;
+				pValueR[pKeyMap[iKey]] = v;
+			}
+
+			evaluateTree(pTreeL, pValueL);
+			evaluateTree(pTreeR, pValueR);
+
+			for (unsigned iRoot = 0; iRoot < numRoots; iRoot++) {
+				root_t *pRoot = pRoots + iRoot;
+
+				if (pRoot->verdict == VERDICT_UNDECIDED && rootValue(pValueL, pRoot->L) != rootValue(pValueR, pRoot->R))
+					__atomic_store_n(&pRoot->verdict, VERDICT_DIFFER, __ATOMIC_RELAXED);
+			}
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 21:02:54
+	 *
+	 * Collect ascending cone of a root, record keys in left key ids
+	 *
+	 * @param {baseTree_t} pTree - tree
+	 * @param {number} R - root
+	 * @param {uint32_t[]} pVersion - version map
+	 * @param {number} iVersion - current version
+	 * @param {uint32_t[]} pCone - cone (output), followed by stack
+	 * @param {uint32_t[]} pKeys - keys (appended)
+	 * @param {number} numKeys - keys already present
+	 * @param {uint32_t[]} pKeyVersion - version map of left key ids, shared by both trees to merge keys
+	 * @param {uint32_t[]} pKeyId - left key id for tree ids, NULL for identity
+	 * @return {number} - number of cone nodes
+	 */
+	static unsigned collectCone(const baseTree_t *pTree, uint32_t R, uint32_t *pVersion, uint32_t iVersion, uint32_t *pCone, uint32_t *pKeys, unsigned &numKeys, uint32_t *pKeyVersion, const uint32_t *pKeyId) {
+		unsigned numCone = 0, numStack = 0;
+		uint32_t *pStack = pCone + pTree->ncount;
+
+		pStack[numStack++] = R & ~IBIT;
+
+		while (numStack > 0) {
+			uint32_t curr = pStack[--numStack];
+
+			if (pVersion[curr] == iVersion)
+				continue;
+			pVersion[curr] = iVersion;
+
+			if (curr < pTree->nstart) {
+				// non-key endpoints evaluate as zero
+				uint32_t iKey = pKeyId ? pKeyId[curr] : (curr >= pTree->kstart && curr < pTree->ostart) ? curr : 0;
+
+				if (iKey != 0 && pKeyVersion[iKey] != iVersion) {
+					pKeyVersion[iKey] = iVersion;
+					pKeys[numKeys++]  = iKey;
+				}
+				continue;
+			}
+
+			pCone[numCone++] = curr;
+
+			const baseNode_t *pNode = pTree->N + curr;
+			pStack[numStack++] = pNode->Q;
+			pStack[numStack++] = pNode->T & ~IBIT;
+			pStack[numStack++] = pNode->F;
+		}
+
+		// nodes are tree-walk ordered, lowest id first
+		qsort(pCone, numCone, sizeof(*pCone), comparId);
+
+		return numCone;
+	}
+
+	/**
+	 * Compare function for `qsort`
+	 */
+	static int comparId(const void *lhs, const void *rhs) {
+		uint32_t L = *(const uint32_t *) lhs;
+		uint32_t R = *(const uint32_t *) rhs;
+
+		return L < R ? -1 : (L > R ? +1 : 0);
+	}
+
+	/**
+	 * @date 2026-10-17 21:05:30
+	 *
+	 * Exhaustively compare undecided roots with small cones
+	 *
+	 * @param {worker_t} pWorker - thread scratch
+	 * @param {uint32_t[]} pRevKeyMap - left key id for right key id
+	 */
+	void exhaustiveRoots(worker_t *pWorker, const uint32_t *pRevKeyMap) {
+		static const uint64_t slicePattern[6] = {
+			0xaaaaaaaaaaaaaaaaULL, 0xccccccccccccccccULL, 0xf0f0f0f0f0f0f0f0ULL,
+			0xff00ff00ff00ff00ULL, 0xffff0000ffff0000ULL, 0xffffffff00000000ULL
+		};
+		uint64_t *pValueL = pWorker->pValueL;
+		uint64_t *pValueR = pWorker->pValueR;
+
+		for (;;) {
+			unsigned iRoot = __atomic_fetch_add(&nextJob, 1, __ATOMIC_RELAXED);
+			if (iRoot >= numRoots)
+				break;
+
+			root_t *pRoot = pRoots + iRoot;
+			if (pRoot->verdict != VERDICT_UNDECIDED)
+				continue;
+
+			/*
+			 * Collect cones, versions are per worker
+			 */
+			uint32_t iVersion = ++pWorker->iVersion;
+			unsigned numKeys  = 0;
+			unsigned numConeL = collectCone(pTreeL, pRoot->L, pWorker->pVersionL, iVersion, pWorker->pConeL, pWorker->pKeys, numKeys, pWorker->pVersionR + pTreeR->ncount, NULL);
+			unsigned numConeR = collectCone(pTreeR, pRoot->R, pWorker->pVersionR, iVersion, pWorker->pConeR, pWorker->pKeys, numKeys, pWorker->pVersionR + pTreeR->ncount, pRevKeyMap);
+
+			pRoot->numKeys = numKeys;
+			if (numKeys > opt_exhaustive) {
+				pRoot->verdict = VERDICT_PROBABLE;
+				continue;
+			}
+
+			/*
+			 * First 6 keys within a slice, remaining keys across slices
+			 */
+			const uint32_t *pKeys   = pWorker->pKeys;
+			uint64_t       numSlice = numKeys > 6 ? 1ULL << (numKeys - 6) : 1;
+
+			pValueL[0] = pValueR[0] = 0;
+			for (unsigned k = 0; k < numKeys && k < 6; k++)
+				pValueL[pKeys[k]] = pValueR[pKeyMap[pKeys[k]]] = slicePattern[k];
+
+			pRoot->verdict = VERDICT_EQUIVALENT;
+			for (uint64_t iSlice = 0; iSlice < numSlice; iSlice++) {
+				for (unsigned k = 6; k < numKeys; k++)
+					pValueL[pKeys[k]] = pValueR[pKeyMap[pKeys[k]]] = (iSlice >> (k - 6)) & 1 ? ~0ULL : 0;
+
+				evaluateCone(pTreeL, pValueL, pWorker->pConeL, numConeL);
+				evaluateCone(pTreeR, pValueR, pWorker->pConeR, numConeR);
+
+				if (rootValue(pValueL, pRoot->L) != rootValue(pValueR, pRoot->R)) {
+					pRoot->verdict = VERDICT_DIFFER;
+					break;
+				}
+			}
+		}
+	}
+
+	/// @var {uint32_t[]} left key id for right key id, used by `exhaustiveEntry()`
+	uint32_t *pRevKeyMap;
+
+	/**
+	 * pthread entry point for simulation
+	 */
+	static void *simulateEntry(void *arg) {
+		worker_t *pWorker = (worker_t *) arg;
+		pWorker->pApp->simulateRounds(pWorker);
+		return NULL;
+	}
+
+	/**
+	 * pthread entry point for exhaustive
+	 */
+	static void *exhaustiveEntry(void *arg) {
+		worker_t *pWorker = (worker_t *) arg;
+		pWorker->pApp->exhaustiveRoots(pWorker, pWorker->pApp->pRevKeyMap);
+		return NULL;
+	}
+
+	/**
+	 * @date 2026-10-17 21:08:19
+	 *
+	 * Run workers, inline when only one
+	 *
+	 * @param {worker_t[]} pWorkers - workers
+	 * @param {number} numWorker - number of workers
+	 * @param {function} entry - pthread entry point
+	 */
+	void runWorkers(worker_t *pWorkers, unsigned numWorker, void *(*entry)(void *)) {
+		nextJob = 0;
+
+		if (numWorker == 1) {
+			(*entry)(pWorkers);
+			return;
+		}
+
+		for (unsigned iWorker = 0; iWorker < numWorker; iWorker++) {
+			int ret = pthread_create(&pWorkers[iWorker].thread, NULL, entry, pWorkers + iWorker);
+			if (ret)
+				ctx.fatal("\n{\"error\":\"pthread_create() failed\",\"where\":\"%s:%s:%d\",\"return\":%d}\n",
+					  __FUNCTION__, __FILE__, __LINE__, ret);
+		}
+		for (unsigned iWorker = 0; iWorker < numWorker; iWorker++)
+			pthread_join(pWorkers[iWorker].thread, NULL);
+	}
+
+	/**
+	 * @date 2026-10-17 21:10:46
+	 *
+	 * Load a tree
+	 */
+	baseTree_t *loadTree(const char *fileName) {
+		baseTree_t *pTree = new baseTree_t(ctx);
+
+		if (pTree->loadFile(fileName)) {
+			json_t *jError = json_object();
+			json_object_set_new_nocheck(jError, "error", json_string_nocheck("failed to load"));
+			json_object_set_new_nocheck(jError, "filename", json_string(fileName));
+			ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+		}
+
+		/*
+		 * Extended keys have no counterpart in the other tree
+		 */
+		if (pTree->nstart > pTree->estart) {
+			json_t *jError = json_object();
+			json_object_set_new_nocheck(jError, "error", json_string_nocheck("extended keys not supported"));
+			json_object_set_new_nocheck(jError, "filename", json_string(fileName));
+			ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+		}
+
+		return pTree;
+	}
+
+	/**
+	 * @date 2026-10-17 21:12:03
+	 *
+	 * Main entrypoint
+	 *
+	 * @return {number} - 0 if all roots equivalent, 1 if any differ
+	 */
+	int main(const char *leftFilename, const char *rightFilename) {
+
+		pTreeL = loadTree(leftFilename);
+		pTreeR = loadTree(rightFilename);
+
+		/*
+		 * Match keys and roots by name
+		 */
+		std::map<std::string, uint32_t> names;
+
+		if (pTreeL->ostart - pTreeL->kstart != pTreeR->ostart - pTreeR->kstart)
+			ctx.fatal("{\"error\":\"key count mismatch\",\"where\":\"%s:%s:%d\",\"left\":%u,\"right\":%u}\n",
+				  __FUNCTION__, __FILE__, __LINE__, pTreeL->ostart - pTreeL->kstart, pTreeR->ostart - pTreeR->kstart);
+
+		for (uint32_t iKey = pTreeR->kstart; iKey < pTreeR->ostart; iKey++)
+			names[pTreeR->keyNames[iKey]] = iKey;
+
+		pKeyMap    = (uint32_t *) ctx.myAlloc("kcompareContext_t::pKeyMap", pTreeL->nstart, sizeof(*pKeyMap));
+		pRevKeyMap = (uint32_t *) ctx.myAlloc("kcompareContext_t::pRevKeyMap", pTreeR->nstart, sizeof(*pRevKeyMap));
+
+		// non-keys evaluate as zero
+		for (uint32_t iKey = 0; iKey < pTreeL->nstart; iKey++)
+			pKeyMap[iKey] = 0;
+		for (uint32_t iKey = 0; iKey < pTreeR->nstart; iKey++)
+			pRevKeyMap[iKey] = 0;
+
+		for (uint32_t iKey = pTreeL->kstart; iKey < pTreeL->ostart; iKey++) {
+			std::map<std::string, uint32_t>::iterator it = names.find(pTreeL->keyNames[iKey]);
+
+			if (it == names.end())
+				ctx.fatal("{\"error\":\"key not found\",\"where\":\"%s:%s:%d\",\"name\":\"%s\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__, pTreeL->keyNames[iKey].c_str());
+
+			pKeyMap[iKey]          = it->second;
+			pRevKeyMap[it->second] = iKey;
+		}
+
+		names.clear();
+		for (uint32_t iRoot = pTreeR->ostart; iRoot < pTreeR->numRoots; iRoot++)
+			names[pTreeR->rootNames[iRoot]] = iRoot;
+
+		pRoots = (root_t *) ctx.myAlloc("kcompareContext_t::pRoots", pTreeL->numRoots, sizeof(*pRoots));
+
+		for (uint32_t iRoot = pTreeL->ostart; iRoot < pTreeL->numRoots; iRoot++) {
+			std::map<std::string, uint32_t>::iterator it = names.find(pTreeL->rootNames[iRoot]);
+
+			if (it == names.end())
+				ctx.fatal("{\"error\":\"root not found\",\"where\":\"%s:%s:%d\",\"name\":\"%s\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__, pTreeL->rootNames[iRoot].c_str());
+
+			root_t *pRoot = pRoots + numRoots++;
+			pRoot->L       = pTreeL->roots[iRoot];
+			pRoot->R       = pTreeR->roots[it->second];
+			pRoot->verdict = VERDICT_UNDECIDED;
+			pRoot->numKeys = 0;
+		}
+
+		if (numRoots != pTreeR->numRoots - pTreeR->ostart)
+			ctx.fatal("{\"error\":\"root count mismatch\",\"where\":\"%s:%s:%d\",\"left\":%u,\"right\":%u}\n",
+				  __FUNCTION__, __FILE__, __LINE__, numRoots, pTreeR->numRoots - pTreeR->ostart);
+
+		/*
+		 * Structural
+		 */
+		uint64_t *pHashL = structuralHash(pTreeL);
+		uint64_t *pHashR = structuralHash(pTreeR);
+		uint32_t *pMatch = (uint32_t *) ctx.myAlloc("kcompareContext_t::pMatch", pTreeL->ncount, sizeof(*pMatch));
+		uint32_t *pStack = (uint32_t *) ctx.myAlloc("kcompareContext_t::pStack", 7 * (size_t) pTreeL->ncount + 2, sizeof(*pStack));
+
+		for (unsigned iRoot = 0; iRoot < numRoots; iRoot++) {
+			root_t *pRoot = pRoots + iRoot;
+
+			if (pHashL[pRoot->L & ~IBIT] == pHashR[pRoot->R & ~IBIT] && (pRoot->L & IBIT) == (pRoot->R & IBIT)) {
+				// hashes can collide, confirm
+				if (structuralEqual(pRoot->L & ~IBIT, pRoot->R & ~IBIT, pMatch, pStack))
+					pRoot->verdict = VERDICT_IDENTICAL;
+			}
+		}
+
+		ctx.myFree("kcompareContext_t::pStack", pStack);
+		ctx.myFree("kcompareContext_t::pMatch", pMatch);
+
+		ctx.myFree("kcompareContext_t::pHash", pHashR);
+		ctx.myFree("kcompareContext_t::pHash", pHashL);
+
+		/*
+		 * Workers with private scratch
+		 */
+		unsigned numWorker = opt_threads ? opt_threads : 1;
+		worker_t *pWorkers = (worker_t *) ctx.myAlloc("kcompareContext_t::pWorkers", numWorker, sizeof(*pWorkers));
+
+		for (unsigned iWorker = 0; iWorker < numWorker; iWorker++) {
+			worker_t *pWorker = pWorkers + iWorker;
+
+			pWorker->pApp      = this;
+			pWorker->iWorker   = iWorker;
+			pWorker->pValueL   = (uint64_t *) ctx.myAlloc("kcompareContext_t::pValue", pTreeL->ncount, sizeof(uint64_t));
+			pWorker->pValueR   = (uint64_t *) ctx.myAlloc("kcompareContext_t::pValue", pTreeR->ncount, sizeof(uint64_t));
+			pWorker->pVersionL = (uint32_t *) ctx.myAlloc("kcompareContext_t::pVersion", pTreeL->ncount, sizeof(uint32_t));
+			// followed by version map for left key ids
+			pWorker->pVersionR = (uint32_t *) ctx.myAlloc("kcompareContext_t::pVersion", pTreeR->ncount + pTreeL->nstart, sizeof(uint32_t));
+			pWorker->iVersion  = 0;
+			pWorker->pConeL    = (uint32_t *) ctx.myAlloc("kcompareContext_t::pCone", (size_t) pTreeL->ncount * 4 + 4, sizeof(uint32_t));
+			pWorker->pConeR    = (uint32_t *) ctx.myAlloc("kcompareContext_t::pCone", (size_t) pTreeR->ncount * 4 + 4, sizeof(uint32_t));
+			pWorker->pKeys     = (uint32_t *) ctx.myAlloc("kcompareContext_t::pKeys", pTreeL->nstart, sizeof(uint32_t));
+		}
+
+		/*
+		 * Simulation, then exhaustive
+		 */
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "[%s] Simulating %u rounds\n", ctx.timeAsString(), opt_rounds);
+
+		runWorkers(pWorkers, numWorker, simulateEntry);
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "[%s] Exhaustive cones\n", ctx.timeAsString());
+
+		runWorkers(pWorkers, numWorker, exhaustiveEntry);
+
+		for (unsigned iWorker = 0; iWorker < numWorker; iWorker++) {
+			worker_t *pWorker = pWorkers + iWorker;
+
+			ctx.myFree("kcompareContext_t::pKeys", pWorker->pKeys);
+			ctx.myFree("kcompareContext_t::pCone", pWorker->pConeR);
+			ctx.myFree("kcompareContext_t::pCone", pWorker->pConeL);
+			ctx.myFree("kcompareContext_t::pVersion", pWorker->pVersionR);
+			ctx.myFree("kcompareContext_t::pVersion", pWorker->pVersionL);
+			ctx.myFree("kcompareContext_t::pValue", pWorker->pValueR);
+			ctx.myFree("kcompareContext_t::pValue", pWorker->pValueL);
+		}
+		ctx.myFree("kcompareContext_t::pWorkers", pWorkers);
+
+		/*
+		 * Report
+		 */
+		static const char *verdictNames[] = {"undecided", "identical", "equivalent", "probable", "DIFFER"};
+		unsigned          cntVerdict[5]   = {0};
+
+		for (unsigned iRoot = 0; iRoot < numRoots; iRoot++) {
+			const root_t *pRoot = pRoots + iRoot;
+
+			cntVerdict[pRoot->verdict]++;
+			if (ctx.opt_verbose >= ctx.VERBOSE_VERBOSE || pRoot->verdict == VERDICT_DIFFER)
+				printf("%s: %s\n", pTreeL->rootNames[pTreeL->ostart + iRoot].c_str(), verdictNames[pRoot->verdict]);
+		}
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY) {
+			json_t *jResult = json_object();
+			json_object_set_new_nocheck(jResult, "numroots", json_integer(numRoots));
+			json_object_set_new_nocheck(jResult, "identical", json_integer(cntVerdict[VERDICT_IDENTICAL]));
+			json_object_set_new_nocheck(jResult, "equivalent", json_integer(cntVerdict[VERDICT_EQUIVALENT]));
+			json_object_set_new_nocheck(jResult, "probable", json_integer(cntVerdict[VERDICT_PROBABLE]));
+			json_object_set_new_nocheck(jResult, "differ", json_integer(cntVerdict[VERDICT_DIFFER]));
+			printf("%s\n", json_dumps(jResult, JSON_PRESERVE_ORDER | JSON_COMPACT));
+		}
+
+		ctx.myFree("kcompareContext_t::pRoots", pRoots);
+		ctx.myFree("kcompareContext_t::pRevKeyMap", pRevKeyMap);
+		ctx.myFree("kcompareContext_t::pKeyMap", pKeyMap);
+		delete pTreeR;
+		delete pTreeL;
+
+		return cntVerdict[VERDICT_DIFFER] ? 1 : 0;
+	}
+
+};
+
+/*
+ * Application context.
+ * Needs to be global to be accessible by signal handlers.
+ *
+ * @global {kcompareContext_t} Application context
+ */
+kcompareContext_t app;
+
+void usage(char *argv[], bool verbose) {
+	fprintf(stderr, "usage: %s <left.dat> <right.dat>\n", argv[0]);
+	if (verbose) {
+		fprintf(stderr, "\t   --exhaustive=<number>   Maximum cone keys for exhaustive proof [default=%u]\n", app.opt_exhaustive);
+		fprintf(stderr, "\t-q --quiet\n");
+		fprintf(stderr, "\t   --rounds=<number>       Random simulation rounds of 64 patterns [default=%u]\n", app.opt_rounds);
+		fprintf(stderr, "\t   --seed=n                Random seed to generate test patterns. [Default=%u]\n", app.opt_seed);
+		fprintf(stderr, "\t   --threads=<number>      Worker threads, 0=serial [default=%u]\n", app.opt_threads);
+		fprintf(stderr, "\t   --timer=<seconds> [default=%d]\n", ctx.opt_timer);
+		fprintf(stderr, "\t-v --verbose               Show verdict for every root\n");
+	}
+}
+
+/**
+ * @date 2026-10-17 21:14:28
+ *
+ * Program main entry point
+ * Process all user supplied arguments to construct a application context.
+ * Activate application context.
+ *
+ * @param  {number} argc - number of arguments
+ * @param  {string[]} argv - program arguments
+ * @return {number} 0 on normal return, non-zero when attention is required
+ */
+int main(int argc, char *argv[]) {
+	setlinebuf(stdout);
+
+	for (;;) {
+		enum {
+			LO_HELP  = 1, LO_DEBUG, LO_EXHAUSTIVE, LO_ROUNDS, LO_SEED, LO_THREADS, LO_TIMER,
+			LO_QUIET = 'q', LO_VERBOSE = 'v'
+		};
+
+		static struct option long_options[] = {
+			/* name, has_arg, flag, val */
+			{"debug",      1, 0, LO_DEBUG},
+			{"exhaustive", 1, 0, LO_EXHAUSTIVE},
+			{"help",       0, 0, LO_HELP},
+			{"quiet",      2, 0, LO_QUIET},
+			{"rounds",     1, 0, LO_ROUNDS},
+			{"seed",       1, 0, LO_SEED},
+			{"threads",    1, 0, LO_THREADS},
+			{"timer",      1, 0, LO_TIMER},
+			{"verbose",    2, 0, LO_VERBOSE},
+			//
+			{NULL,         0, 0, 0}
+		};
+
+		char optstring[64];
+		char *cp                            = optstring;
+		int  option_index                   = 0;
+
+		for (int i = 0; long_options[i].name; i++) {
+			if (isalpha(long_options[i].val)) {
+				*cp++ = (char) long_options[i].val;
+
+				if (long_options[i].has_arg)
+					*cp++ = ':';
+				if (long_options[i].has_arg == 2)
+					*cp++ = ':';
+			}
+		}
+
+		*cp = '\0';
+
+		int c = getopt_long(argc, argv, optstring, long_options, &option_index);
+		if (c == -1)
+			break;
+
+		switch (c) {
+		case LO_DEBUG:
+			ctx.opt_debug = (unsigned) strtoul(optarg, NULL, 8); // OCTAL!!
+			break;
+		case LO_EXHAUSTIVE:
+			app.opt_exhaustive = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_HELP:
+			usage(argv, true);
+			exit(0);
+		case LO_QUIET:
+			ctx.opt_verbose = optarg ? (unsigned) strtoul(optarg, NULL, 10) : ctx.opt_verbose - 1;
+			break;
+		case LO_ROUNDS:
+			app.opt_rounds = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_SEED:
+			app.opt_seed = ::strtoul(optarg, NULL, 0);
+			break;
+		case LO_THREADS:
+			app.opt_threads = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_TIMER:
+			ctx.opt_timer = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_VERBOSE:
+			ctx.opt_verbose = optarg ? (unsigned) strtoul(optarg, NULL, 10) : ctx.opt_verbose + 1;
+			break;
+
+		case '?':
+			ctx.fatal("Try `%s --help' for more information.\n", argv[0]);
+		default:
+			ctx.fatal("getopt returned character code %d\n", c);
+		}
+	}
+
+	char *leftFilename;
+	char *rightFilename;
+
+	if (argc - optind >= 2) {
+		leftFilename  = argv[optind++];
+		rightFilename = argv[optind++];
+	} else {
+		usage(argv, false);
+		exit(1);
+	}
+
+	if (app.opt_exhaustive > 64 - 6)
+		ctx.fatal("--exhaustive too large\n");
+
+	/*
+	 * Main
+	 */
+
+	// register timer handler
+	if (ctx.opt_timer) {
+		signal(SIGALRM, sigalrmHandler);
+		::alarm(ctx.opt_timer);
+	}
+
+	return app.main(leftFilename, rightFilename);
+}
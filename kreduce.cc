@@ -0,0 +1,772 @@
+//#pragma GCC optimize ("O3") // optimize on demand
+
+/*
+ * kreduce.cc
+ *      Functional reduction: merge equivalent nodes found by random simulation
+ *
+ * All nodes are simulated with 64-bit random test patterns per key.
+ * Nodes (and endpoints) are bucketed by the crc of their footprint, normalised for polarity.
+ * A node with an identical (or inverted) footprint to an earlier node is a candidate.
+ * Candidates are confirmed by exhaustive evaluation over the keys of the combined cone,
+ * or, when requested with `--rounds`, by additional simulation when the cone has too many keys.
+ * Confirmed nodes are replaced by the earlier node and the tree is rebuilt.
+ */
+
+/*
+ *	This file is part of Untangle, Information in fractal structures.
+ *	Copyright (C) 2017-2026, xyzzy@rockingship.org
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string>
+#include <ctype.h>
+#include <errno.h>
+#include <getopt.h>
+#include <jansson.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "context.h"
+#include "basetree.h"
+
+/*
+ * Resource context.
+ * Needs to be global to be accessible by signal handlers.
+ *
+ * @global {context_t} Application context
+ */
+context_t ctx;
+
+/**
+ * @date 2021-05-17 22:45:37
+ *
+ * Signal handlers
+ *
+ * Bump interval timer
+ *
+ * @param {number} sig - signal (ignored)
+ */
+void sigalrmHandler(int __attribute__ ((unused)) sig) {
+	if (ctx.opt_timer) {
+		ctx.tick++;
+		alarm(ctx.opt_timer);
+	}
+}
+
+/**
+ * @date 2026-10-17 20:31:12
+ *
+ * Main program logic as application context
+ * It is contained as an independent `struct` so it can be easily included into projects/code
+ */
+struct kreduceContext_t {
+
+	/// @var {number} --datasize, Data vector size containing random test patterns (units in uint64_t)
+	unsigned opt_dataSize;
+	/// @var {number} --exhaustive, Maximum number of cone keys for exhaustive confirmation
+	unsigned opt_exhaustive;
+	/// @var {number} header flags
+	uint32_t opt_flags;
+	/// @var {number} --force, force overwriting of outputs if already exists
+	unsigned opt_force;
+	/// @var {number} --maxnode, Maximum number of nodes for `baseTree_t`.
+	unsigned opt_maxNode;
+	/// @var {number} --rounds, Additional 64-bit simulation rounds to accept candidates with large cones, 0 to only merge proven
+	unsigned opt_rounds;
+	/// @global {number} --seed=n, Random seed to generate test patterns
+	unsigned opt_seed;
+
+	/// @var {number} candidates with matching footprints
+	unsigned cntCandidate;
+	/// @var {number} candidates confirmed by exhaustive evaluation
+	unsigned cntExhaustive;
+	/// @var {number} candidates confirmed by additional simulation
+	unsigned cntSimulated;
+	/// @var {number} candidates rejected (footprint collision)
+	unsigned cntRejected;
+	/// @var {number} candidates with large cones not merged
+	unsigned cntUnproven;
+
+	kreduceContext_t() {
+		opt_dataSize   = 8;
+		opt_exhaustive = 16;
+		opt_flags      = 0;
+		opt_force      = 0;
+		opt_maxNode    = DEFAULT_MAXNODE;
+		opt_rounds     = 0;
+		opt_seed       = 0x20261017;
+
+		cntCandidate  = 0;
+		cntExhaustive = 0;
+		cntSimulated  = 0;
+		cntRejected   = 0;
+		cntUnproven   = 0;
+	}
+
+	/**
+	 * @date 2026-10-17 20:32:40
+	 *
+	 * 64 random bits
+	 *
+	 * @return {number} - random word
+	 */
+	static uint64_t randomWord(void) {
+		uint64_t v;
+
+		v = (uint64_t) rand();
+		v = (v << 16) ^ (uint64_t) rand();
+		v = (v << 16) ^ (uint64_t) rand();
+		v = (v << 16) ^ (uint64_t) rand();
+
+		return v;
+	}
+
+	/**
+	 * @date 2026-10-17 20:33:05
+	 *
+	 * `crc32c` of a footprint, optionally inverted
+	 *
+	 * @param {uint64_t[]} pData - footprint
+	 * @param {number} numData - number of words
+	 * @param {number} invert - 0 or ~0
+	 * @return {number} - crc
+	 */
+	static uint32_t footprintCrc(const uint64_t *pData, unsigned numData, uint64_t invert) {
+		uint64_t crc = 0;
+
+		for (unsigned j = 0; j < numData; j++)
+			__asm__ __volatile__ ("crc32q %1, %0" : "+r"(crc) : "rm"(pData[j] ^ invert));
+
+		return (uint32_t) crc;
+	}
+
+	/**
+	 * @date 2026-10-17 20:34:21
+	 *
+	 * Evaluate a single 64-bit slice for a list of (ascending) nodes
+	 *
+	 * @param {baseTree_t} pTree - tree
+	 * @param {uint64_t[]} pValue - values indexed by node id, endpoints already set
+	 * @param {uint32_t[]} pCone - nodes to evaluate
+	 * @param {number} numCone - number of nodes
+	 */
+	static inline void evaluateSlice(const baseTree_t *pTree, uint64_t *pValue, const uint32_t *pCone, unsigned numCone) {
+		for (unsigned i = 0; i < numCone; i++) {
+			const baseNode_t *pNode = pTree->N + pCone[i];
+			const uint64_t   Q      = pValue[pNode->Q];
+			const uint64_t   T      = pValue[pNode->T & ~IBIT];
+			const uint64_t   F      = pValue[pNode->F];
+
+			if (pNode->T & IBIT)
+				pValue[pCone[i]] = (Q & ~T) | (~Q & F);
+			else
+				pValue[pCone[i]] = (Q & T) | (~Q & F);
+		}
+	}
+
+	/**
+	 * Compare function for `qsort`
+	 */
+	static int comparId(const void *lhs, const void *rhs) {
+		uint32_t L = *(const uint32_t *) lhs;
+		uint32_t R = *(const uint32_t *) rhs;
+
+		return L < R ? -1 : (L > R ? +1 : 0);
+	}
+
+	/**
+	 * @date 2026-10-17 20:36:48
+	 *
+	 * Confirm that `L` equals `R^invert`.
+	 * Collect the combined cone, evaluate exhaustively when small enough, otherwise with extra random rounds.
+	 * Simulation is not proof: wide AND/OR's are near-constant and survive many unbiased patterns.
+	 * Rounds therefore alternate pattern densities 1/2, 1/4 and 3/4, and are only used when requested.
+	 *
+	 * @param {baseTree_t} pTree - tree
+	 * @param {number} L - earlier node/endpoint
+	 * @param {number} R - candidate node
+	 * @param {number} invert - 0 or ~0
+	 * @param {uint32_t[]} pVersion - version map
+	 * @param {uint32_t[]} pCone - scratch list of cone nodes
+	 * @param {uint32_t[]} pKeys - scratch list of cone endpoints
+	 * @param {uint64_t[]} pValue - scratch values indexed by node id
+	 * @return {boolean} - true if equivalent
+	 */
+	bool confirmEquivalent(baseTree_t *pTree, uint32_t L, uint32_t R, uint64_t invert, uint32_t *pVersion, uint32_t *pCone, uint32_t *pKeys, uint64_t *pValue) {
+		uint32_t thisVersion = ++pTree->mapVersionNr;
+
+		// clear version map when wraparound
+		if (thisVersion == 0) {
+			::memset(pVersion, 0, pTree->maxNodes * sizeof *pVersion);
+			thisVersion = ++pTree->mapVersionNr;
+		}
+
+		/*
+		 * Collect cone, `pCone[]` doubles as stack
+		 */
+		unsigned numCone = 0, numKeys = 0, numStack = 0;
+		uint32_t *pStack = pCone + pTree->ncount;
+
+		pStack[numStack++] = L;
+		pStack[numStack++] = R;
+
+		while (numStack > 0) {
+			uint32_t curr = pStack[--numStack];
+
+			if (pVersion[curr] == thisVersion)
+				continue;
+			pVersion[curr] = thisVersion;
+
+			if (curr < pTree->nstart) {
+				if (curr != 0)
+					pKeys[numKeys++] = curr;
+				continue;
+			}
+
+			pCone[numCone++] = curr;
+
+			const baseNode_t *pNode = pTree->N + curr;
+			pStack[numStack++] = pNode->Q;
+			pStack[numStack++] = pNode->T & ~IBIT;
+			pStack[numStack++] = pNode->F;
+		}
+
+		// nodes are tree-walk ordered, lowest id first
+		qsort(pCone, numCone, sizeof(*pCone), comparId);
+
+		pValue[0] = 0;
+
+		if (numKeys <= opt_exhaustive) {
+			/*
+			 * Exhaustive, first 6 keys within a slice, remaining keys across slices
+			 */
+			static const uint64_t slicePattern[6] = {
+				0xaaaaaaaaaaaaaaaaULL, 0xccccccccccccccccULL, 0xf0f0f0f0f0f0f0f0ULL,
+				0xff00ff00ff00ff00ULL, 0xffff0000ffff0000ULL, 0xffffffff00000000ULL
+			};
+			uint64_t numSlice = numKeys > 6 ? 1ULL << (numKeys - 6) : 1;
+
+			for (unsigned k = 0; k < numKeys && k < 6; k++)
+				pValue[pKeys[k]] = slicePattern[k];
+
+			for (uint64_t iSlice = 0; iSlice < numSlice; iSlice++) {
+				for (unsigned k = 6; k < numKeys; k++)
+					pValue[pKeys[k]] = (iSlice >> (k - 6)) & 1 ? ~0ULL : 0;
+
+				evaluateSlice(pTree, pValue, pCone, numCone);
+
+				if (pValue[L] != (pValue[R] ^ invert))
+					return false;
+			}
+
+			cntExhaustive++;
+		} else if (opt_rounds == 0) {
+			// too large to prove
+			cntUnproven++;
+			return false;
+		} else {
+			/*
+			 * Fresh random patterns, biased densities
+			 */
+			for (unsigned iRound = 0; iRound < opt_rounds; iRound++) {
+				for (unsigned k = 0; k < numKeys; k++) {
+					if (iRound % 3 == 0)
+						pValue[pKeys[k]] = randomWord();
+					else if (iRound % 3 == 1)
+						pValue[pKeys[k]] = randomWord() & randomWord();
+					else
+						pValue[pKeys[k]] = randomWord() | randomWord();
+				}
+
+				evaluateSlice(pTree, pValue, pCone, numCone);
+
+				if (pValue[L] != (pValue[R] ^ invert))
+					return false;
+			}
+
+			cntSimulated++;
+		}
+
+		return true;
+	}
+
+	/**
+	 * @date 2026-10-17 20:41:30
+	 *
+	 * Simulate, bucket and confirm.
+	 * Populate `pMerge[]` with the replacement of every node, possibly itself.
+	 *
+	 * @param {baseTree_t} pTree - tree
+	 * @param {uint32_t[]} pMerge - node replacement map
+	 * @return {number} - number of merged nodes
+	 */
+	unsigned findEquivalent(baseTree_t *pTree, uint32_t *pMerge) {
+		const unsigned numData = opt_dataSize;
+
+		/*
+		 * Simulate all nodes
+		 */
+		uint64_t *pFootprint = (uint64_t *) ctx.myAlloc("kreduceContext_t::pFootprint", (size_t) pTree->ncount * numData, sizeof(*pFootprint));
+
+		for (unsigned j = 0; j < numData; j++)
+			pFootprint[j] = 0;
+		for (uint32_t iKey = 1; iKey < pTree->nstart; iKey++) {
+			for (unsigned j = 0; j < numData; j++)
+				pFootprint[(size_t) iKey * numData + j] = randomWord();
+		}
+
+		for (uint32_t iNode = pTree->nstart; iNode < pTree->ncount; iNode++) {
+			const baseNode_t *pNode = pTree->N + iNode;
+			const uint64_t   *pQ    = pFootprint + (size_t) pNode->Q * numData;
+			const uint64_t   *pT    = pFootprint + (size_t) (pNode->T & ~IBIT) * numData;
+			const uint64_t   *pF    = pFootprint + (size_t) pNode->F * numData;
+			uint64_t         *pR    = pFootprint + (size_t) iNode * numData;
+
+			if (pNode->T & IBIT) {
+				for (unsigned j = 0; j < numData; j++)
+					pR[j] = (pQ[j] & ~pT[j]) | (~pQ[j] & pF[j]);
+			} else {
+				for (unsigned j = 0; j < numData; j++)
+					pR[j] = (pQ[j] & pT[j]) | (~pQ[j] & pF[j]);
+			}
+		}
+
+		/*
+		 * Bucket by polarity normalised footprint, open addressing
+		 */
+		unsigned indexSize = 1;
+		while (indexSize < pTree->ncount * 2)
+			indexSize <<= 1;
+
+		uint32_t *pIndex    = (uint32_t *) ctx.myAlloc("kreduceContext_t::pIndex", indexSize, sizeof(*pIndex));
+		uint32_t *pCrc      = (uint32_t *) ctx.myAlloc("kreduceContext_t::pCrc", indexSize, sizeof(*pCrc));
+		uint32_t *pVersion  = pTree->allocVersion();
+		uint32_t *pCone     = (uint32_t *) ctx.myAlloc("kreduceContext_t::pCone", (size_t) pTree->ncount * 4 + 4, sizeof(*pCone));
+		uint32_t *pKeys     = (uint32_t *) ctx.myAlloc("kreduceContext_t::pKeys", pTree->nstart, sizeof(*pKeys));
+		uint64_t *pValue    = (uint64_t *) ctx.myAlloc("kreduceContext_t::pValue", pTree->ncount, sizeof(*pValue));
+		unsigned numMerged  = 0;
+
+		// empty slot is `~0`, node 0 (ZERO) is a valid entry
+		::memset(pIndex, 0xff, indexSize * sizeof(*pIndex));
+		::memset(pVersion, 0, pTree->maxNodes * sizeof(*pVersion));
+
+		// reset ticker
+		ctx.setupSpeed(pTree->ncount);
+		ctx.tick     = 0;
+		ctx.progress = 0;
+
+		for (uint32_t iNode = 0; iNode < pTree->ncount; iNode++) {
+			pMerge[iNode] = iNode;
+
+			// only ZERO and keys as endpoints
+			if (iNode > 0 && iNode < pTree->kstart)
+				continue;
+
+			ctx.progress++;
+			if (ctx.tick && ctx.opt_verbose >= ctx.VERBOSE_TICK) {
+				int perSecond = ctx.updateSpeed();
+
+				fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) %.5f%% candidate=%u merged=%u",
+					ctx.timeAsString(), ctx.progress, perSecond, ctx.progress * 100.0 / ctx.progressHi, cntCandidate, numMerged);
+
+				ctx.tick = 0;
+			}
+
+			const uint64_t *pR     = pFootprint + (size_t) iNode * numData;
+			const uint64_t invert  = (pR[0] & 1) ? ~0ULL : 0;
+			const uint32_t crc     = footprintCrc(pR, numData, invert);
+			unsigned       ix      = crc & (indexSize - 1);
+
+			for (;;) {
+				uint32_t L = pIndex[ix];
+
+				if (L == ~0U) {
+					// new entry
+					pIndex[ix] = iNode;
+					pCrc[ix]   = crc;
+					break;
+				}
+
+				if (pCrc[ix] == crc) {
+					const uint64_t *pL      = pFootprint + (size_t) L * numData;
+					const uint64_t polarity = ((pL[0] ^ pR[0]) & 1) ? ~0ULL : 0;
+					unsigned       j;
+
+					for (j = 0; j < numData; j++) {
+						if (pL[j] != (pR[j] ^ polarity))
+							break;
+					}
+
+					if (j == numData && iNode >= pTree->nstart) {
+						cntCandidate++;
+
+						unsigned numUnproven = cntUnproven;
+
+						if (confirmEquivalent(pTree, L, iNode, polarity, pVersion, pCone, pKeys, pValue)) {
+							pMerge[iNode] = L ^ (polarity ? IBIT : 0);
+							numMerged++;
+							break;
+						}
+
+						if (numUnproven == cntUnproven)
+							cntRejected++;
+					}
+				}
+
+				ix = (ix + 1) & (indexSize - 1);
+			}
+		}
+
+		// remove ticker
+		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
+			fprintf(stderr, "\r\e[K");
+
+		ctx.myFree("kreduceContext_t::pValue", pValue);
+		ctx.myFree("kreduceContext_t::pKeys", pKeys);
+		ctx.myFree("kreduceContext_t::pCone", pCone);
+		pTree->freeVersion(pVersion);
+		ctx.myFree("kreduceContext_t::pCrc", pCrc);
+		ctx.myFree("kreduceContext_t::pIndex", pIndex);
+		ctx.myFree("kreduceContext_t::pFootprint", pFootprint);
+
+		return numMerged;
+	}
+
+	/**
+	 * @date 2026-10-17 20:45:19
+	 *
+	 * Main entrypoint
+	 */
+	int main(const char *outputFilename, const char *inputFilename) {
+
+		/*
+		 * Open input tree
+		 */
+		baseTree_t *pOldTree = new baseTree_t(ctx);
+
+		if (pOldTree->loadFile(inputFilename)) {
+			json_t *jError = json_object();
+			json_object_set_new_nocheck(jError, "error", json_string_nocheck("failed to load"));
+			json_object_set_new_nocheck(jError, "filename", json_string(inputFilename));
+			ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+		}
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_VERBOSE) {
+			json_t *jResult = json_object();
+			json_object_set_new_nocheck(jResult, "filename", json_string_nocheck(inputFilename));
+			pOldTree->headerInfo(jResult);
+			pOldTree->extraInfo(jResult);
+			fprintf(stderr, "%s\n", json_dumps(jResult, JSON_PRESERVE_ORDER | JSON_COMPACT));
+			json_delete(jResult);
+		}
+
+		/*
+		 * Extended roots are used to implement a stack for tree-walking.
+		 */
+		if (pOldTree->nstart > pOldTree->estart) {
+			json_t *jError = json_object();
+			json_object_set_new_nocheck(jError, "error", json_string_nocheck("extended keys not supported"));
+			json_object_set_new_nocheck(jError, "filename", json_string(inputFilename));
+			ctx.fatal("%s\n", json_dumps(jError, JSON_PRESERVE_ORDER | JSON_COMPACT));
+		}
+
+		/*
+		 * Find equivalent nodes
+		 */
+		uint32_t *pMerge   = pOldTree->allocMap();
+		unsigned numMerged = findEquivalent(pOldTree, pMerge);
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "[%s] numNode=%u candidate=%u exhaustive=%u simulated=%u rejected=%u unproven=%u merged=%u\n",
+				ctx.timeAsString(), pOldTree->ncount - pOldTree->nstart, cntCandidate, cntExhaustive, cntSimulated, cntRejected, cntUnproven, numMerged);
+
+		/*
+		 * Rebuild with merged nodes replaced
+		 */
+		baseTree_t *pNewTree = new baseTree_t(ctx, pOldTree->kstart, pOldTree->ostart, pOldTree->estart, pOldTree->nstart, pOldTree->numRoots, opt_maxNode, opt_flags);
+
+		pNewTree->keyNames  = pOldTree->keyNames;
+		pNewTree->rootNames = pOldTree->rootNames;
+
+		uint32_t *pMap = pOldTree->allocMap();
+
+		for (uint32_t iKey = 0; iKey < pOldTree->nstart; iKey++)
+			pMap[iKey] = iKey;
+
+		for (uint32_t iNode = pOldTree->nstart; iNode < pOldTree->ncount; iNode++) {
+			const uint32_t M = pMerge[iNode];
+
+			if (M != iNode) {
+				// replacement is always an earlier node or endpoint
+				pMap[iNode] = pMap[M & ~IBIT] ^ (M & IBIT);
+			} else {
+				const baseNode_t *pNode = pOldTree->N + iNode;
+				const uint32_t   Q      = pNode->Q;
+				const uint32_t   Tu     = pNode->T & ~IBIT;
+				const uint32_t   Ti     = pNode->T & IBIT;
+				const uint32_t   F      = pNode->F;
+
+				pMap[iNode] = pNewTree->normaliseNode(pMap[Q], pMap[Tu] ^ Ti, pMap[F]);
+			}
+		}
+
+		// assign roots
+		for (uint32_t iRoot = 0; iRoot < pOldTree->numRoots; iRoot++) {
+			uint32_t R = pOldTree->roots[iRoot];
+
+			pNewTree->roots[iRoot] = pMap[R & ~IBIT] ^ (R & IBIT);
+		}
+
+		// and system
+		pNewTree->system = pMap[pOldTree->system & ~IBIT] ^ (pOldTree->system & IBIT);
+
+		pOldTree->freeMap(pMap);
+		pOldTree->freeMap(pMerge);
+
+		/*
+		 * Copy result to new tree without orphaned nodes
+		 */
+		baseTree_t *pTemp = new baseTree_t(ctx, pOldTree->kstart, pOldTree->ostart, pOldTree->estart, pOldTree->nstart, pOldTree->numRoots, opt_maxNode, opt_flags);
+		pTemp->keyNames  = pOldTree->keyNames;
+		pTemp->rootNames = pOldTree->rootNames;
+		pTemp->importActive(pNewTree);
+
+		delete pNewTree;
+		pNewTree = NULL;
+
+		/*
+		 * Save data
+		 */
+		pTemp->saveFile(outputFilename);
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY) {
+			json_t *jResult = json_object();
+			pTemp->headerInfo(jResult);
+			pTemp->extraInfo(jResult);
+			json_object_set_new_nocheck(jResult, "merged", json_integer(numMerged));
+			printf("%s\n", json_dumps(jResult, JSON_PRESERVE_ORDER | JSON_COMPACT));
+		}
+
+		delete pOldTree;
+		delete pTemp;
+
+		return 0;
+	}
+
+};
+
+/*
+ * Application context.
+ * Needs to be global to be accessible by signal handlers.
+ *
+ * @global {kreduceContext_t} Application context
+ */
+kreduceContext_t app;
+
+void usage(char *argv[], bool verbose) {
+	fprintf(stderr, "usage: %s <output.dat> <input.dat>\n", argv[0]);
+	if (verbose) {
+		fprintf(stderr, "\t-t --datasize=<number>     Random test patterns per node (units of 64) [default=%u]\n", app.opt_dataSize);
+		fprintf(stderr, "\t   --exhaustive=<number>   Maximum cone keys for exhaustive confirmation [default=%u]\n", app.opt_exhaustive);
+		fprintf(stderr, "\t   --force\n");
+		fprintf(stderr, "\t   --maxnode=<number> [default=%d]\n", app.opt_maxNode);
+		fprintf(stderr, "\t-q --quiet\n");
+		fprintf(stderr, "\t   --rounds=<number>       Accept larger cones after simulation rounds, 0=proven only [default=%u]\n", app.opt_rounds);
+		fprintf(stderr, "\t   --seed=n                Random seed to generate test patterns. [Default=%u]\n", app.opt_seed);
+		fprintf(stderr, "\t   --timer=<seconds> [default=%d]\n", ctx.opt_timer);
+		fprintf(stderr, "\t-v --verbose\n");
+		fprintf(stderr, "\t   --[no-]paranoid [default=%s]\n", app.opt_flags & ctx.MAGICMASK_PARANOID ? "enabled" : "disabled");
+		fprintf(stderr, "\t   --[no-]pure [default=%s]\n", app.opt_flags & ctx.MAGICMASK_PURE ? "enabled" : "disabled");
+		fprintf(stderr, "\t   --[no-]rewrite [default=%s]\n", app.opt_flags & ctx.MAGICMASK_REWRITE ? "enabled" : "disabled");
+		fprintf(stderr, "\t   --[no-]cascade [default=%s]\n", app.opt_flags & ctx.MAGICMASK_CASCADE ? "enabled" : "disabled");
+	}
+}
+
+/**
+ * @date 2026-10-17 20:47:03
+ *
+ * Program main entry point
+ * Process all user supplied arguments to construct a application context.
+ * Activate application context.
+ *
+ * @param  {number} argc - number of arguments
+ * @param  {string[]} argv - program arguments
+ * @return {number} 0 on normal return, non-zero when attention is required
+ */
+int main(int argc, char *argv[]) {
+	setlinebuf(stdout);
+
+	for (;;) {
+		enum {
+			LO_HELP  = 1, LO_DEBUG, LO_EXHAUSTIVE, LO_FORCE, LO_MAXNODE, LO_ROUNDS, LO_SEED, LO_TIMER,
+			LO_PARANOID, LO_NOPARANOID, LO_PURE, LO_NOPURE, LO_REWRITE, LO_NOREWRITE, LO_CASCADE, LO_NOCASCADE,
+			LO_DATASIZE = 't', LO_QUIET = 'q', LO_VERBOSE = 'v'
+		};
+
+		static struct option long_options[] = {
+			/* name, has_arg, flag, val */
+			{"datasize",    1, 0, LO_DATASIZE},
+			{"debug",       1, 0, LO_DEBUG},
+			{"exhaustive",  1, 0, LO_EXHAUSTIVE},
+			{"force",       0, 0, LO_FORCE},
+			{"help",        0, 0, LO_HELP},
+			{"maxnode",     1, 0, LO_MAXNODE},
+			{"quiet",       2, 0, LO_QUIET},
+			{"rounds",      1, 0, LO_ROUNDS},
+			{"seed",        1, 0, LO_SEED},
+			{"timer",       1, 0, LO_TIMER},
+			{"verbose",     2, 0, LO_VERBOSE},
+			//
+			{"paranoid",    0, 0, LO_PARANOID},
+			{"no-paranoid", 0, 0, LO_NOPARANOID},
+			{"pure",        0, 0, LO_PURE},
+			{"no-pure",     0, 0, LO_NOPURE},
+			{"rewrite",     0, 0, LO_REWRITE},
+			{"no-rewrite",  0, 0, LO_NOREWRITE},
+			{"cascade",     0, 0, LO_CASCADE},
+			{"no-cascade",  0, 0, LO_NOCASCADE},
+			//
+			{NULL,          0, 0, 0}
+		};
+
+		char optstring[64];
+		char *cp                            = optstring;
+		int  option_index                   = 0;
+
+		for (int i = 0; long_options[i].name; i++) {
+			if (isalpha(long_options[i].val)) {
+				*cp++ = (char) long_options[i].val;
+
+				if (long_options[i].has_arg)
+					*cp++ = ':';
+				if (long_options[i].has_arg == 2)
+					*cp++ = ':';
+			}
+		}
+
+		*cp = '\0';
+
+		int c = getopt_long(argc, argv, optstring, long_options, &option_index);
+		if (c == -1)
+			break;
+
+		switch (c) {
+		case LO_DATASIZE:
+			app.opt_dataSize = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_DEBUG:
+			ctx.opt_debug = (unsigned) strtoul(optarg, NULL, 8); // OCTAL!!
+			break;
+		case LO_EXHAUSTIVE:
+			app.opt_exhaustive = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_FORCE:
+			app.opt_force++;
+			break;
+		case LO_HELP:
+			usage(argv, true);
+			exit(0);
+		case LO_MAXNODE:
+			app.opt_maxNode = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_QUIET:
+			ctx.opt_verbose = optarg ? (unsigned) strtoul(optarg, NULL, 10) : ctx.opt_verbose - 1;
+			break;
+		case LO_ROUNDS:
+			app.opt_rounds = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_SEED:
+			app.opt_seed = ::strtoul(optarg, NULL, 0);
+			break;
+		case LO_TIMER:
+			ctx.opt_timer = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_VERBOSE:
+			ctx.opt_verbose = optarg ? (unsigned) strtoul(optarg, NULL, 10) : ctx.opt_verbose + 1;
+			break;
+
+		case LO_PARANOID:
+			app.opt_flags |= ctx.MAGICMASK_PARANOID;
+			break;
+		case LO_NOPARANOID:
+			app.opt_flags &= ~ctx.MAGICMASK_PARANOID;
+			break;
+		case LO_PURE:
+			app.opt_flags |= ctx.MAGICMASK_PURE;
+			break;
+		case LO_NOPURE:
+			app.opt_flags &= ~ctx.MAGICMASK_PURE;
+			break;
+		case LO_REWRITE:
+			app.opt_flags |= ctx.MAGICMASK_REWRITE;
+			break;
+		case LO_NOREWRITE:
+			app.opt_flags &= ~ctx.MAGICMASK_REWRITE;
+			break;
+		case LO_CASCADE:
+			app.opt_flags |= ctx.MAGICMASK_CASCADE;
+			break;
+		case LO_NOCASCADE:
+			app.opt_flags &= ~ctx.MAGICMASK_CASCADE;
+			break;
+
+		case '?':
+			ctx.fatal("Try `%s --help' for more information.\n", argv[0]);
+		default:
+			ctx.fatal("getopt returned character code %d\n", c);
+		}
+	}
+
+	char *outputFilename;
+	char *inputFilename;
+
+	if (argc - optind >= 2) {
+		outputFilename = argv[optind++];
+		inputFilename  = argv[optind++];
+	} else {
+		usage(argv, false);
+		exit(1);
+	}
+
+	if (app.opt_dataSize < 1)
+		ctx.fatal("--datasize must be at least 1\n");
+
+	/*
+	 * None of the outputs may exist
+	 */
+	if (!app.opt_force) {
+		struct stat sbuf;
+		if (!stat(outputFilename, &sbuf))
+			ctx.fatal("%s already exists. Use --force to overwrite\n", outputFilename);
+	}
+
+	/*
+	 * Main
+	 */
+
+	// set random seed
+	if (app.opt_seed)
+		srand(app.opt_seed);
+	else
+		srand(clock());
+
+	// register timer handler
+	if (ctx.opt_timer) {
+		signal(SIGALRM, sigalrmHandler);
+		::alarm(ctx.opt_timer);
+	}
+
+	return app.main(outputFilename, inputFilename);
+}
@@ -0,0 +1,223 @@
+#ifndef _LOOKUPCACHE_H
+#define _LOOKUPCACHE_H
+
+/*
+ * @date 2026-10-17 22:31:04
+ *
+ * `lookupcache.h` caches associative lookups of candidates by their direct footprint.
+ *
+ * The generator emits many structurally different candidates that evaluate to the same footprint.
+ * Each of them pays a full `lookupImprintAssociative()` of up to `numAssociativeRow()` evaluations.
+ * The result of an associative lookup only depends on the footprint of the candidate with the identity transform (tid=0),
+ * so it can be remembered and found again with one `eval()` and one probe.
+ *
+ * The cache is direct mapped, bounded and single threaded. Pipeline workers each have their own.
+ *
+ * Only hits are cached. Imprints are only ever added during generation, so a found `sid`/`tid` stays valid.
+ * A miss can become a hit when a signature is added, caching it would be wrong.
+ * Clear the cache when imprints are rebuilt because that renumbers signatures.
+ */
+
+/*
+ *	This file is part of Untangle, Information in fractal structures.
+ *	Copyright (C) 2017-2026, xyzzy@rockingship.org
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "context.h"
+#include "database.h"
+#include "datadef.h"
+#include "tinytree.h"
+
+/// @constant {number} LOOKUPCACHE_DEFAULT - Default number of cache entries
+#define LOOKUPCACHE_DEFAULT (1 << 16)
+
+/**
+ * @date 2026-10-17 22:31:04
+ *
+ * Direct mapped cache of associative lookups
+ *
+ * @typedef {object} lookupCache_t
+ */
+struct lookupCache_t {
+
+	/**
+	 * @date 2026-10-17 22:31:04
+	 *
+	 * Cache entry, `sid` zero if empty
+	 *
+	 * @typedef {object} entry_t
+	 */
+	struct entry_t {
+		/// @var {footprint_t} footprint with identity transform
+		footprint_t footprint;
+		/// @var {number} signature id
+		uint32_t    sid;
+		/// @var {number} transform id
+		uint32_t    tid;
+		/// @var {number} need 16 byte alignment for SSE
+		uint32_t    filler16[2];
+	};
+
+	/// @var {context_t} I/O context
+	context_t &ctx;
+	/// @var {number} number of entries, power of 2
+	unsigned  numEntry;
+	/// @var {entry_t[]} entries
+	entry_t   *pEntries;
+	/// @var {number} lookups answered from cache
+	uint64_t  cntHit;
+	/// @var {number} lookups that needed the associative index
+	uint64_t  cntMiss;
+
+	/**
+	 * @date 2026-10-17 22:31:04
+	 *
+	 * Constructor
+	 *
+	 * @param {context_t} ctx - I/O context
+	 * @param {number} numEntry - number of entries, rounded up to a power of 2. Zero disables caching
+	 */
+	lookupCache_t(context_t &ctx, unsigned numEntry) : ctx(ctx) {
+		this->numEntry = 0;
+		this->pEntries = NULL;
+		this->cntHit   = 0;
+		this->cntMiss  = 0;
+
+		if (numEntry) {
+			this->numEntry = 1;
+			while (this->numEntry < numEntry)
+				this->numEntry <<= 1;
+
+			this->pEntries = (entry_t *) ctx.myAlloc("lookupCache_t::pEntries", this->numEntry, sizeof(*this->pEntries));
+		}
+	}
+
+	/**
+	 * Release resources
+	 */
+	~lookupCache_t() {
+		if (pEntries)
+			ctx.myFree("lookupCache_t::pEntries", pEntries);
+	}
+
+	/**
+	 * @date 2026-10-17 22:31:04
+	 *
+	 * Forget all entries
+	 */
+	void clear(void) {
+		if (pEntries)
+			::memset(pEntries, 0, numEntry * sizeof(*pEntries));
+	}
+
+	/**
+	 * @date 2026-10-17 22:31:04
+	 *
+	 * Evaluate the tree with the identity transform and locate its entry
+	 *
+	 * @param {tinyTree_t} pTree - Tree containg expression
+	 * @param {footprint_t[]} pIdentity - evaluator row of the identity transform (modified)
+	 * @param {footprint_t} pKey - (output) footprint
+	 * @return {entry_t} entry for footprint, test `sid` and `footprint` for a hit
+	 */
+	inline entry_t *probe(const tinyTree_t *pTree, footprint_t *pIdentity, footprint_t *pKey) const {
+		pTree->eval(pIdentity);
+		*pKey = pIdentity[pTree->root];
+
+		return pEntries + (pKey->crc32() & (numEntry - 1));
+	}
+
+	/**
+	 * @date 2026-10-17 22:31:04
+	 *
+	 * Cached `database_t::lookupImprintAssociative()`
+	 * Forward evaluator row 0 is the identity transform.
+	 *
+	 * @param {database_t} pStore - database
+	 * @param {tinyTree_t} pTree - Tree containg expression
+	 * @param {footprint_t[]} pFwdEvaluator - Evaluator with forward transforms (modified)
+	 * @param {footprint_t[]} RevEvaluator - Evaluator with reverse transforms (modified)
+	 * @param {number} sid - found structure id
+	 * @param {number} tid - found transform id
+	 * @return {boolean} - `true` if found, `false` if not.
+	 */
+	inline bool lookupImprintAssociative(database_t *pStore, const tinyTree_t *pTree, footprint_t *pFwdEvaluator, footprint_t *pRevEvaluator, unsigned *sid, unsigned *tid) {
+		if (!pEntries)
+			return pStore->lookupImprintAssociative(pTree, pFwdEvaluator, pRevEvaluator, sid, tid);
+
+		footprint_t key;
+		entry_t     *pEntry = probe(pTree, pFwdEvaluator, &key);
+
+		if (pEntry->sid && pEntry->footprint.equals(key)) {
+			cntHit++;
+			*sid = pEntry->sid;
+			*tid = pEntry->tid;
+			return true;
+		}
+
+		cntMiss++;
+		if (!pStore->lookupImprintAssociative(pTree, pFwdEvaluator, pRevEvaluator, sid, tid))
+			return false;
+
+		pEntry->footprint = key;
+		pEntry->sid       = *sid;
+		pEntry->tid       = *tid;
+		return true;
+	}
+
+	/**
+	 * @date 2026-10-17 22:31:04
+	 *
+	 * Cached `database_t::lookupImprintAssociativeCompact()`
+	 * Compact evaluator row 0 is the identity transform in both interleave modes.
+	 *
+	 * @param {database_t} pStore - database
+	 * @param {tinyTree_t} pTree - Tree containg expression
+	 * @param {footprint_t[]} pEvaluator - Compact evaluator (modified)
+	 * @param {number} sid - found structure id
+	 * @param {number} tid - found transform id
+	 * @param {number} cntHash - (modified) caller private `ctx.cntHash`
+	 * @param {number} cntCompare - (modified) caller private `ctx.cntCompare`
+	 * @return {boolean} - `true` if found, `false` if not.
+	 */
+	inline bool lookupImprintAssociativeCompact(const database_t *pStore, const tinyTree_t *pTree, footprint_t *pEvaluator, unsigned *sid, unsigned *tid, uint64_t &cntHash, uint64_t &cntCompare) {
+		if (!pEntries)
+			return pStore->lookupImprintAssociativeCompact(pTree, pEvaluator, sid, tid, cntHash, cntCompare);
+
+		footprint_t key;
+		entry_t     *pEntry = probe(pTree, pEvaluator, &key);
+
+		if (pEntry->sid && pEntry->footprint.equals(key)) {
+			cntHit++;
+			*sid = pEntry->sid;
+			*tid = pEntry->tid;
+			return true;
+		}
+
+		cntMiss++;
+		if (!pStore->lookupImprintAssociativeCompact(pTree, pEvaluator, sid, tid, cntHash, cntCompare))
+			return false;
+
+		pEntry->footprint = key;
+		pEntry->sid       = *sid;
+		pEntry->tid       = *tid;
+		return true;
+	}
+};
+
+#endif
@@ -0,0 +1,562 @@
+#ifndef _NORMPROFILE_H
+#define _NORMPROFILE_H
+
+/*
+ * @date 2026-10-17 22:58:27
+ *
+ * `normprofile.h` aggregates what `bexplain` shows for a single call over a whole build.
+ *
+ * Each `baseTree_t::normaliseNode()` call is attributed to the stage that produced its result:
+ * level-1/level-2 folding, a rewrite response, a level-3 cascade merge or `basicNode()` finding or creating a node.
+ * Rewrites are also attributed to the `rewriteData[]` entry (rule) that triggered them.
+ * Probes of the node index and of the rewrite lookup are counted by outcome and length.
+ *
+ * Time is read with the `perfRegistry_t` clock for one in `2^NORMPROFILE_SAMPLEBITS` calls and is inclusive of recursion.
+ * Unsampled calls cost one increment per hook.
+ *
+ * Counters hang off the per-thread `perfSlot_t` and are reported by `perfDump()` as `"normprofile"`,
+ * stages and rules ranked by estimated nanoseconds.
+ *
+ * Part of `./configure --enable-perfcount`, the hooks can be left out with `-DENABLE_NORMPROFILE=0`.
+ * When disabled the `NORMPROFILE_*()` hooks expand to nothing.
+ *
+ * Included by `basetree.h` after `rewritedata.h`, rule kinds are decoded with `REWRITEMASK_*`.
+ */
+
+/*
+ *	This file is part of Untangle, Information in fractal structures.
+ *	Copyright (C) 2017-2026, xyzzy@rockingship.org
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+#include "context.h"
+
+#ifndef ENABLE_NORMPROFILE
+#define ENABLE_NORMPROFILE ENABLE_PERFCOUNT
+#endif
+
+#if ENABLE_NORMPROFILE && !ENABLE_PERFCOUNT
+#error "ENABLE_NORMPROFILE requires ENABLE_PERFCOUNT"
+#endif
+
+/**
+ * Time is measured for one in `2^NORMPROFILE_SAMPLEBITS` calls
+ *
+ * @constant {number} NORMPROFILE_SAMPLEBITS
+ */
+#ifndef NORMPROFILE_SAMPLEBITS
+#define NORMPROFILE_SAMPLEBITS 4
+#endif
+
+/**
+ * Rule table has `2^NORMPROFILE_RULEBITS` entries per thread. Rules beyond 3/4 full are counted as `"otherRules"`
+ *
+ * @constant {number} NORMPROFILE_RULEBITS
+ */
+#ifndef NORMPROFILE_RULEBITS
+#define NORMPROFILE_RULEBITS 16
+#endif
+
+/**
+ * Number of rules in the report
+ *
+ * @constant {number} NORMPROFILE_TOPRULES
+ */
+#ifndef NORMPROFILE_TOPRULES
+#define NORMPROFILE_TOPRULES 32
+#endif
+
+/**
+ * Probe lengths are histogrammed in power-of-2 buckets: 1, 2-3, 4-7, ... 128+
+ *
+ * @constant {number} NORMPROFILE_PROBEBUCKETS
+ */
+#define NORMPROFILE_PROBEBUCKETS 8
+
+/*
+ * @date 2026-10-17 22:58:27
+ *
+ * Stage that produced the result of `normaliseNode()`. Keep in sync with `stageNames[]`
+ */
+enum {
+	// @formatter:off
+	NORMPROFILE_LEVEL1 = 0,         // level-1 folding
+	NORMPROFILE_LEVEL2,             // level-2 folding
+	NORMPROFILE_COLLAPSE,           // rewrite collapsed to a slot
+	NORMPROFILE_ORDER,              // rewrite with available components
+	NORMPROFILE_TREE,               // destructive rewrite
+	NORMPROFILE_OR,                 // level-3 OR cascade
+	NORMPROFILE_NE,                 // level-3 NE cascade
+	NORMPROFILE_AND,                // level-3 AND cascade
+	NORMPROFILE_BASIC,              // `basicNode()` found existing node
+	NORMPROFILE_BASICNEW,           // `basicNode()` created node
+	NORMPROFILE_LAST
+	// @formatter:on
+};
+
+/*
+ * @date 2026-10-17 22:58:27
+ *
+ * Probe outcomes. Keep in sync with `probeNames[]`
+ */
+enum {
+	// @formatter:off
+	NORMPROFILE_PROBE_FOUND = 0,    // `lookupNode()` found node, steps are index probes
+	NORMPROFILE_PROBE_MISSING,      // `lookupNode()` found empty entry
+	NORMPROFILE_PROBE_COMPACTHIT,   // `lookupRewrite()` answered by `rewriteCompact`
+	NORMPROFILE_PROBE_COMPACTMISS,  // `lookupRewrite()` missed `rewriteCompact`, steps are state table transitions
+	NORMPROFILE_PROBE_WALK,         // `lookupRewrite()` without compact engine
+	NORMPROFILE_PROBE_LAST
+	// @formatter:on
+};
+
+#if ENABLE_NORMPROFILE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct normProfileScope_t;
+
+/*
+ * @date 2026-10-17 22:58:27
+ *
+ * Counters of a single thread
+ */
+struct normProfileSlot_t {
+	struct stage_t {
+		/// @var {number} number of calls
+		uint64_t calls;
+		/// @var {number} number of timed calls
+		uint64_t samples;
+		/// @var {number} nanoseconds spent in timed calls
+		uint64_t nsec;
+		/// @var {number} nodes created while stage was innermost
+		uint64_t newNodes;
+	};
+
+	struct probe_t {
+		/// @var {number} number of probes
+		uint64_t calls;
+		/// @var {number} total length
+		uint64_t steps;
+		/// @var {number[]} length histogram
+		uint64_t histogram[NORMPROFILE_PROBEBUCKETS];
+	};
+
+	/// @var {object} rule, `index` zero if empty
+	struct rule_t {
+		uint32_t index;
+		uint32_t data;
+		uint64_t calls;
+		uint64_t samples;
+		uint64_t nsec;
+	};
+
+	/// @var {normProfileScope_t} innermost `normaliseNode()`
+	normProfileScope_t *pScope;
+	/// @var {number} sample counter of stages
+	uint64_t           numScope;
+	/// @var {number} sample counter of rules
+	uint64_t           numRule;
+	/// @var {stage_t[]} stages
+	stage_t            stages[NORMPROFILE_LAST];
+	/// @var {probe_t[]} probes
+	probe_t            probes[NORMPROFILE_PROBE_LAST];
+	/// @var {number} number of rules in table
+	uint32_t           numRuleEntry;
+	/// @var {rule_t} rules that did not fit
+	rule_t             otherRules;
+	/// @var {rule_t[]} open addressing on `index`
+	rule_t             rules[1 << NORMPROFILE_RULEBITS];
+
+	/*
+	 * Locate entry of rule, `otherRules` when table full
+	 */
+	inline rule_t *lookupRule(uint32_t index, uint32_t data) {
+		uint32_t ix = (index * 0x9e3779b1U) >> (32 - NORMPROFILE_RULEBITS);
+
+		for (;;) {
+			rule_t *pRule = rules + ix;
+
+			if (pRule->index == index)
+				return pRule;
+
+			if (pRule->index == 0) {
+				if (numRuleEntry >= (3U << NORMPROFILE_RULEBITS) / 4)
+					return &otherRules;
+
+				numRuleEntry++;
+				pRule->index = index;
+				pRule->data  = data;
+				return pRule;
+			}
+
+			ix = (ix + 1) & ((1 << NORMPROFILE_RULEBITS) - 1);
+		}
+	}
+};
+
+/*
+ * @date 2026-10-17 22:58:27
+ *
+ * Per-thread profile, attached to the `perfRegistry_t` slot of the thread
+ */
+struct normProfile_t {
+
+	/*
+	 * Profile of the calling thread, allocated on first use.
+	 * `NULL` for threads beyond `PERFCOUNT_MAXTHREADS`, they are not profiled.
+	 */
+	static inline normProfileSlot_t *slot(void) {
+		perfSlot_t *pPerf = perfRegistry_t::slot();
+
+		if (__builtin_expect(pPerf->pNormProfile == NULL, 0))
+			claim(pPerf);
+		return pPerf->pNormProfile;
+	}
+
+	static void claim(perfSlot_t *pPerf) {
+		if (!perfRegistry_t::isRegistered(pPerf))
+			return;
+
+		normProfileSlot_t *pSlot = (normProfileSlot_t *) ::calloc(1, sizeof(normProfileSlot_t));
+		if (pSlot == NULL) {
+			fprintf(stderr, "{\"error\":\"calloc() returned NULL\",\"where\":\"%s:%s:%d\"}\n", __FUNCTION__, __FILE__, __LINE__);
+			exit(1);
+		}
+
+		// publish contents before `perfDump()` can find it
+		__sync_synchronize();
+		pPerf->pNormProfile = pSlot;
+		perfRegistry_t::get().appendHook = appendReport;
+	}
+
+	/*
+	 * Histogram bucket of probe length
+	 */
+	static inline unsigned bucket(uint64_t steps) {
+		unsigned b = steps > 1 ? 63 - __builtin_clzll(steps) : 0;
+		return b < NORMPROFILE_PROBEBUCKETS ? b : NORMPROFILE_PROBEBUCKETS - 1;
+	}
+
+	static inline uint64_t estimate(uint64_t nsec, uint64_t samples, uint64_t calls) {
+		return samples ? nsec / samples * calls : 0;
+	}
+
+	static unsigned appendReport(char *buffer, unsigned len, unsigned size);
+};
+
+/*
+ * @date 2026-10-17 22:58:27
+ *
+ * One `normaliseNode()` call. Attributed to the last stage it entered.
+ */
+struct normProfileScope_t {
+	normProfileSlot_t  *pSlot;
+	normProfileScope_t *pPrev;
+	unsigned           stage;
+	uint32_t           newNodes;
+	uint64_t           start;
+
+	inline normProfileScope_t() : pSlot(normProfile_t::slot()), pPrev(NULL), stage(NORMPROFILE_LEVEL1), newNodes(0), start(0) {
+		if (__builtin_expect(pSlot == NULL, 0))
+			return;
+
+		pPrev = pSlot->pScope;
+		pSlot->pScope = this;
+		if (__builtin_expect((pSlot->numScope++ & ((1 << NORMPROFILE_SAMPLEBITS) - 1)) == 0, 0))
+			start = perfRegistry_t::now();
+	}
+
+	inline ~normProfileScope_t() {
+		if (__builtin_expect(pSlot == NULL, 0))
+			return;
+
+		pSlot->pScope = pPrev;
+
+		if (stage == NORMPROFILE_BASIC && newNodes)
+			stage = NORMPROFILE_BASICNEW;
+
+		normProfileSlot_t::stage_t *pStage = pSlot->stages + stage;
+
+		pStage->calls++;
+		pStage->newNodes += newNodes;
+		if (__builtin_expect(start != 0, 0)) {
+			pStage->nsec += perfRegistry_t::now() - start;
+			pStage->samples++;
+		}
+	}
+};
+
+/*
+ * @date 2026-10-17 22:58:27
+ *
+ * One rewrite response, inclusive of the `normaliseNode()` calls it makes
+ */
+struct normProfileRule_t {
+	normProfileSlot_t::rule_t *pRule;
+	uint64_t                  start;
+
+	inline normProfileRule_t(uint32_t index, uint32_t data) : pRule(NULL), start(0) {
+		normProfileSlot_t *pSlot = normProfile_t::slot();
+		if (__builtin_expect(pSlot == NULL, 0))
+			return;
+
+		pRule = pSlot->lookupRule(index, data);
+		pRule->calls++;
+		if (__builtin_expect((pSlot->numRule++ & ((1 << NORMPROFILE_SAMPLEBITS) - 1)) == 0, 0))
+			start = perfRegistry_t::now();
+	}
+
+	inline ~normProfileRule_t() {
+		if (__builtin_expect(start != 0, 0)) {
+			pRule->nsec += perfRegistry_t::now() - start;
+			pRule->samples++;
+		}
+	}
+};
+
+/*
+ * Set the stage of the innermost `normaliseNode()`
+ */
+static inline void normProfileStage(unsigned stage) {
+	normProfileSlot_t *pSlot = normProfile_t::slot();
+	if (pSlot && pSlot->pScope)
+		pSlot->pScope->stage = stage;
+}
+
+/*
+ * Count a created node against the innermost `normaliseNode()`
+ */
+static inline void normProfileNewNode(void) {
+	normProfileSlot_t *pSlot = normProfile_t::slot();
+	if (pSlot && pSlot->pScope)
+		pSlot->pScope->newNodes++;
+}
+
+static inline void normProfileProbe(unsigned id, uint64_t steps) {
+	normProfileSlot_t *pSlot = normProfile_t::slot();
+	if (pSlot == NULL)
+		return;
+
+	normProfileSlot_t::probe_t *pProbe = pSlot->probes + id;
+
+	pProbe->calls++;
+	pProbe->steps += steps;
+	pProbe->histogram[normProfile_t::bucket(steps)]++;
+}
+
+/*
+ * @date 2026-10-17 23:04:51
+ *
+ * Append `"normprofile"` to the `perfDump()` line, stages and rules ranked by estimated nanoseconds.
+ * Called through `perfRegistry_t::appendHook` and may run in a signal handler, only formats with `perfAppend*()`.
+ * Threads are merged into static storage without locking, values are indicative.
+ */
+inline unsigned normProfile_t::appendReport(char *buffer, unsigned len, unsigned size) {
+	static const char *stageNames[NORMPROFILE_LAST] = {
+		"level1", "level2", "rewriteCollapse", "rewriteOrder", "rewriteTree",
+		"cascadeOR", "cascadeNE", "cascadeAND", "basic", "basicNew"
+	};
+	static const char *probeNames[NORMPROFILE_PROBE_LAST] = {
+		"lookupNodeFound", "lookupNodeMissing", "rewriteCompactHit", "rewriteCompactMiss", "rewriteWalk"
+	};
+	static normProfileSlot_t total;
+
+	perfRegistry_t &r = perfRegistry_t::get();
+	unsigned numSlot = r.numSlot < PERFCOUNT_MAXTHREADS ? r.numSlot : PERFCOUNT_MAXTHREADS;
+
+	/*
+	 * Merge threads
+	 */
+	::memset(&total, 0, sizeof(total));
+
+	for (unsigned iSlot = 0; iSlot < numSlot; iSlot++) {
+		const normProfileSlot_t *pSlot = r.slots[iSlot].pNormProfile;
+		if (pSlot == NULL)
+			continue;
+
+		for (unsigned id = 0; id < NORMPROFILE_LAST; id++) {
+			total.stages[id].calls += pSlot->stages[id].calls;
+			total.stages[id].samples += pSlot->stages[id].samples;
+			total.stages[id].nsec += pSlot->stages[id].nsec;
+			total.stages[id].newNodes += pSlot->stages[id].newNodes;
+		}
+		for (unsigned id = 0; id < NORMPROFILE_PROBE_LAST; id++) {
+			total.probes[id].calls += pSlot->probes[id].calls;
+			total.probes[id].steps += pSlot->probes[id].steps;
+			for (unsigned b = 0; b < NORMPROFILE_PROBEBUCKETS; b++)
+				total.probes[id].histogram[b] += pSlot->probes[id].histogram[b];
+		}
+		for (unsigned ix = 0; ix < (1 << NORMPROFILE_RULEBITS); ix++) {
+			const normProfileSlot_t::rule_t *pRule = pSlot->rules + ix;
+			if (pRule->index == 0)
+				continue;
+
+			normProfileSlot_t::rule_t *pInto = total.lookupRule(pRule->index, pRule->data);
+			pInto->calls += pRule->calls;
+			pInto->samples += pRule->samples;
+			pInto->nsec += pRule->nsec;
+		}
+		total.otherRules.calls += pSlot->otherRules.calls;
+		total.otherRules.samples += pSlot->otherRules.samples;
+		total.otherRules.nsec += pSlot->otherRules.nsec;
+	}
+
+	len = context_t::perfAppendString(buffer, len, size, ",\"normprofile\":{\"sampleBits\":");
+	len = context_t::perfAppendNumber(buffer, len, size, NORMPROFILE_SAMPLEBITS);
+
+	/*
+	 * Stages, insertion sort on estimate
+	 */
+	unsigned order[NORMPROFILE_LAST];
+	uint64_t estStage[NORMPROFILE_LAST];
+
+	for (unsigned id = 0; id < NORMPROFILE_LAST; id++) {
+		uint64_t est = estimate(total.stages[id].nsec, total.stages[id].samples, total.stages[id].calls);
+		unsigned j;
+
+		for (j = id; j > 0 && estStage[j - 1] < est; j--) {
+			order[j]    = order[j - 1];
+			estStage[j] = estStage[j - 1];
+		}
+		order[j]    = id;
+		estStage[j] = est;
+	}
+
+	len = context_t::perfAppendString(buffer, len, size, ",\"stages\":[");
+	for (unsigned j = 0; j < NORMPROFILE_LAST; j++) {
+		const normProfileSlot_t::stage_t *pStage = total.stages + order[j];
+
+		len = context_t::perfAppendString(buffer, len, size, j ? ",{\"stage\":\"" : "{\"stage\":\"");
+		len = context_t::perfAppendString(buffer, len, size, stageNames[order[j]]);
+		len = context_t::perfAppendString(buffer, len, size, "\",\"calls\":");
+		len = context_t::perfAppendNumber(buffer, len, size, pStage->calls);
+		len = context_t::perfAppendString(buffer, len, size, ",\"newNodes\":");
+		len = context_t::perfAppendNumber(buffer, len, size, pStage->newNodes);
+		len = context_t::perfAppendString(buffer, len, size, ",\"samples\":");
+		len = context_t::perfAppendNumber(buffer, len, size, pStage->samples);
+		len = context_t::perfAppendString(buffer, len, size, ",\"nsec\":");
+		len = context_t::perfAppendNumber(buffer, len, size, pStage->nsec);
+		len = context_t::perfAppendString(buffer, len, size, ",\"estNsec\":");
+		len = context_t::perfAppendNumber(buffer, len, size, estStage[j]);
+		len = context_t::perfAppendString(buffer, len, size, "}");
+	}
+
+	len = context_t::perfAppendString(buffer, len, size, "],\"probes\":[");
+	for (unsigned id = 0; id < NORMPROFILE_PROBE_LAST; id++) {
+		const normProfileSlot_t::probe_t *pProbe = total.probes + id;
+
+		len = context_t::perfAppendString(buffer, len, size, id ? ",{\"probe\":\"" : "{\"probe\":\"");
+		len = context_t::perfAppendString(buffer, len, size, probeNames[id]);
+		len = context_t::perfAppendString(buffer, len, size, "\",\"calls\":");
+		len = context_t::perfAppendNumber(buffer, len, size, pProbe->calls);
+		len = context_t::perfAppendString(buffer, len, size, ",\"steps\":");
+		len = context_t::perfAppendNumber(buffer, len, size, pProbe->steps);
+		len = context_t::perfAppendString(buffer, len, size, ",\"histogram\":[");
+		for (unsigned b = 0; b < NORMPROFILE_PROBEBUCKETS; b++) {
+			if (b)
+				len = context_t::perfAppendString(buffer, len, size, ",");
+			len = context_t::perfAppendNumber(buffer, len, size, pProbe->histogram[b]);
+		}
+		len = context_t::perfAppendString(buffer, len, size, "]}");
+	}
+
+	/*
+	 * Rules, keep the top `NORMPROFILE_TOPRULES` sorted on estimate
+	 */
+	const normProfileSlot_t::rule_t *pTop[NORMPROFILE_TOPRULES];
+	uint64_t                        estTop[NORMPROFILE_TOPRULES];
+	unsigned                        numTop = 0;
+
+	for (unsigned ix = 0; ix < (1 << NORMPROFILE_RULEBITS); ix++) {
+		const normProfileSlot_t::rule_t *pRule = total.rules + ix;
+		if (pRule->index == 0)
+			continue;
+
+		uint64_t est = estimate(pRule->nsec, pRule->samples, pRule->calls);
+		if (numTop == NORMPROFILE_TOPRULES && est <= estTop[numTop - 1])
+			continue;
+
+		unsigned j = (numTop < NORMPROFILE_TOPRULES) ? numTop++ : numTop - 1;
+		for (; j > 0 && estTop[j - 1] < est; j--) {
+			pTop[j]   = pTop[j - 1];
+			estTop[j] = estTop[j - 1];
+		}
+		pTop[j]   = pRule;
+		estTop[j] = est;
+	}
+
+	len = context_t::perfAppendString(buffer, len, size, "],\"numRules\":");
+	len = context_t::perfAppendNumber(buffer, len, size, total.numRuleEntry);
+	len = context_t::perfAppendString(buffer, len, size, ",\"otherRules\":{\"calls\":");
+	len = context_t::perfAppendNumber(buffer, len, size, total.otherRules.calls);
+	len = context_t::perfAppendString(buffer, len, size, ",\"estNsec\":");
+	len = context_t::perfAppendNumber(buffer, len, size, estimate(total.otherRules.nsec, total.otherRules.samples, total.otherRules.calls));
+	len = context_t::perfAppendString(buffer, len, size, "},\"rules\":[");
+
+	for (unsigned j = 0; j < numTop; j++) {
+		const normProfileSlot_t::rule_t *pRule = pTop[j];
+		uint32_t                        data   = pRule->data;
+		const char                      *kind;
+
+		if (data & REWRITEMASK_TREE)
+			kind = "tree";
+		else if (data & REWRITEMASK_COLLAPSE)
+			kind = "collapse";
+		else if (data & REWRITEMASK_FOUND)
+			kind = "found";
+		else
+			kind = "order";
+
+		len = context_t::perfAppendString(buffer, len, size, j ? ",{\"index\":" : "{\"index\":");
+		len = context_t::perfAppendNumber(buffer, len, size, pRule->index);
+		len = context_t::perfAppendString(buffer, len, size, ",\"data\":");
+		len = context_t::perfAppendNumber(buffer, len, size, data);
+		len = context_t::perfAppendString(buffer, len, size, ",\"kind\":\"");
+		len = context_t::perfAppendString(buffer, len, size, kind);
+		len = context_t::perfAppendString(buffer, len, size, "\",\"power\":");
+		len = context_t::perfAppendNumber(buffer, len, size, (data >> REWRITEFLAG_POWER) & 0xf);
+		len = context_t::perfAppendString(buffer, len, size, ",\"calls\":");
+		len = context_t::perfAppendNumber(buffer, len, size, pRule->calls);
+		len = context_t::perfAppendString(buffer, len, size, ",\"samples\":");
+		len = context_t::perfAppendNumber(buffer, len, size, pRule->samples);
+		len = context_t::perfAppendString(buffer, len, size, ",\"estNsec\":");
+		len = context_t::perfAppendNumber(buffer, len, size, estTop[j]);
+		len = context_t::perfAppendString(buffer, len, size, "}");
+	}
+
+	return context_t::perfAppendString(buffer, len, size, "]}");
+}
+
+#define NORMPROFILE_SCOPE() normProfileScope_t normProfileScope
+#define NORMPROFILE_STAGE(ID) do { normProfileStage(ID); } while (0)
+#define NORMPROFILE_NEWNODE() do { normProfileNewNode(); } while (0)
+#define NORMPROFILE_RULE(INDEX, DATA) normProfileRule_t normProfileRule(INDEX, DATA)
+#define NORMPROFILE_PROBE(ID, STEPS) do { normProfileProbe(ID, STEPS); } while (0)
+
+#else
+
+#define NORMPROFILE_SCOPE() do { } while (0)
+#define NORMPROFILE_STAGE(ID) do { } while (0)
+#define NORMPROFILE_NEWNODE() do { } while (0)
+#define NORMPROFILE_RULE(INDEX, DATA) do { } while (0)
+#define NORMPROFILE_PROBE(ID, STEPS) do { (void) (STEPS); } while (0)
+
+#endif
+
+#endif
@@ -0,0 +1,394 @@
+#ifndef _PIPELINE_H
+#define _PIPELINE_H
+
+/*
+ * @date 2026-10-17 14:45:12
+ *
+ * `pipeline.h` overlap candidate enumeration with associative lookups.
+ *
+ * `generatorTree_t::generateTrees()` enumerates about 150M candidates/s, associative lookups run at about 1.5M/s.
+ * In pipelined mode the generator callback only packs candidates into a batch.
+ * A full batch is handed to a pool of worker threads that reconstruct the tree and perform the
+ * (read-only) `lookupImprintAssociative()` while the generator fills the next batch.
+ *
+ * Results are committed by the generator thread in candidate order, so database output is identical to a serial run.
+ * The database is never written while workers are active: a batch is only committed after workers finished it,
+ * and the next batch is dispatched after the commit.
+ *
+ * Lookups are speculative. Imprints are only ever added, so a found `sid` stays valid.
+ * A miss is only valid if no imprints were added since the batch was dispatched, otherwise the committer repeats it.
+ *
+ * Flow:
+ *
+ *   callback:  pPipeline->push()
+ *              if full: wait() + commit previous batch + dispatch()
+ *   at end:    wait() + commit + dispatch() + wait() + commit
+ */
+
+/*
+ *	This file is part of Untangle, Information in fractal structures.
+ *	Copyright (C) 2017-2026, xyzzy@rockingship.org
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <string.h>
+#include "context.h"
+#include "database.h"
+#include "lookupcache.h"
+#include "tinytree.h"
+
+/**
+ * @date 2026-10-17 14:48:30
+ *
+ * Batched candidate pipeline with worker pool
+ *
+ * @typedef {object} candidatePipeline_t
+ */
+struct candidatePipeline_t {
+
+	enum {
+		/// @constant {number} candidates claimed per worker step
+		CHUNKSIZE = 64,
+	};
+
+	/**
+	 * @date 2026-10-17 14:49:55
+	 *
+	 * Packed candidate and speculative lookup result
+	 *
+	 * @typedef {object} candidate_t
+	 */
+	struct candidate_t {
+		/// @var {number} `ctx.progress` when generated
+		uint64_t progress;
+		/// @var {number} speculative signature id, zero if not found
+		uint32_t sid;
+		/// @var {number} speculative transform id
+		uint32_t tid;
+		/// @var {number} arguments for `foundTree()`
+		uint8_t  numPlaceholder;
+		uint8_t  numEndpoint;
+		uint8_t  numBackRef;
+		/// @var {string} candidate notation
+		char     name[tinyTree_t::TINYTREE_NAMELEN + 1];
+	};
+
+	/**
+	 * Worker thread context
+	 */
+	struct worker_t {
+		/// @var {candidatePipeline_t} owner
+		candidatePipeline_t *pPipeline;
+		/// @var {pthread_t} thread handle
+		pthread_t           thread;
+		/// @var {footprint_t[]} private compact evaluator
+		footprint_t         *pEvaluator;
+		/// @var {lookupCache_t} private lookup cache
+		lookupCache_t       *pCache;
+		/// @var {number} private `ctx.cntHash`/`ctx.cntCompare`, merged by `wait()`
+		uint64_t            cntHash;
+		uint64_t            cntCompare;
+	};
+
+	/// @var {context_t} I/O context
+	context_t  &ctx;
+	/// @var {database_t} database to lookup
+	database_t *pStore;
+
+	/// @var {number} number of candidates per batch
+	unsigned   batchSize;
+	/// @var {candidate_t[2][]} batch buffers, one filling and one in-flight
+	candidate_t *pBatch[2];
+	/// @var {number} batch currently filling
+	unsigned   iFill;
+	/// @var {number} number of candidates in filling batch
+	unsigned   numFill;
+
+	/// @var {candidate_t[]} batch workers are processing
+	candidate_t *pWork;
+	/// @var {number} number of candidates in `pWork`
+	unsigned   numWork;
+	/// @var {number} next candidate to claim by workers
+	unsigned   nextWork;
+	/// @var {number} `pStore->numImprint` when `pWork` was dispatched
+	uint32_t   workNumImprint;
+
+	/// @var {number} number of workers
+	unsigned   numWorker;
+	/// @var {worker_t[]} worker pool
+	worker_t   *pWorkers;
+	/// @var {number} workers still busy with current batch
+	unsigned   numActive;
+	/// @var {number} incremented for every dispatched batch
+	unsigned   generation;
+	/// @var {boolean} workers should exit
+	bool       quit;
+
+	pthread_mutex_t mutex;
+	pthread_cond_t  condWork;
+	pthread_cond_t  condDone;
+
+	/**
+	 * @date 2026-10-17 14:55:02
+	 *
+	 * Constructor, start worker pool
+	 *
+	 * @param {context_t} ctx - I/O context
+	 * @param {database_t} pStore - database, imprint section must be complete
+	 * @param {number} numWorker - number of worker threads
+	 * @param {number} batchSize - candidates per batch
+	 * @param {number} cacheSize - entries of per-worker `lookupCache_t`, zero to disable
+	 */
+	candidatePipeline_t(context_t &ctx, database_t *pStore, unsigned numWorker, unsigned batchSize, unsigned cacheSize) : ctx(ctx), pStore(pStore) {
+		this->batchSize = batchSize;
+		this->numWorker = numWorker;
+
+		pBatch[0] = (candidate_t *) ctx.myAlloc("candidatePipeline_t::pBatch", batchSize, sizeof(*pBatch[0]));
+		pBatch[1] = (candidate_t *) ctx.myAlloc("candidatePipeline_t::pBatch", batchSize, sizeof(*pBatch[1]));
+		iFill      = 0;
+		numFill    = 0;
+
+		pWork          = NULL;
+		numWork        = 0;
+		nextWork       = 0;
+		workNumImprint = 0;
+		numActive      = 0;
+		generation     = 0;
+		quit           = false;
+
+		pthread_mutex_init(&mutex, NULL);
+		pthread_cond_init(&condWork, NULL);
+		pthread_cond_init(&condDone, NULL);
+
+		pWorkers = (worker_t *) ctx.myAlloc("candidatePipeline_t::pWorkers", numWorker, sizeof(*pWorkers));
+		for (unsigned iWorker = 0; iWorker < numWorker; iWorker++) {
+			worker_t *pWorker = pWorkers + iWorker;
+
+			pWorker->pPipeline  = this;
+			pWorker->pEvaluator = (footprint_t *) ctx.myAlloc("candidatePipeline_t::pEvaluator", pStore->numAssociativeRow() * tinyTree_t::TINYTREE_NEND, sizeof(footprint_t));
+			pStore->copyAssociativeEvaluator(pWorker->pEvaluator);
+			pWorker->pCache = new lookupCache_t(ctx, cacheSize);
+			pWorker->cntHash    = 0;
+			pWorker->cntCompare = 0;
+
+			int ret = pthread_create(&pWorker->thread, NULL, workerEntry, pWorker);
+			if (ret)
+				ctx.fatal("\n{\"error\":\"pthread_create() failed\",\"where\":\"%s:%s:%d\",\"return\":%d}\n",
+					  __FUNCTION__, __FILE__, __LINE__, ret);
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 14:58:41
+	 *
+	 * Stop worker pool and release resources
+	 */
+	~candidatePipeline_t() {
+		pthread_mutex_lock(&mutex);
+		while (numActive)
+			pthread_cond_wait(&condDone, &mutex);
+		quit = true;
+		pthread_cond_broadcast(&condWork);
+		pthread_mutex_unlock(&mutex);
+
+		for (unsigned iWorker = 0; iWorker < numWorker; iWorker++) {
+			pthread_join(pWorkers[iWorker].thread, NULL);
+			ctx.myFree("candidatePipeline_t::pEvaluator", pWorkers[iWorker].pEvaluator);
+			delete pWorkers[iWorker].pCache;
+		}
+
+		pthread_cond_destroy(&condDone);
+		pthread_cond_destroy(&condWork);
+		pthread_mutex_destroy(&mutex);
+
+		ctx.myFree("candidatePipeline_t::pWorkers", pWorkers);
+		ctx.myFree("candidatePipeline_t::pBatch", pBatch[1]);
+		ctx.myFree("candidatePipeline_t::pBatch", pBatch[0]);
+	}
+
+	/**
+	 * @date 2026-10-17 15:01:10
+	 *
+	 * Add candidate to filling batch
+	 *
+	 * @param {string} pName - tree notation/name
+	 * @param {number} numPlaceholder - number of unique endpoints/placeholders in tree
+	 * @param {number} numEndpoint - number of non-zero endpoints in tree
+	 * @param {number} numBackRef - number of back-references
+	 * @return {boolean} `true` if batch is full
+	 */
+	inline bool push(const char *pName, unsigned numPlaceholder, unsigned numEndpoint, unsigned numBackRef) {
+		assert(numFill < batchSize);
+
+		candidate_t *pCandidate = pBatch[iFill] + numFill++;
+
+		pCandidate->progress       = ctx.progress;
+		pCandidate->sid            = 0;
+		pCandidate->tid            = 0;
+		pCandidate->numPlaceholder = numPlaceholder;
+		pCandidate->numEndpoint    = numEndpoint;
+		pCandidate->numBackRef     = numBackRef;
+		::strcpy(pCandidate->name, pName);
+
+		return numFill >= batchSize;
+	}
+
+	/**
+	 * @date 2026-10-17 15:04:27
+	 *
+	 * Wait until workers finished the in-flight batch.
+	 * Returned batch should be committed before calling `dispatch()`, `workNumImprint` stays valid until then.
+	 * Worker lookup statistics are added to `ctx.cntHash`/`ctx.cntCompare`.
+	 *
+	 * @param {candidate_t[]} ppBatch - (output) finished batch
+	 * @param {number} pNumBatch - (output) number of candidates, zero if nothing was in-flight
+	 */
+	void wait(const candidate_t **ppBatch, unsigned *pNumBatch) {
+		pthread_mutex_lock(&mutex);
+		while (numActive)
+			pthread_cond_wait(&condDone, &mutex);
+		pthread_mutex_unlock(&mutex);
+
+		// workers are idle, merge their lookup statistics
+		for (unsigned iWorker = 0; iWorker < numWorker; iWorker++) {
+			ctx.cntHash += pWorkers[iWorker].cntHash;
+			ctx.cntCompare += pWorkers[iWorker].cntCompare;
+			pWorkers[iWorker].cntHash    = 0;
+			pWorkers[iWorker].cntCompare = 0;
+		}
+
+		*ppBatch   = pWork;
+		*pNumBatch = numWork;
+
+		pWork   = NULL;
+		numWork = 0;
+	}
+
+	/**
+	 * @date 2026-10-17 15:06:58
+	 *
+	 * Hand filling batch to workers and start filling the other.
+	 * Caller must have waited for the previous batch.
+	 */
+	void dispatch(void) {
+		assert(numActive == 0);
+
+		if (numFill == 0)
+			return;
+
+		pthread_mutex_lock(&mutex);
+		pWork          = pBatch[iFill];
+		numWork        = numFill;
+		nextWork       = 0;
+		workNumImprint = pStore->numImprint;
+		numActive      = numWorker;
+		generation++;
+		pthread_cond_broadcast(&condWork);
+		pthread_mutex_unlock(&mutex);
+
+		iFill ^= 1;
+		numFill = 0;
+	}
+
+	/**
+	 * @date 2026-10-17 15:09:33
+	 *
+	 * Test if speculative result of a committed candidate can be used
+	 *
+	 * @param {candidate_t} pCandidate - candidate from batch returned by `wait()`
+	 * @return {boolean} `true` if `sid`/`tid` are what a serial lookup would return now
+	 */
+	inline bool isValid(const candidate_t *pCandidate) const {
+		return pCandidate->sid != 0 || pStore->numImprint == workNumImprint;
+	}
+
+	/**
+	 * @date 2026-10-17 22:34:18
+	 *
+	 * Sum lookup cache statistics of all workers.
+	 * Only meaningful after `wait()`.
+	 *
+	 * @param {number} pCntHit - (output) lookups answered from cache
+	 * @param {number} pCntMiss - (output) lookups that needed the associative index
+	 */
+	void cacheStats(uint64_t *pCntHit, uint64_t *pCntMiss) const {
+		*pCntHit  = 0;
+		*pCntMiss = 0;
+
+		for (unsigned iWorker = 0; iWorker < numWorker; iWorker++) {
+			*pCntHit += pWorkers[iWorker].pCache->cntHit;
+			*pCntMiss += pWorkers[iWorker].pCache->cntMiss;
+		}
+	}
+
+	/**
+	 * @date 2026-10-17 15:12:04
+	 *
+	 * Worker main loop
+	 *
+	 * @param {worker_t} pWorker - worker context
+	 */
+	void workerLoop(worker_t *pWorker) {
+		tinyTree_t tree(ctx);
+		unsigned   seen = 0;
+
+		pthread_mutex_lock(&mutex);
+		for (;;) {
+			while (!quit && generation == seen)
+				pthread_cond_wait(&condWork, &mutex);
+			if (quit)
+				break;
+			seen = generation;
+			pthread_mutex_unlock(&mutex);
+
+			// claim chunks until batch exhausted
+			for (;;) {
+				unsigned iLo = __sync_fetch_and_add(&nextWork, CHUNKSIZE);
+				if (iLo >= numWork)
+					break;
+				unsigned iHi = iLo + CHUNKSIZE < numWork ? iLo + CHUNKSIZE : numWork;
+
+				for (unsigned i = iLo; i < iHi; i++) {
+					candidate_t *pCandidate = pWork + i;
+					unsigned    sid         = 0, tid = 0;
+
+					tree.loadStringFast(pCandidate->name);
+					pWorker->pCache->lookupImprintAssociativeCompact(pStore, &tree, pWorker->pEvaluator, &sid, &tid, pWorker->cntHash, pWorker->cntCompare);
+
+					pCandidate->sid = sid;
+					pCandidate->tid = tid;
+				}
+			}
+
+			pthread_mutex_lock(&mutex);
+			if (--numActive == 0)
+				pthread_cond_signal(&condDone);
+		}
+		pthread_mutex_unlock(&mutex);
+	}
+
+	/**
+	 * pthread entry point
+	 */
+	static void *workerEntry(void *arg) {
+		worker_t *pWorker = (worker_t *) arg;
+		pWorker->pPipeline->workerLoop(pWorker);
+		return NULL;
+	}
+};
+
+#endif
@@ -0,0 +1,346 @@
+//#pragma GCC optimize ("O0") // optimize on demand
+
+/*
+ * replaytrace.cc
+ * 	Replay a recorded stream of `normaliseNode()` calls into a fresh tree.
+ *
+ * 	Traces are created by the builders with `--trace=<file>`.
+ * 	Operands are remapped from recorded to replayed node id's, so any set of flags can be applied.
+ * 	Only the replay is timed, decoding happens before.
+ *
+ * 	When replayed with the flags of the recording, results should be identical.
+ */
+
+/*
+ *	This file is part of Untangle, Information in fractal structures.
+ *	Copyright (C) 2017-2026, xyzzy@rockingship.org
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <assert.h>
+#include <ctype.h>
+#include <getopt.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "rewritedata.h" // include before basetree.h
+#include "basetree.h"
+
+/*
+ * Resource context.
+ * Needs to be global to be accessible by signal handlers.
+ *
+ * @global {context_t} I/O context
+ */
+context_t ctx;
+
+/**
+ * @date 2026-10-17 18:12:26
+ *
+ * Main program logic as application context
+ * It is contained as an independent `struct` so it can be easily included into projects/code
+ */
+struct replaytraceContext_t {
+
+	/// @var {number} header flags
+	uint32_t opt_flags;
+	/// @var {number} --maxnode, Maximum number of nodes for `baseTree_t`, 0 for auto.
+	unsigned opt_maxNode;
+
+	/// @var {baseTraceHeader_t} trace header
+	baseTraceHeader_t header;
+	/// @var {number[]} decoded calls, 4 id's per call
+	uint32_t *pCalls;
+
+	replaytraceContext_t() {
+		opt_flags   = 0;
+		opt_maxNode = 0;
+		pCalls      = NULL;
+	}
+
+	/**
+	 * @date 2026-10-17 18:12:26
+	 *
+	 * Elapsed monotonic time
+	 *
+	 * @return {number} seconds
+	 */
+	static double now(void) {
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return ts.tv_sec + ts.tv_nsec * 1e-9;
+	}
+
+	/**
+	 * @date 2026-10-17 18:12:26
+	 *
+	 * Load and decode trace
+	 *
+	 * @param {string} fileName - trace file
+	 */
+	void loadTrace(const char *fileName) {
+		FILE *f = fopen(fileName, "r");
+		if (!f)
+			ctx.fatal("fopen(%s) returned: %m\n", fileName);
+
+		if (fread(&header, sizeof header, 1, f) != 1)
+			ctx.fatal("\n{\"error\":\"truncated header\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__, fileName);
+		if (header.magic != BASETRACE_MAGIC)
+			ctx.fatal("\n{\"error\":\"header mismatch\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"encountered\":\"%08x\",\"expected\":\"%08x\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__, fileName, header.magic, BASETRACE_MAGIC);
+
+		// encoded calls, padded for decoder overrun detection
+		uint8_t *pData = (uint8_t *) ctx.myAlloc("pData", header.numBytes + 1, sizeof(*pData));
+
+		if (header.numBytes && fread(pData, header.numBytes, 1, f) != 1)
+			ctx.fatal("\n{\"error\":\"truncated data\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__, fileName);
+
+		fclose(f);
+
+		pCalls = (uint32_t *) ctx.myAlloc("pCalls", header.numCalls * 4, sizeof(*pCalls));
+
+		const uint8_t *p   = pData;
+		uint32_t      base = header.nstart;
+
+		for (uint64_t iCall = 0; iCall < header.numCalls; iCall++) {
+			uint32_t *pCall = pCalls + iCall * 4;
+
+			for (unsigned j = 0; j < 4; j++) {
+				pCall[j] = baseTree_t::decodeTraceId(base, p);
+
+				if ((pCall[j] & ~IBIT) >= header.ncount || p > pData + header.numBytes)
+					ctx.fatal("\n{\"error\":\"corrupt data\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"call\":%lu}\n",
+						  __FUNCTION__, __FILE__, __LINE__, fileName, iCall);
+			}
+
+			// raise base, same as `baseTree_t::normaliseNode()`
+			for (unsigned j = 0; j < 4; j++) {
+				if ((pCall[j] & ~IBIT) >= base)
+					base = (pCall[j] & ~IBIT) + 1;
+			}
+		}
+
+		if (p != pData + header.numBytes)
+			ctx.fatal("\n{\"error\":\"data length mismatch\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"encountered\":%lu,\"expected\":%lu}\n",
+				  __FUNCTION__, __FILE__, __LINE__, fileName, (uint64_t) (p - pData), header.numBytes);
+
+		ctx.myFree("pData", pData);
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "[%s] Loaded %lu calls, %lu bytes, recorded with [%s]\n",
+				ctx.timeAsString(), header.numCalls, header.numBytes, ctx.flagsToText(header.magic_flags));
+	}
+
+	void main(const char *traceName) {
+		loadTrace(traceName);
+
+		// nodes can grow depending on flags
+		unsigned maxNodes = opt_maxNode;
+		if (maxNodes == 0)
+			maxNodes = header.ncount * 4 + 1000;
+
+		baseTree_t *pTree = new baseTree_t(ctx, header.kstart, header.ostart, header.estart, header.nstart, header.nstart/*numRoots*/, maxNodes, opt_flags);
+
+		/*
+		 * Map recorded id's to replayed id's.
+		 * Keys are identical, unmapped nodes are marked as `~0U`.
+		 * NOTE: `IBIT` can not be the marker, replaying with other flags may fold a node into the constant `~0`.
+		 */
+		uint32_t *pMap = (uint32_t *) ctx.myAlloc("pMap", header.ncount, sizeof(*pMap));
+
+		for (uint32_t iKey = 0; iKey < header.nstart; iKey++)
+			pMap[iKey] = iKey;
+		for (uint32_t iNode = header.nstart; iNode < header.ncount; iNode++)
+			pMap[iNode] = ~0U;
+
+		uint64_t numDiffer = 0;
+
+		double tsStart = now();
+
+		for (uint64_t iCall = 0; iCall < header.numCalls; iCall++) {
+			const uint32_t *pCall = pCalls + iCall * 4;
+
+			uint32_t Q = pMap[pCall[0] & ~IBIT];
+			uint32_t T = pMap[pCall[1] & ~IBIT];
+			uint32_t F = pMap[pCall[2] & ~IBIT];
+
+			if (Q == ~0U || T == ~0U || F == ~0U)
+				ctx.fatal("\n{\"error\":\"operand not produced by earlier call\",\"where\":\"%s:%s:%d\",\"call\":%lu}\n",
+					  __FUNCTION__, __FILE__, __LINE__, iCall);
+
+			uint32_t R = pTree->normaliseNode(Q ^ (pCall[0] & IBIT), T ^ (pCall[1] & IBIT), F ^ (pCall[2] & IBIT));
+
+			if (R != pCall[3])
+				numDiffer++;
+
+			pMap[pCall[3] & ~IBIT] = R ^ (pCall[3] & IBIT);
+		}
+
+		double seconds = now() - tsStart;
+		if (seconds <= 0)
+			seconds = 1e-9;
+
+		char recordedText[128], flagsText[128];
+		ctx.flagsToText(header.magic_flags, recordedText);
+		ctx.flagsToText(opt_flags, flagsText);
+
+		printf("{\"trace\":\"%s\",\"recorded\":\"%08x\",\"recordedText\":\"[%s]\",\"flags\":\"%08x\",\"flagsText\":\"[%s]\",", traceName, header.magic_flags, recordedText, opt_flags, flagsText);
+		printf("\"calls\":%lu,\"recordedNodes\":%u,\"ncount\":%u,\"seconds\":%.6f,\"perSecond\":%.0f,\"identical\":%s}\n",
+		       header.numCalls, header.ncount, pTree->ncount, seconds, header.numCalls / seconds, numDiffer ? "false" : "true");
+
+		ctx.myFree("pMap", pMap);
+		ctx.myFree("pCalls", pCalls);
+		delete pTree;
+	}
+};
+
+/*
+ * Application context.
+ * Needs to be global to be accessible by signal handlers.
+ *
+ * @global {replaytraceContext_t} Application context
+ */
+replaytraceContext_t app;
+
+void usage(char *argv[], bool verbose) {
+	fprintf(stderr, "usage: %s <trace>\n", argv[0]);
+	if (verbose) {
+		fprintf(stderr, "\t   --maxnode=<number> [default=auto]\n");
+		fprintf(stderr, "\t-q --quiet\n");
+		fprintf(stderr, "\t-v --verbose\n");
+		fprintf(stderr, "\t   --[no-]paranoid [default=%s]\n", app.opt_flags & ctx.MAGICMASK_PARANOID ? "enabled" : "disabled");
+		fprintf(stderr, "\t   --[no-]pure [default=%s]\n", app.opt_flags & ctx.MAGICMASK_PURE ? "enabled" : "disabled");
+		fprintf(stderr, "\t   --[no-]rewrite [default=%s]\n", app.opt_flags & ctx.MAGICMASK_REWRITE ? "enabled" : "disabled");
+		fprintf(stderr, "\t   --[no-]cascade [default=%s]\n", app.opt_flags & ctx.MAGICMASK_CASCADE ? "enabled" : "disabled");
+	}
+}
+
+int main(int argc, char *argv[]) {
+	setlinebuf(stdout);
+
+	for (;;) {
+		enum {
+			LO_HELP  = 1, LO_DEBUG, LO_MAXNODE,
+			LO_PARANOID, LO_NOPARANOID, LO_PURE, LO_NOPURE, LO_REWRITE, LO_NOREWRITE, LO_CASCADE, LO_NOCASCADE,
+			LO_QUIET = 'q', LO_VERBOSE = 'v'
+		};
+
+		static struct option long_options[] = {
+			/* name, has_arg, flag, val */
+			{"debug",       1, 0, LO_DEBUG},
+			{"help",        0, 0, LO_HELP},
+			{"maxnode",     1, 0, LO_MAXNODE},
+			{"quiet",       2, 0, LO_QUIET},
+			{"verbose",     2, 0, LO_VERBOSE},
+			//
+			{"paranoid",    0, 0, LO_PARANOID},
+			{"no-paranoid", 0, 0, LO_NOPARANOID},
+			{"pure",        0, 0, LO_PURE},
+			{"no-pure",     0, 0, LO_NOPURE},
+			{"rewrite",     0, 0, LO_REWRITE},
+			{"no-rewrite",  0, 0, LO_NOREWRITE},
+			{"cascade",     0, 0, LO_CASCADE},
+			{"no-cascade",  0, 0, LO_NOCASCADE},
+			//
+			{NULL,          0, 0, 0}
+		};
+
+		char optstring[64];
+		char *cp                            = optstring;
+		int  option_index                   = 0;
+
+		for (int i = 0; long_options[i].name; i++) {
+			if (isalpha(long_options[i].val)) {
+				*cp++ = (char) long_options[i].val;
+
+				if (long_options[i].has_arg)
+					*cp++ = ':';
+				if (long_options[i].has_arg == 2)
+					*cp++ = ':';
+			}
+		}
+
+		*cp = '\0';
+
+		int c = getopt_long(argc, argv, optstring, long_options, &option_index);
+		if (c == -1)
+			break;
+
+		switch (c) {
+		case LO_DEBUG:
+			ctx.opt_debug = (unsigned) strtoul(optarg, NULL, 8); // OCTAL!!
+			break;
+		case LO_HELP:
+			usage(argv, true);
+			exit(0);
+		case LO_MAXNODE:
+			app.opt_maxNode = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+		case LO_QUIET:
+			ctx.opt_verbose = optarg ? (unsigned) strtoul(optarg, NULL, 10) : ctx.opt_verbose - 1;
+			break;
+		case LO_VERBOSE:
+			ctx.opt_verbose = optarg ? (unsigned) strtoul(optarg, NULL, 10) : ctx.opt_verbose + 1;
+			break;
+
+		case LO_PARANOID:
+			app.opt_flags |= ctx.MAGICMASK_PARANOID;
+			break;
+		case LO_NOPARANOID:
+			app.opt_flags &= ~ctx.MAGICMASK_PARANOID;
+			break;
+		case LO_PURE:
+			app.opt_flags |= ctx.MAGICMASK_PURE;
+			break;
+		case LO_NOPURE:
+			app.opt_flags &= ~ctx.MAGICMASK_PURE;
+			break;
+		case LO_REWRITE:
+			app.opt_flags |= ctx.MAGICMASK_REWRITE;
+			break;
+		case LO_NOREWRITE:
+			app.opt_flags &= ~ctx.MAGICMASK_REWRITE;
+			break;
+		case LO_CASCADE:
+			app.opt_flags |= ctx.MAGICMASK_CASCADE;
+			break;
+		case LO_NOCASCADE:
+			app.opt_flags &= ~ctx.MAGICMASK_CASCADE;
+			break;
+
+		case '?':
+			fprintf(stderr, "Try `%s --help' for more information.\n", argv[0]);
+			exit(1);
+		default:
+			fprintf(stderr, "getopt returned character code %d\n", c);
+			exit(1);
+		}
+	}
+
+	if (argc - optind < 1) {
+		usage(argv, false);
+		exit(1);
+	}
+
+	app.main(argv[optind]);
+
+	return 0;
+}
@@ -0,0 +1,505 @@
+#ifndef _RESTARTCOST_H
+#define _RESTARTCOST_H
+
+/*
+ * @date 2026-10-17 11:40:12
+ *
+ * `restartcost.h` cost-balanced windows for splitting a generator run into tasks.
+ *
+ * `--task=<id>,<last>` splits the generator progress range into equally sized slices.
+ * However, the cost of a candidate varies hugely between restart tabs.
+ * Associative lookups of unsafe signatures and the rejection rate of `foundTree()` differ per region.
+ * Equal slices result in one straggler running hours after the rest.
+ *
+ * `"./gensignature --costprofile=<file>"` and `"./genmember --costprofile=<file>"` sample the cost of each restart tab.
+ * The tool is set up as for a normal run and its own `foundTree()` callback is timed for the first `--sample` candidates of every tab,
+ * so early rejections, duplicates and lookups are weighed as they are encountered.
+ * Output is a profile with one line per restart tab:
+ *
+ *   <progressLo> <progressHi> <cost>
+ *
+ * where `<cost>` is the predicted number of nanoseconds to process the tab.
+ *
+ * Tools load the profile with `--restartcost=<file>` and place window boundaries on restart tabs,
+ * balanced on predicted wall time instead of progress.
+ * Without a profile windows fall back to equal progress slices.
+ *
+ * Dynamic mode (`--dynamic=<claimfile>[,<numWindows>]`) hands out small windows on demand.
+ * The claim file holds the state of every window: free, claimed or done.
+ * A worker holds a `fcntl()` lock on the window it processes, windows of workers that died are re-issued.
+ * Fast workers claim more windows, which eliminates stragglers.
+ */
+
+/*
+ *	This file is part of Untangle, Information in fractal structures.
+ *	Copyright (C) 2017-2026, xyzzy@rockingship.org
+ *
+ *	This program is free software: you can redistribute it and/or modify
+ *	it under the terms of the GNU General Public License as published by
+ *	the Free Software Foundation, either version 3 of the License, or
+ *	(at your option) any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU General Public License for more details.
+ *
+ *	You should have received a copy of the GNU General Public License
+ *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "context.h"
+#include "generator.h"
+
+/**
+ * @date 2026-10-17 12:16:20
+ *
+ * Callback wrapper for `--costprofile`, accumulates the time spent in the tool callback
+ *
+ * @typedef {object} restartCostSampler_t
+ */
+struct restartCostSampler_t : callable_t {
+	/// @var {callable_t} tool context
+	callable_t                              *cbObject;
+	/// @var {generateTreeCallback_t} tool callback
+	generatorTree_t::generateTreeCallback_t cbMember;
+	/// @var {uint64_t} nanoseconds spent in callback
+	uint64_t                                nsec;
+
+	restartCostSampler_t(callable_t *cbObject, generatorTree_t::generateTreeCallback_t cbMember) : cbObject(cbObject), cbMember(cbMember), nsec(0) {
+	}
+
+	bool foundTree(const generatorTree_t &tree, const char *pName, unsigned numPlaceholder, unsigned numEndpoint, unsigned numBackRef) {
+		struct timespec t0, t1;
+
+		::clock_gettime(CLOCK_MONOTONIC, &t0);
+		bool ret = (cbObject->*cbMember)(tree, pName, numPlaceholder, numEndpoint, numBackRef);
+		::clock_gettime(CLOCK_MONOTONIC, &t1);
+
+		nsec += (t1.tv_sec - t0.tv_sec) * 1000000000ULL + t1.tv_nsec - t0.tv_nsec;
+		return ret;
+	}
+};
+
+/**
+ * @date 2026-10-17 11:42:30
+ *
+ * Cost profile of restart tabs
+ *
+ * @typedef {object} restartCost_t
+ */
+struct restartCost_t {
+
+	/// @var {context_t} I/O context
+	context_t &ctx;
+
+	/// @var {number} number of tabs in profile
+	unsigned numTab;
+	/// @var {number} allocated size of profile
+	unsigned maxTab;
+	/// @var {uint64_t[]} progress at start of tab
+	uint64_t *pProgressLo;
+	/// @var {uint64_t[]} progress at end of tab (not including)
+	uint64_t *pProgressHi;
+	/// @var {double[]} cumulative predicted cost up to and including tab
+	double *pCumulative;
+
+	/// @var {uint64_t} upper bound of progress when no profile loaded
+	uint64_t numProgress;
+
+	/// @var {number} `--dynamic` claim file, kept open while a window is claimed to hold its lock
+	int      claimHndl;
+	/// @var {number} claimed window, first is 1, zero if none
+	unsigned claimId;
+	/// @var {number} offset of state byte of claimed window
+	off_t    claimOfs;
+	/// @var {number} number of windows claimed by this worker
+	unsigned numClaimed;
+
+	/**
+	 * Constructor
+	 */
+	restartCost_t(context_t &ctx) : ctx(ctx) {
+		numTab      = 0;
+		maxTab      = 0;
+		pProgressLo = NULL;
+		pProgressHi = NULL;
+		pCumulative = NULL;
+		numProgress = 0;
+		claimHndl   = -1;
+		claimId     = 0;
+		claimOfs    = 0;
+		numClaimed  = 0;
+	}
+
+	/**
+	 * Release system resources
+	 */
+	~restartCost_t() {
+		if (pProgressLo)
+			ctx.myFree("restartCost_t::pProgressLo", pProgressLo);
+		if (pProgressHi)
+			ctx.myFree("restartCost_t::pProgressHi", pProgressHi);
+		if (pCumulative)
+			ctx.myFree("restartCost_t::pCumulative", pCumulative);
+		if (claimHndl != -1)
+			::close(claimHndl);
+	}
+
+	/**
+	 * @date 2026-10-17 11:45:03
+	 *
+	 * Load profile as created by `"--costprofile"`
+	 *
+	 * @param {string} fileName - name of profile
+	 */
+	void load(const char *fileName) {
+
+		FILE *f = ::fopen(fileName, "r");
+		if (f == NULL)
+			ctx.fatal("\n{\"error\":\"fopen('%s') failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  fileName, __FUNCTION__, __FILE__, __LINE__);
+
+		// count lines to size allocation
+		char     line[256];
+		unsigned numLine = 0;
+		while (::fgets(line, sizeof(line), f))
+			numLine++;
+		::rewind(f);
+
+		maxTab      = numLine;
+		pProgressLo = (uint64_t *) ctx.myAlloc("restartCost_t::pProgressLo", maxTab, sizeof(*pProgressLo));
+		pProgressHi = (uint64_t *) ctx.myAlloc("restartCost_t::pProgressHi", maxTab, sizeof(*pProgressHi));
+		pCumulative = (double *) ctx.myAlloc("restartCost_t::pCumulative", maxTab, sizeof(*pCumulative));
+
+		// <progressLo> <progressHi> <cost>
+		double   total  = 0;
+		unsigned lineNr = 0;
+		while (::fgets(line, sizeof(line), f)) {
+			lineNr++;
+
+			if (line[0] == '#' || line[0] == '/' || line[0] == '\n')
+				continue; // comment or empty
+
+			uint64_t lo, hi;
+			double   cost;
+			if (::sscanf(line, "%lu %lu %lf", &lo, &hi, &cost) != 3 || hi <= lo || cost < 0)
+				ctx.fatal("\n{\"error\":\"bad line\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"linenr\":%u}\n",
+					  __FUNCTION__, __FILE__, __LINE__, fileName, lineNr);
+			if (numTab && lo != pProgressHi[numTab - 1])
+				ctx.fatal("\n{\"error\":\"tabs not adjacent\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"linenr\":%u}\n",
+					  __FUNCTION__, __FILE__, __LINE__, fileName, lineNr);
+
+			total += cost;
+			pProgressLo[numTab] = lo;
+			pProgressHi[numTab] = hi;
+			pCumulative[numTab] = total;
+			numTab++;
+		}
+
+		::fclose(f);
+
+		if (numTab == 0)
+			ctx.fatal("\n{\"error\":\"empty profile\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__, fileName);
+
+		numProgress = pProgressHi[numTab - 1];
+	}
+
+	/**
+	 * @date 2026-10-17 11:51:27
+	 *
+	 * Determine window for given task.
+	 * With a profile, boundaries are restart tabs where cumulative cost crosses `taskId/taskLast` of total.
+	 * Without, progress is split into equal chunks.
+	 *
+	 * First task starts at zero, last task is open ended in case metrics are off.
+	 *
+	 * @param {number} taskId - task number, first task is 1
+	 * @param {number} taskLast - number of tasks
+	 * @param {uint64_t} windowLo - (output) lower bound
+	 * @param {uint64_t} windowHi - (output) upper bound (not including), zero if open ended
+	 */
+	void taskWindow(unsigned taskId, unsigned taskLast, uint64_t *windowLo, uint64_t *windowHi) {
+		assert(taskId >= 1 && taskId <= taskLast);
+
+		*windowLo = taskBoundary(taskId - 1, taskLast);
+		*windowHi = (taskId == taskLast) ? 0 : taskBoundary(taskId, taskLast);
+	}
+
+	/**
+	 * @date 2026-10-17 11:55:48
+	 *
+	 * Progress position of boundary `k` out of `n`
+	 *
+	 * @param {number} k - boundary index
+	 * @param {number} n - number of windows
+	 * @return {uint64_t} starting progress of window `k`
+	 */
+	uint64_t taskBoundary(unsigned k, unsigned n) {
+		if (k == 0)
+			return 0;
+
+		if (numTab == 0) {
+			// no profile, equal sized slices
+			uint64_t taskSize = numProgress / n;
+			if (taskSize == 0)
+				taskSize = 1;
+			return taskSize * k;
+		}
+
+		// binary search first tab where cumulative cost reaches target
+		double   target = pCumulative[numTab - 1] * k / n;
+		unsigned lo     = 0, hi = numTab - 1;
+		while (lo < hi) {
+			unsigned mid = (lo + hi) / 2;
+			if (pCumulative[mid] < target)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+
+		// window boundary is end of that tab
+		return pProgressHi[lo];
+	}
+
+	/**
+	 * @date 2026-10-17 12:21:44
+	 *
+	 * Sample cost of every restart tab by running the tool callback and write profile.
+	 * Tabs are the `restartData[]` section of the run, the generator must be initialised.
+	 * Only the first `numSample` candidates of a tab are timed, the cost is extrapolated to the full tab.
+	 *
+	 * @param {string} fileName - name of profile
+	 * @param {generatorTree_t} generator - candidate generator
+	 * @param {uint64_t[]} pRestartData - restart tabs, terminated by `0xffffffffffffffff`
+	 * @param {uint64_t} numProgress - progress at end of run
+	 * @param {number} numNode - number of nodes of candidates
+	 * @param {number} numSample - candidates timed per tab
+	 * @param {object} cbObject - tool context
+	 * @param {object} cbMember - tool callback
+	 */
+	void sampleProfile(const char *fileName, generatorTree_t &generator, const uint64_t *pRestartData, uint64_t numProgress, unsigned numNode, unsigned numSample, callable_t *cbObject, generatorTree_t::generateTreeCallback_t cbMember) {
+
+		FILE *f = ::fopen(fileName, "w");
+		if (f == NULL)
+			ctx.fatal("\n{\"error\":\"fopen('%s') failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  fileName, __FUNCTION__, __FILE__, __LINE__);
+
+		unsigned numTab = 0;
+		while (pRestartData[numTab] != 0xffffffffffffffffLL)
+			numTab++;
+
+		restartCostSampler_t sampler(cbObject, cbMember);
+		unsigned             endpointsLeft = numNode * 2 + 1;
+		double               totalCost     = 0;
+
+		::fprintf(f, "# numNode=%u pure=%u sample=%u numTabs=%u numProgress=%lu\n", numNode, (ctx.flags & context_t::MAGICMASK_PURE) ? 1 : 0, numSample, numTab, numProgress);
+		::fprintf(f, "# <progressLo> <progressHi> <cost>\n");
+
+		// tab `-1` covers the candidates before the first restart point
+		for (int iTab = -1; iTab < (int) numTab; iTab++) {
+			uint64_t lo = (iTab < 0) ? 0 : pRestartData[iTab];
+			uint64_t hi = (iTab + 1 < (int) numTab) ? pRestartData[iTab + 1] : numProgress;
+
+			if (hi <= lo)
+				continue; // empty tab
+
+			if (ctx.opt_verbose >= ctx.VERBOSE_TICK && ctx.tick) {
+				fprintf(stderr, "\r\e[K[%s] %d/%u %.5f%%", ctx.timeAsString(), iTab + 1, numTab, (iTab + 1) * 100.0 / numTab);
+				ctx.tick = 0;
+			}
+
+			// window of sample. NOTE: `windowLo` zero is disabled, which is also correct for the first tab
+			uint64_t sampleHi = (hi - lo > numSample) ? lo + numSample : hi;
+
+			generator.windowLo     = lo;
+			generator.windowHi     = sampleHi;
+			generator.pRestartData = pRestartData;
+			ctx.progress           = 0;
+			sampler.nsec           = 0;
+
+			generator.clearGenerator();
+			generator.generateTrees(numNode, endpointsLeft, 0, 0, &sampler, static_cast<generatorTree_t::generateTreeCallback_t>(&restartCostSampler_t::foundTree));
+
+			// extrapolate to full tab
+			double cost = (double) sampler.nsec * (hi - lo) / (sampleHi - lo);
+			totalCost += cost;
+
+			::fprintf(f, "%lu\t%lu\t%.0f\n", lo, hi, cost);
+		}
+
+		if (::fclose(f))
+			ctx.fatal("\n{\"error\":\"fclose('%s') failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  fileName, __FUNCTION__, __FILE__, __LINE__);
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_TICK)
+			fprintf(stderr, "\r\e[K");
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY)
+			fprintf(stderr, "[%s] numTabs=%u predicted=%.0fs\n", ctx.timeAsString(), numTab, totalCost / 1e9);
+	}
+
+	/**
+	 * @date 2026-10-17 12:03:10
+	 *
+	 * Lock or unlock a byte of the claim file.
+	 * Byte 0 serialises updates, the state byte of a window is held by the worker processing it.
+	 * `fcntl()` locks are released by the kernel when a worker dies.
+	 *
+	 * @param {number} type - `F_WRLCK` or `F_UNLCK`
+	 * @param {number} ofs - byte offset
+	 * @param {boolean} wait - block until lock available
+	 * @return {boolean} `true` if lock was set
+	 */
+	bool claimLock(short type, off_t ofs, bool wait) {
+		struct flock fl;
+
+		::memset(&fl, 0, sizeof(fl));
+		fl.l_type   = type;
+		fl.l_whence = SEEK_SET;
+		fl.l_start  = ofs;
+		fl.l_len    = 1;
+
+		if (::fcntl(claimHndl, wait ? F_SETLKW : F_SETLK, &fl) == 0)
+			return true;
+		if (!wait && (errno == EACCES || errno == EAGAIN))
+			return false;
+
+		ctx.fatal("\n{\"error\":\"fcntl() failed\",\"where\":\"%s:%s:%d\",\"offset\":%lu,\"return\":\"%m\"}\n",
+			  __FUNCTION__, __FILE__, __LINE__, (uint64_t) ofs);
+		return false;
+	}
+
+	/**
+	 * @date 2026-10-17 12:03:10
+	 *
+	 * Dynamic mode: claim next window from a shared claim file, created when missing.
+	 * The file is a line with the number of windows followed by a line with one state character per window:
+	 * `.` free, `c` claimed, `d` done. Empty windows (multiple boundaries falling on same tab) are marked done.
+	 *
+	 * When no free windows remain, claimed windows whose worker died (state byte not locked) are re-issued.
+	 * Windows are only marked done by `completeWindow()`.
+	 *
+	 * @param {string} claimFile - name of shared claim file
+	 * @param {number} numWindow - total number of windows
+	 * @param {number} windowId - (output) claimed window, first is 1
+	 * @param {uint64_t} windowLo - (output) lower bound
+	 * @param {uint64_t} windowHi - (output) upper bound (not including), zero if open ended
+	 * @return {boolean} `true` if claimed, `false` if nothing left to claim
+	 */
+	bool claimWindow(const char *claimFile, unsigned numWindow, unsigned *windowId, uint64_t *windowLo, uint64_t *windowHi) {
+
+		assert(claimId == 0); // previous window must be completed
+
+		if (claimHndl == -1) {
+			claimHndl = ::open(claimFile, O_RDWR | O_CREAT, 0666);
+			if (claimHndl == -1)
+				ctx.fatal("\n{\"error\":\"open('%s') failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  claimFile, __FUNCTION__, __FILE__, __LINE__);
+		}
+
+		claimLock(F_WRLCK, 0, true);
+
+		// header is fixed width so state offsets do not depend on contents
+		char     header[16];
+		unsigned ofsState = ::sprintf(header, "%10u\n", numWindow);
+		char     *pState  = (char *) ctx.myAlloc("restartCost_t::pState", numWindow + 1, sizeof(*pState));
+
+		ssize_t len = ::pread(claimHndl, header, ofsState, 0);
+		if (len == 0) {
+			// new file
+			::sprintf(header, "%10u\n", numWindow);
+			::memset(pState, '.', numWindow);
+			pState[numWindow] = '\n';
+			if (::pwrite(claimHndl, header, ofsState, 0) != ofsState || ::pwrite(claimHndl, pState, numWindow + 1, ofsState) != numWindow + 1)
+				ctx.fatal("\n{\"error\":\"write('%s') failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+					  claimFile, __FUNCTION__, __FILE__, __LINE__);
+		} else {
+			header[len > 0 ? len : 0] = 0;
+			if (len != ofsState || ::strtoul(header, NULL, 0) != numWindow)
+				ctx.fatal("\n{\"error\":\"claim file does not match\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\",\"numWindow\":%u}\n",
+					  __FUNCTION__, __FILE__, __LINE__, claimFile, numWindow);
+			if (::pread(claimHndl, pState, numWindow, ofsState) != numWindow)
+				ctx.fatal("\n{\"error\":\"claim file truncated\",\"where\":\"%s:%s:%d\",\"filename\":\"%s\"}\n",
+					  __FUNCTION__, __FILE__, __LINE__, claimFile);
+		}
+
+		unsigned numDone  = 0;
+		bool     reissued = false;
+
+		// first pass free windows, second pass abandoned windows
+		for (unsigned iPass = 0; iPass < 2 && claimId == 0; iPass++) {
+			for (unsigned iWindow = 0; iWindow < numWindow && claimId == 0; iWindow++) {
+				if (pState[iWindow] == (iPass ? 'c' : '.')) {
+					taskWindow(iWindow + 1, numWindow, windowLo, windowHi);
+
+					if (*windowHi != 0 && *windowLo >= *windowHi) {
+						// empty window
+						pState[iWindow] = 'd';
+					} else if (claimLock(F_WRLCK, ofsState + iWindow, false)) {
+						// free, or holder died
+						pState[iWindow] = 'c';
+						claimId  = iWindow + 1;
+						claimOfs = ofsState + iWindow;
+						reissued = iPass != 0;
+					}
+
+					if (::pwrite(claimHndl, pState + iWindow, 1, ofsState + iWindow) != 1)
+						ctx.fatal("\n{\"error\":\"write('%s') failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+							  claimFile, __FUNCTION__, __FILE__, __LINE__);
+				}
+			}
+		}
+
+		for (unsigned iWindow = 0; iWindow < numWindow; iWindow++)
+			numDone += (pState[iWindow] == 'd') ? 1 : 0;
+
+		claimLock(F_UNLCK, 0, false);
+		ctx.myFree("restartCost_t::pState", pState);
+
+		if (claimId) {
+			*windowId = claimId;
+			numClaimed++;
+
+			if (reissued && ctx.opt_verbose >= ctx.VERBOSE_WARNING)
+				fprintf(stderr, "[%s] WARNING: re-issuing window %u/%u of terminated worker\n", ctx.timeAsString(), claimId, numWindow);
+			return true;
+		}
+
+		// a leftover claim file of a finished run would otherwise silently do nothing
+		if (numClaimed == 0 && numDone == numWindow && ctx.opt_verbose >= ctx.VERBOSE_WARNING)
+			fprintf(stderr, "[%s] WARNING: all %u windows of \"%s\" are done. Remove it to start a new run\n", ctx.timeAsString(), numWindow, claimFile);
+
+		return false;
+	}
+
+	/**
+	 * @date 2026-10-17 12:03:10
+	 *
+	 * Dynamic mode: mark the claimed window done and release it.
+	 * Windows not completed (worker died or was truncated) are re-issued to other workers.
+	 */
+	void completeWindow(void) {
+		assert(claimId != 0);
+
+		claimLock(F_WRLCK, 0, true);
+		if (::pwrite(claimHndl, "d", 1, claimOfs) != 1)
+			ctx.fatal("\n{\"error\":\"write() failed\",\"where\":\"%s:%s:%d\",\"return\":\"%m\"}\n",
+				  __FUNCTION__, __FILE__, __LINE__);
+		claimLock(F_UNLCK, claimOfs, false);
+		claimLock(F_UNLCK, 0, false);
+
+		claimId = 0;
+	}
+};
+
+#endif
@@ -476,6 +476,140 @@ struct selftestContext_t : dbtool_t {
 			fprintf(stderr, "[%s] %s() passed\n", ctx.timeAsString(), __FUNCTION__);
 	}
 
+	/**
+	 * @date 2026-10-17 21:41:26
+	 *
+	 * Monotonic clock in nanoseconds for benchmarks
+	 *
+	 * @return {number} nanoseconds
+	 */
+	static uint64_t timerNs(void) {
+		struct timespec ts;
+		::clock_gettime(CLOCK_MONOTONIC, &ts);
+		return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+	}
+
+	/**
+	 * @date 2026-10-17 21:41:26
+	 *
+	 * Test that the SIMD variants of `footprint_t::crc32()` and `footprint_t::equals()` agree with the scalar originals and time them.
+	 *
+	 * Like `lookupImprint()`, the hashed key is hot in cache and compared against near-equal prints probed in random order over a table larger than cache.
+	 */
+	void performSelfTestFootprint(void) {
+		const unsigned numPrint = 1 << 18;
+		const unsigned numProbe = 1 << 22;
+
+		footprint_t *pPrints = (footprint_t *) ctx.myAlloc("selftestContext_t::pPrints", numPrint, sizeof(*pPrints));
+		uint32_t    *pOrder  = (uint32_t *) ctx.myAlloc("selftestContext_t::pOrder", numProbe, sizeof(*pOrder));
+
+		// sparse bits so that many prints share their low words
+		uint64_t seed = 0x2545f4914f6cdd1dULL;
+		for (unsigned i = 0; i < numPrint; i++) {
+			for (unsigned j = 0; j < footprint_t::QUADPERFOOTPRINT; j++) {
+				seed ^= seed << 13;
+				seed ^= seed >> 7;
+				seed ^= seed << 17;
+				pPrints[i].bits[j] = seed & (seed >> 11) & (seed >> 23);
+			}
+		}
+		for (unsigned i = 0; i < numProbe; i++) {
+			seed ^= seed << 13;
+			seed ^= seed >> 7;
+			seed ^= seed << 17;
+			pOrder[i] = seed % numPrint;
+		}
+
+		/*
+		 * Identical results
+		 */
+
+		bool haveAVX2 = __builtin_cpu_supports("avx2");
+
+		for (unsigned i = 0; i < numPrint; i++) {
+			const footprint_t &L = pPrints[i];
+			const footprint_t &R = pPrints[pOrder[i]];
+
+			if (footprint_t::hasFolded() && L.crc32Folded() != L.crc32Serial()) {
+				printf("{\"error\":\"crc32Folded() mismatch\",\"where\":\"%s:%s:%d\",\"index\":%u,\"expected\":\"%08x\",\"encountered\":\"%08x\"}\n",
+				       __FUNCTION__, __FILE__, __LINE__, i, L.crc32Serial(), L.crc32Folded());
+				exit(1);
+			}
+
+			bool expected = ::memcmp(L.bits, R.bits, sizeof(L.bits)) == 0;
+			if (L.equals(R) != expected || (haveAVX2 && L.equalsAVX2(R) != expected)) {
+				printf("{\"error\":\"equals() mismatch\",\"where\":\"%s:%s:%d\",\"index\":%u,\"expected\":%d}\n",
+				       __FUNCTION__, __FILE__, __LINE__, i, expected);
+				exit(1);
+			}
+		}
+
+		/*
+		 * Benchmark, `sum` keeps the compiler from removing the loops
+		 */
+
+		unsigned sum = 0;
+		uint64_t t0, nsSerial = 0, nsFolded = 0, nsSerialChain = 0, nsFoldedChain = 0, nsEquals = 0, nsAVX2 = 0;
+
+		// throughput, independent keys
+		t0 = timerNs();
+		for (unsigned i = 0; i < numProbe; i++)
+			sum += pPrints[i % 1024].crc32Serial();
+		nsSerial = timerNs() - t0;
+
+		if (footprint_t::hasFolded()) {
+			t0 = timerNs();
+			for (unsigned i = 0; i < numProbe; i++)
+				sum += pPrints[i % 1024].crc32Folded();
+			nsFolded = timerNs() - t0;
+		}
+
+		// latency, each key depends on the previous hash like index probing does
+		footprint_t key = pPrints[0];
+		unsigned crc = 0;
+
+		t0 = timerNs();
+		for (unsigned i = 0; i < numProbe; i++) {
+			key.bits[0] ^= crc;
+			crc = key.crc32Serial();
+		}
+		nsSerialChain = timerNs() - t0;
+
+		if (footprint_t::hasFolded()) {
+			t0 = timerNs();
+			for (unsigned i = 0; i < numProbe; i++) {
+				key.bits[0] ^= crc;
+				crc = key.crc32Folded();
+			}
+			nsFoldedChain = timerNs() - t0;
+		}
+		sum += crc;
+
+		t0 = timerNs();
+		for (unsigned i = 0; i < numProbe; i++)
+			sum += pPrints[pOrder[i]].equals(pPrints[i % numPrint]);
+		nsEquals = timerNs() - t0;
+
+		if (haveAVX2) {
+			t0 = timerNs();
+			for (unsigned i = 0; i < numProbe; i++)
+				sum += pPrints[pOrder[i]].equalsAVX2(pPrints[i % numPrint]);
+			nsAVX2 = timerNs() - t0;
+		}
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_VERBOSE)
+			fprintf(stderr, "[%s] {\"crc32Serial\":%.2f,\"crc32Folded\":%.2f,\"crc32SerialChain\":%.2f,\"crc32FoldedChain\":%.2f,\"equals\":%.2f,\"equalsAVX2\":%.2f,\"sum\":%u}\n",
+				ctx.timeAsString(), (double) nsSerial / numProbe, (double) nsFolded / numProbe, (double) nsSerialChain / numProbe, (double) nsFoldedChain / numProbe,
+				(double) nsEquals / numProbe, (double) nsAVX2 / numProbe, sum);
+
+		// release resources
+		ctx.myFree("selftestContext_t::pOrder", pOrder);
+		ctx.myFree("selftestContext_t::pPrints", pPrints);
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY)
+			fprintf(stderr, "[%s] %s() passed\n", ctx.timeAsString(), __FUNCTION__);
+	}
+
 	/**
 	 * @date 2020-03-15 16:35:43
 	 *
@@ -1007,6 +1141,7 @@ struct selftestContext_t : dbtool_t {
 
 			// clear database imprint and index
 			::memset(pStore->imprintIndex, 0, pStore->imprintIndexSize * sizeof(*pStore->imprintIndex));
+			pStore->clearImprintFilter();
 			pStore->numImprint = 1; // skip reserved entry
 
 			/*
@@ -1321,6 +1456,7 @@ struct selftestContext_t : dbtool_t {
 
 			// prepare database
 			::memset(pStore->imprintIndex, 0, pStore->imprintIndexSize * sizeof(*pStore->imprintIndex));
+			pStore->clearImprintFilter();
 			::memset(pStore->signatureIndex, 0, pStore->signatureIndexSize * sizeof(*pStore->signatureIndex));
 			pStore->numImprint     = 1; // skip reserved first entry
 			pStore->numSignature   = 1; // skip reserved first entry
@@ -1410,6 +1546,7 @@ struct selftestContext_t : dbtool_t {
 
 				// clear imprint index
 				::memset(pStore->imprintIndex, 0, pStore->imprintIndexSize * sizeof(*pStore->imprintIndex));
+				pStore->clearImprintFilter();
 				pStore->numImprint = 1; // skip mandatory reserved entry
 				ctx.cntHash        = 0;
 				ctx.cntCompare     = 0;
@@ -1691,6 +1828,11 @@ int main(int argc, char *argv[]) {
 	 */
 	app.performSelfTestWindow();
 
+	/*
+	 * Test that the SIMD footprint variants are identical to the originals and time them
+	 */
+	app.performSelfTestFootprint();
+
 	if (!app.arg_inputDatabase) {
 		/*
 		 * @date 2020-04-22 00:48:47
@@ -1386,6 +1386,7 @@ struct tinyTree_t {
 	 * @param {vector[]} v - the evaluated result of the unified operators
 	 */
 	inline void eval(footprint_t *v) const {
+		PERFTIMER(PERF_TINYEVAL);
 
 		/*
 		 * @date 2020-04-13 18:42:52
@@ -317,7 +317,8 @@ int main(int argc, char *argv[]) {
 	// open database
 	database_t db(ctx);
 
-	db.open(app.arg_database);
+	// only transforms are used, compressed containers leave other sections compressed
+	db.open(app.arg_database, ~database_t::ALLOCMASK_TRANSFORM);
 
 	if (db.maxTransform == 0)
 		ctx.fatal("Missing transform section: %s\n", app.arg_database);
@@ -23,9 +23,13 @@
  *	along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <ctype.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <ctype.h>
+#include <unistd.h>
 
 char *encodePrefix(char *pName, unsigned value) {
 
@@ -80,12 +84,40 @@ int decodeSlot(const char *pName) {
 	return (value + 1) * 26 + *pName - 'a';
 }
 
-int main(int argc, char *const *argv) {
-	setlinebuf(stdout);
+/**
+ * @date 2026-10-17 15:48:05
+ *
+ * Slice of the prefix space, validated by a single thread
+ *
+ * @typedef {object} prefixSlice_t
+ */
+struct prefixSlice_t {
+	/// @var {pthread_t} thread handle
+	pthread_t thread;
+	/// @var {number} first node id
+	int       lo;
+	/// @var {number} last node id (exclusive)
+	int       hi;
+	/// @var {number} first failing node id, or `hi` if none
+	int       fail;
+	/// @var {number} decoded value of failing node id
+	int       failValue;
+	/// @var {string} name of failing node id
+	char      failName[32];
+};
+
+/**
+ * @date 2026-10-17 15:49:32
+ *
+ * Validate a slice, stop at the first failure
+ */
+void *prefixSliceEntry(void *arg) {
+	prefixSlice_t *pSlice = (prefixSlice_t *) arg;
+	char          name[32];
 
-	static char name[32];
+	pSlice->fail = pSlice->hi;
 
-	for (int i = 10; i < 10000000; i++) {
+	for (int i = pSlice->lo; i < pSlice->hi; i++) {
 
 		// base prefix
 		char *pName = encodePrefix(name, (i - 10) / 10);
@@ -97,11 +129,100 @@ int main(int argc, char *const *argv) {
 		int value = decodeNode(name);
 
 		if (i != value) {
-			fprintf(stderr, "prefix failed for %d. name=%s value=%d\n", i, name, value);
+			pSlice->fail      = i;
+			pSlice->failValue = value;
+			snprintf(pSlice->failName, sizeof pSlice->failName, "%s", name);
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+void usage(char *const *argv, bool verbose, unsigned opt_threads) {
+	fprintf(stderr, "usage: %s\n", argv[0]);
+	if (verbose) {
+		fprintf(stderr, "\t   --threads=<number> [default=%u]\n", opt_threads);
+	}
+}
+
+int main(int argc, char *const *argv) {
+	setlinebuf(stdout);
+
+	unsigned opt_threads = sysconf(_SC_NPROCESSORS_ONLN);
+
+	/*
+	 * scan options
+	 */
+
+	for (;;) {
+		enum {
+			LO_HELP = 1, LO_THREADS,
+		};
+
+		static struct option long_options[] = {
+			/* name, has_arg, flag, val */
+			{"help",    0, 0, LO_HELP},
+			{"threads", 1, 0, LO_THREADS},
+			//
+			{NULL,      0, 0, 0}
+		};
+
+		int option_index = 0;
+		int c            = getopt_long(argc, argv, "", long_options, &option_index);
+		if (c == -1)
+			break;
+
+		switch (c) {
+		case LO_HELP:
+			usage(argv, true, opt_threads);
+			exit(0);
+		case LO_THREADS:
+			opt_threads = (unsigned) strtoul(optarg, NULL, 10);
+			break;
+
+		case '?':
+			fprintf(stderr, "Try `%s --help' for more information.\n", argv[0]);
+			exit(1);
+		default:
+			fprintf(stderr, "getopt returned character code %d\n", c);
+			exit(1);
+		}
+	}
+
+	if (opt_threads < 1)
+		opt_threads = 1;
+
+	/*
+	 * Partition the prefix space in contiguous slices.
+	 * Reporting the failure of the lowest slice is identical to a serial scan.
+	 */
+	const int     lo      = 10;
+	const int     hi      = 10000000;
+	prefixSlice_t *slices = new prefixSlice_t[opt_threads];
+
+	for (unsigned iSlice = 0; iSlice < opt_threads; iSlice++) {
+		slices[iSlice].lo = lo + (int) ((uint64_t) (hi - lo) * iSlice / opt_threads);
+		slices[iSlice].hi = lo + (int) ((uint64_t) (hi - lo) * (iSlice + 1) / opt_threads);
+
+		int ret = pthread_create(&slices[iSlice].thread, NULL, prefixSliceEntry, slices + iSlice);
+		if (ret) {
+			fprintf(stderr, "pthread_create() failed. return=%d\n", ret);
+			exit(1);
+		}
+	}
+
+	for (unsigned iSlice = 0; iSlice < opt_threads; iSlice++)
+		pthread_join(slices[iSlice].thread, NULL);
+
+	for (unsigned iSlice = 0; iSlice < opt_threads; iSlice++) {
+		if (slices[iSlice].fail != slices[iSlice].hi) {
+			fprintf(stderr, "prefix failed for %d. name=%s value=%d\n", slices[iSlice].fail, slices[iSlice].failName, slices[iSlice].failValue);
 			exit(1);
 		}
 	}
 
+	delete[] slices;
 	printf("decodeNode(\"Z9\")=%d\n", decodeNode("Z9"));
 	printf("decodeNode(\"ZZ9\")=%d\n", decodeNode("ZZ9"));
 	printf("decodeNode(\"ZZZ9\")=%d\n", decodeNode("ZZZ9"));
@@ -31,10 +31,12 @@
 #include <assert.h>
 #include <ctype.h>
 #include <getopt.h>
+#include <pthread.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <vector>
 
 #include "rewritedata.h" // include before basetree.h
 #include "basetree.h"
@@ -60,12 +62,20 @@ struct validaterewriteContext_t {
 	uint32_t opt_seed;
 	/// @var {number} extra verbose
 	unsigned opt_text;
+	/// @var {number} --threads, number of worker threads
+	unsigned opt_threads;
 
 	validaterewriteContext_t(context_t &ctx) : ctx(ctx) {
 		opt_flags   = 0;
 		opt_text    = 0;
 		opt_maxNode = DEFAULT_MAXNODE;
 		opt_seed    = 0x20190303;
+		opt_threads = sysconf(_SC_NPROCESSORS_ONLN);
+
+		pWorkers      = NULL;
+		nextUnit      = 0;
+		firstFailUnit = ~0U;
+		stopRandom    = 0;
 	}
 
 	void treeEval(baseTree_t *pTree, uint64_t *pEval) {
@@ -207,280 +217,277 @@ struct validaterewriteContext_t {
 		assert(0);
 	}
 
-	void main(void) {
-		/*
-		 * Optimisations are default off
-		 */
-		if (!(opt_flags & ctx.MAGICMASK_REWRITE))
-			fprintf(stderr, "WARNING: optimisation `--rewrite` not specified\n");
+	/**
+	 * @date 2026-10-17 15:20:41
+	 *
+	 * Per-thread validation state.
+	 * Each worker owns private trees and evaluator, `normaliseNode()` statistics are kept inside the tree.
+	 *
+	 * @typedef {object} worker_t
+	 */
+	struct worker_t {
+		/// @var {validaterewriteContext_t} owning application context
+		validaterewriteContext_t *pApp;
+		/// @var {pthread_t} thread handle
+		pthread_t                thread;
+		/// @var {number} worker id, also used in failure reports
+		unsigned                 threadId;
+		/// @var {baseTree_t} manually constructed tree
+		baseTree_t               *pOrigTree;
+		/// @var {baseTree_t} saved/loaded tree with rewriting
+		baseTree_t               *pTestTree;
+		/// @var {uint64_t[]} evaluator for random patterns
+		uint64_t                 *pEval;
+		/// @var {number} `rand_r()` state for random patterns
+		unsigned                 seed;
+		/// @var {number} random patterns tested
+		uint64_t                 progress;
+		/// @var {number} fixed pattern unit that failed, or `~0` if none
+		unsigned                 failUnit;
+		/// @var {string} failure report
+		std::string              failure;
+	};
 
-		baseTree_t origTree(ctx, KSTART, NSTART, NSTART, NSTART, 1/*numRoots*/, opt_maxNode, opt_flags);
-		baseTree_t testTree(ctx, KSTART, NSTART, NSTART, NSTART, 1/*numRoots*/, opt_maxNode, opt_flags);
+	/// @var {worker_t[]} worker threads
+	worker_t *pWorkers;
+	/// @var {number} outer node combinations of fixed patterns, in serial order
+	std::vector<uint32_t> fixedUnits;
+	/// @var {number} next fixed unit to claim
+	unsigned nextUnit;
+	/// @var {number} lowest failing fixed unit, workers skip units beyond
+	unsigned firstFailUnit;
+	/// @var {number} raised when a random pattern failed
+	volatile unsigned stopRandom;
+
+	/**
+	 * @date 2026-10-17 15:24:18
+	 *
+	 * Validate a single outer node combination against all inner combinations.
+	 * Progress numbering is derived from the unit index so reports match a serial run.
+	 *
+	 * @param {worker_t} pWorker - private worker state
+	 * @param {number} iUnit - index in `fixedUnits[]`
+	 * @return {boolean} `true` if all tests passed
+	 */
+	bool fixedUnit(worker_t *pWorker, unsigned iUnit) {
+		baseTree_t &origTree = *pWorker->pOrigTree;
+		baseTree_t &testTree = *pWorker->pTestTree;
 		uint32_t   slots[NEND];
 
-		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
-			fprintf(stderr, "\r\e[K[%s] Fixed patterns\n", ctx.timeAsString());
-
-		ctx.setupSpeed(1);
-		ctx.tick = 0;
+		const uint32_t Q1  = fixedUnits[iUnit] >> 24 & 0xff;
+		const uint32_t T1u = fixedUnits[iUnit] >> 16 & 0xff;
+		const uint32_t T1i = fixedUnits[iUnit] >> 8 & 0xff;
+		const uint32_t F1  = fixedUnits[iUnit] >> 0 & 0xff;
 
-		/*
-		 * Quick test with (wide) 4-node dyadic / 5-endpoint trees
-		 * Construction direct without use of `normaliseNode()`.
-		 * Save/load using `normaliseNode()`
-		 * Compare results
-		 */
+		uint64_t progress = (uint64_t) iUnit * (NSTART + 1) * (NSTART + 1) * 2 * (NSTART + 1);
 
 		//@formatter:off
-		for (uint32_t Q1 = 0; Q1 < NSTART; Q1++)
-		for (uint32_t T1u=0; T1u<NSTART; T1u++)
-		for (uint32_t T1i = 0; T1i < 2; T1i++)
-		for (uint32_t F1 = 0; F1 < NSTART; F1++) {
+		for (uint32_t Q2 = 0; Q2 < NSTART+1; Q2++)
+		for (uint32_t T2u=0; T2u<NSTART+1; T2u++)
+		for (uint32_t T2i = 0; T2i < 2; T2i++)
+		for (uint32_t F2 = 0; F2 < NSTART+1; F2++) {
 		//@formatter:on
 
+			++progress;
+
 			// validate
-			if (Q1 == 0) continue;                // Q not zero
-			if (Q1 == T1u) continue;              // Q/T collapse
-			if (Q1 == F1) continue;               // Q/F collapse
-			if (T1u == F1 && T1i == 0) continue; // T/F collapse
-			if (T1u == 0 && T1i == 0) continue;  // Q?0:F -> F?!Q:0
-			if (T1u == 0 && F1 == 0) continue;   // Q?!0:0 -> Q
+			if (Q2 == 0) continue;                // Q not zero
+			if (Q2 == T2u) continue;              // Q/T collapse
+			if (Q2 == F2) continue;               // Q/F collapse
+			if (T2u == F2 && T2i == 0) continue; // T/F collapse
+			if (T2u == 0 && T2i == 0) continue;  // Q?0:F -> F?!Q:0
+			if (T2u == 0 && F2 == 0) continue;   // Q?!0:0 -> Q
 
-			//@formatter:off
-			for (uint32_t Q2 = 0; Q2 < NSTART+1; Q2++)
-			for (uint32_t T2u=0; T2u<NSTART+1; T2u++)
-			for (uint32_t T2i = 0; T2i < 2; T2i++)
-			for (uint32_t F2 = 0; F2 < NSTART+1; F2++) {
-			//@formatter:on
+			// nodes must be connected
+			if (Q2 != NSTART && T2u != NSTART && F2 != NSTART)
+				continue;
 
-				++ctx.progress;
+			// construct
+			origTree.N[NSTART + 0].Q = Q1;
+			origTree.N[NSTART + 0].T = T1u ^ (T1i ? IBIT : 0);
+			origTree.N[NSTART + 0].F = F1;
 
-				// validate
-				if (Q2 == 0) continue;                // Q not zero
-				if (Q2 == T2u) continue;              // Q/T collapse
-				if (Q2 == F2) continue;               // Q/F collapse
-				if (T2u == F2 && T2i == 0) continue; // T/F collapse
-				if (T2u == 0 && T2i == 0) continue;  // Q?0:F -> F?!Q:0
-				if (T2u == 0 && F2 == 0) continue;   // Q?!0:0 -> Q
+			origTree.N[NSTART + 1].Q = Q2;
+			origTree.N[NSTART + 1].T = T2u ^ (T2i ? IBIT : 0);
+			origTree.N[NSTART + 1].F = F2;
 
-				// nodes must be connected
-				if (Q2 != NSTART && T2u != NSTART && F2 != NSTART)
-					continue;
+			origTree.roots[0] = NSTART + 1;
+			origTree.ncount = NSTART + 2;
 
-				// construct
-				origTree.N[NSTART + 0].Q = Q1;
-				origTree.N[NSTART + 0].T = T1u ^ (T1i ? IBIT : 0);
-				origTree.N[NSTART + 0].F = F1;
-
-				origTree.N[NSTART + 1].Q = Q2;
-				origTree.N[NSTART + 1].T = T2u ^ (T2i ? IBIT : 0);
-				origTree.N[NSTART + 1].F = F2;
-
-				origTree.roots[0] = NSTART + 1;
-				origTree.ncount = NSTART + 2;
-
-				/*
-				 * Calculate bitmap
-				 */
-				uint32_t origBitmap = 0; // vector containing results indexed by "abcde"
-				uint32_t bix        = 0;
-
-				//@formatter:off
-				for (unsigned a=0; a<2; a++)
-				for (unsigned b=0; b<2; b++)
-				for (unsigned c=0; c<2; c++)
-				for (unsigned d=0; d<2; d++)
-				for (unsigned e=0; e<2; e++) {
-				//@formatter:on
-
-					slots[0] = 0;
-					slots[1] = a;
-					slots[2] = b;
-					slots[3] = c;
-					slots[4] = d;
-					slots[5] = e;
-
-					for (unsigned i = origTree.nstart; i < origTree.ncount; i++) {
-						const baseNode_t *pNode = origTree.N + i;
-						const uint32_t   Q      = slots[pNode->Q];
-						const uint32_t   T      = slots[pNode->T & ~IBIT];
-						const uint32_t   F      = slots[pNode->F];
-
-						if (pNode->T & IBIT) {
-							slots[i] = (~Q & F) ^ (Q & ~T);
-						} else {
-							slots[i] = (~Q & F) ^ (Q & T);
-						}
-					}
+			/*
+			 * Calculate bitmap
+			 */
+			uint32_t origBitmap = 0; // vector containing results indexed by "abcde"
+			uint32_t bix        = 0;
 
-					origBitmap |= slots[origTree.roots[0]] << bix++;
-				}
-				assert(bix == 32);
-
-				std::string origName = origTree.saveString(origTree.roots[0]);
-				if (opt_text)
-					printf("%ld: %08x %-8s ", ctx.progress, origBitmap, origName.c_str());
-
-				/*
-				 * Reload with rewriting
-				 */
-				testTree.rewind();
-				testTree.roots[0] = testTree.loadNormaliseString(origName.c_str());
-
-				/*
-				 * Calculate bitmap
-				 */
-				uint32_t testBitmap = 0;
-				bix = 0;
-
-				//@formatter:off
-				for (unsigned a=0; a<2; a++)
-				for (unsigned b=0; b<2; b++)
-				for (unsigned c=0; c<2; c++)
-				for (unsigned d=0; d<2; d++)
-				for (unsigned e=0; e<2; e++) {
-				//@formatter:on
-
-					slots[0] = 0;
-					slots[1] = a;
-					slots[2] = b;
-					slots[3] = c;
-					slots[4] = d;
-					slots[5] = e;
-
-					for (unsigned i = testTree.nstart; i < testTree.ncount; i++) {
-						const baseNode_t *pNode = testTree.N + i;
-						const uint32_t   Q      = slots[pNode->Q];
-						const uint32_t   T      = slots[pNode->T & ~IBIT];
-						const uint32_t   F      = slots[pNode->F];
-
-						if (pNode->T & IBIT) {
-							slots[i] = (~Q & F) ^ (Q & ~T);
-						} else {
-							slots[i] = (~Q & F) ^ (Q & T);
-						}
-					}
+			//@formatter:off
+			for (unsigned a=0; a<2; a++)
+			for (unsigned b=0; b<2; b++)
+			for (unsigned c=0; c<2; c++)
+			for (unsigned d=0; d<2; d++)
+			for (unsigned e=0; e<2; e++) {
+			//@formatter:on
 
-					testBitmap |= slots[testTree.roots[0]] << bix++;
+				slots[0] = 0;
+				slots[1] = a;
+				slots[2] = b;
+				slots[3] = c;
+				slots[4] = d;
+				slots[5] = e;
+
+				for (unsigned i = origTree.nstart; i < origTree.ncount; i++) {
+					const baseNode_t *pNode = origTree.N + i;
+					const uint32_t   Q      = slots[pNode->Q];
+					const uint32_t   T      = slots[pNode->T & ~IBIT];
+					const uint32_t   F      = slots[pNode->F];
+
+					if (pNode->T & IBIT) {
+						slots[i] = (~Q & F) ^ (Q & ~T);
+					} else {
+						slots[i] = (~Q & F) ^ (Q & T);
+					}
 				}
-				assert(bix == 32);
 
-				if (opt_text) {
-					printf("%08x %-8s ", testBitmap, testTree.saveString(testTree.roots[0]).c_str());
+				origBitmap |= slots[origTree.roots[0]] << bix++;
+			}
+			assert(bix == 32);
 
-					printf("\n");
-				}
+			std::string origName = origTree.saveString(origTree.roots[0]);
+			if (opt_text)
+				printf("%ld: %08x %-8s ", progress, origBitmap, origName.c_str());
 
-				/*
-				 * Compare results
-				 */
-				if (origBitmap != testBitmap) {
-					fprintf(stderr, "fail for %ld: {%d %s%d %d}{%d %s%d %d} -> %s -> %s [lastRewriteIndex=%x]\n",
-						ctx.progress,
-						origTree.N[NSTART + 0].Q,
-						origTree.N[NSTART + 0].T & IBIT ? "~" : "",
-						origTree.N[NSTART + 0].T & ~IBIT,
-						origTree.N[NSTART + 0].F,
-						origTree.N[NSTART + 1].Q,
-						origTree.N[NSTART + 1].T & IBIT ? "~" : "",
-						origTree.N[NSTART + 1].T & ~IBIT,
-						origTree.N[NSTART + 1].F,
-						origName.c_str(),
-						testTree.saveString(testTree.roots[0]).c_str(),
-						gLastRewriteIndex);
-
-					assert(0);
-				}
-			}
-		}
+			/*
+			 * Reload with rewriting
+			 */
+			testTree.rewind();
+			testTree.roots[0] = testTree.loadNormaliseString(origName.c_str());
 
-		/*
-		 * Create evaluator vector for 4n9.
-		 */
+			/*
+			 * Calculate bitmap
+			 */
+			uint32_t testBitmap = 0;
+			bix = 0;
 
-		uint64_t *pEval = (uint64_t *) ctx.myAlloc("pEval", origTree.maxNodes, sizeof(*pEval) * QUADPERFOOTPRINT);
-
-		// set 64bit slice to zero
-		for (unsigned j = 0; j < origTree.maxNodes * QUADPERFOOTPRINT; j++)
-			pEval[j] = 0;
-
-		// set footprint for 64bit slice
-		assert(MAXSLOTS == 9);
-		assert(KSTART == 1);
-		for (unsigned i = 0; i < (1 << MAXSLOTS); i++) {
-			// v[0+(i/64)] should be 0
-			if (i & (1 << 0)) pEval[(KSTART + 0) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
-			if (i & (1 << 1)) pEval[(KSTART + 1) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
-			if (i & (1 << 2)) pEval[(KSTART + 2) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
-			if (i & (1 << 3)) pEval[(KSTART + 3) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
-			if (i & (1 << 4)) pEval[(KSTART + 4) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
-			if (i & (1 << 5)) pEval[(KSTART + 5) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
-			if (i & (1 << 6)) pEval[(KSTART + 6) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
-			if (i & (1 << 7)) pEval[(KSTART + 7) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
-			if (i & (1 << 8)) pEval[(KSTART + 8) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
-		}
+			//@formatter:off
+			for (unsigned a=0; a<2; a++)
+			for (unsigned b=0; b<2; b++)
+			for (unsigned c=0; c<2; c++)
+			for (unsigned d=0; d<2; d++)
+			for (unsigned e=0; e<2; e++) {
+			//@formatter:on
 
-		/*
-		 * Extended test with random nodes
-		 */
+				slots[0] = 0;
+				slots[1] = a;
+				slots[2] = b;
+				slots[3] = c;
+				slots[4] = d;
+				slots[5] = e;
+
+				for (unsigned i = testTree.nstart; i < testTree.ncount; i++) {
+					const baseNode_t *pNode = testTree.N + i;
+					const uint32_t   Q      = slots[pNode->Q];
+					const uint32_t   T      = slots[pNode->T & ~IBIT];
+					const uint32_t   F      = slots[pNode->F];
+
+					if (pNode->T & IBIT) {
+						slots[i] = (~Q & F) ^ (Q & ~T);
+					} else {
+						slots[i] = (~Q & F) ^ (Q & T);
+					}
+				}
 
-		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
-			fprintf(stderr, "\r\e[K[%s] Random patterns [progress(speed) cntRewriteNo cntRewriteYes cntRewriteCollapse cntRewriteTree [cntRewritePower]]\n", ctx.timeAsString());
+				testBitmap |= slots[testTree.roots[0]] << bix++;
+			}
+			assert(bix == 32);
 
-		ctx.setupSpeed(1);
-		ctx.progress = 0;
+			if (opt_text) {
+				printf("%08x %-8s ", testBitmap, testTree.saveString(testTree.roots[0]).c_str());
 
-		for (;;) {
-			++ctx.progress;
+				printf("\n");
+			}
 
-			if (ctx.tick && ctx.opt_verbose >= ctx.VERBOSE_TICK) {
-				int perSecond = ctx.updateSpeed();
+			/*
+			 * Compare results
+			 */
+			if (origBitmap != testBitmap) {
+				char line[512];
 
-				fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) %ld %ld %ld %ld [%ld %ld %ld %ld %ld]", ctx.timeAsString(),
-					ctx.progress, perSecond,
-					gCountRewriteNo, gCountRewriteYes, gCountRewriteCollapse, gCountRewriteTree,
-					gCountRewritePower[0], gCountRewritePower[1], gCountRewritePower[2], gCountRewritePower[3], gCountRewritePower[4]
-				);
+				snprintf(line, sizeof line, "fail for %ld: {%d %s%d %d}{%d %s%d %d} -> %s -> %s [lastRewriteIndex=%x]\n",
+					progress,
+					origTree.N[NSTART + 0].Q,
+					origTree.N[NSTART + 0].T & IBIT ? "~" : "",
+					origTree.N[NSTART + 0].T & ~IBIT,
+					origTree.N[NSTART + 0].F,
+					origTree.N[NSTART + 1].Q,
+					origTree.N[NSTART + 1].T & IBIT ? "~" : "",
+					origTree.N[NSTART + 1].T & ~IBIT,
+					origTree.N[NSTART + 1].F,
+					origName.c_str(),
+					testTree.saveString(testTree.roots[0]).c_str(),
+					testTree.lastRewriteIndex);
 
-				ctx.tick = 0;
+				pWorker->failure = line;
+				return false;
 			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * @date 2026-10-17 15:31:02
+	 *
+	 * Validate random 4-node trees until any worker fails.
+	 * Each worker has its own `rand_r()` sequence, reproducible with the same `--seed` and `--threads`.
+	 *
+	 * @param {worker_t} pWorker - private worker state
+	 * @return {boolean} `false` on failure
+	 */
+	bool randomPatterns(worker_t *pWorker) {
+		baseTree_t &origTree = *pWorker->pOrigTree;
+		baseTree_t &testTree = *pWorker->pTestTree;
+		uint64_t   *pEval    = pWorker->pEval;
+		unsigned   *pSeed    = &pWorker->seed;
+
+		while (!stopRandom) {
+			++pWorker->progress;
 
 			/*
 			 * Generate random origTree
 			 */
-			if ((rand() & 7) == 0) {
-				origTree.N[NSTART + 0].Q = origTree.N[NSTART + 0].T = origTree.N[NSTART + 0].F = rand() % (NSTART + 0);
+			if ((rand_r(pSeed) & 7) == 0) {
+				origTree.N[NSTART + 0].Q = origTree.N[NSTART + 0].T = origTree.N[NSTART + 0].F = rand_r(pSeed) % (NSTART + 0);
 			} else {
-				origTree.N[NSTART + 0].Q = rand() % (NSTART + 0);
-				origTree.N[NSTART + 0].T = rand() % (NSTART + 0);
-				origTree.N[NSTART + 0].F = rand() % (NSTART + 0);
-				if (rand() & 1)
+				origTree.N[NSTART + 0].Q = rand_r(pSeed) % (NSTART + 0);
+				origTree.N[NSTART + 0].T = rand_r(pSeed) % (NSTART + 0);
+				origTree.N[NSTART + 0].F = rand_r(pSeed) % (NSTART + 0);
+				if (rand_r(pSeed) & 1)
 					origTree.N[NSTART + 0].T ^= IBIT;
 
 				if (!isNormalised(origTree.N + NSTART + 0))
 					continue;
 			}
 
-			if ((rand() & 7) == 0) {
-				origTree.N[NSTART + 1].Q = origTree.N[NSTART + 1].T = origTree.N[NSTART + 1].F = rand() % (NSTART + 1);
+			if ((rand_r(pSeed) & 7) == 0) {
+				origTree.N[NSTART + 1].Q = origTree.N[NSTART + 1].T = origTree.N[NSTART + 1].F = rand_r(pSeed) % (NSTART + 1);
 			} else {
-				origTree.N[NSTART + 1].Q = rand() % (NSTART + 1);
-				origTree.N[NSTART + 1].T = rand() % (NSTART + 1);
-				origTree.N[NSTART + 1].F = rand() % (NSTART + 1);
-				if (rand() & 1)
+				origTree.N[NSTART + 1].Q = rand_r(pSeed) % (NSTART + 1);
+				origTree.N[NSTART + 1].T = rand_r(pSeed) % (NSTART + 1);
+				origTree.N[NSTART + 1].F = rand_r(pSeed) % (NSTART + 1);
+				if (rand_r(pSeed) & 1)
 					origTree.N[NSTART + 1].T ^= IBIT;
 
 				if (!isNormalised(origTree.N + NSTART + 1))
 					continue;
 			}
 
-			if ((rand() & 7) == 0) {
-				origTree.N[NSTART + 2].Q = origTree.N[NSTART + 2].T = origTree.N[NSTART + 2].F = rand() % (NSTART + 2);
+			if ((rand_r(pSeed) & 7) == 0) {
+				origTree.N[NSTART + 2].Q = origTree.N[NSTART + 2].T = origTree.N[NSTART + 2].F = rand_r(pSeed) % (NSTART + 2);
 			} else {
-				origTree.N[NSTART + 2].Q = rand() % (NSTART + 2);
-				origTree.N[NSTART + 2].T = rand() % (NSTART + 2);
-				origTree.N[NSTART + 2].F = rand() % (NSTART + 2);
-				if (rand() & 1)
+				origTree.N[NSTART + 2].Q = rand_r(pSeed) % (NSTART + 2);
+				origTree.N[NSTART + 2].T = rand_r(pSeed) % (NSTART + 2);
+				origTree.N[NSTART + 2].F = rand_r(pSeed) % (NSTART + 2);
+				if (rand_r(pSeed) & 1)
 					origTree.N[NSTART + 2].T ^= IBIT;
 
 				if (!isNormalised(origTree.N + NSTART + 2))
@@ -490,7 +497,7 @@ struct validaterewriteContext_t {
 			origTree.N[NSTART + 3].Q = NSTART + 0;
 			origTree.N[NSTART + 3].T = NSTART + 1;
 			origTree.N[NSTART + 3].F = NSTART + 2;
-			if (rand() & 1)
+			if (rand_r(pSeed) & 1)
 				origTree.N[NSTART + 3].T ^= IBIT;
 
 			origTree.roots[0] = NSTART + 3;
@@ -510,7 +517,7 @@ struct validaterewriteContext_t {
 			std::string origName = origTree.saveString(origTree.roots[0]);
 			if (opt_text)
 				printf("%ld: %016lx %016lx %016lx %016lx %016lx %016lx %016lx %016lx %-8s ",
-				       ctx.progress,
+				       pWorker->progress,
 				       origResult[0],
 				       origResult[1],
 				       origResult[2],
@@ -549,8 +556,11 @@ struct validaterewriteContext_t {
 				matches &= origResult[j] == testResult[j];
 
 			if (!matches) {
-				fprintf(stderr, "fail for %ld: {%d %s%d %d}{%d %s%d %d}{%d %s%d %d}{%d %s%d %d} -> %s -> %s [lastRewriteIndex=%x]\n",
-					ctx.progress,
+				char line[1024];
+				int  len;
+
+				len = snprintf(line, sizeof line, "fail for %u:%ld: {%d %s%d %d}{%d %s%d %d}{%d %s%d %d}{%d %s%d %d} -> %s -> %s [lastRewriteIndex=%x]\n",
+					pWorker->threadId, pWorker->progress,
 					origTree.N[NSTART + 0].Q,
 					origTree.N[NSTART + 0].T & IBIT ? "~" : "",
 					origTree.N[NSTART + 0].T & ~IBIT,
@@ -569,16 +579,265 @@ struct validaterewriteContext_t {
 					origTree.N[NSTART + 3].F,
 					origName.c_str(),
 					testTree.saveString(testTree.roots[0]).c_str(),
-					gLastRewriteIndex);
-				fprintf(stderr, "origResult: %016lx %016lx %016lx %016lx %016lx %016lx %016lx %016lx\n",
+					testTree.lastRewriteIndex);
+				len += snprintf(line + len, sizeof line - len, "origResult: %016lx %016lx %016lx %016lx %016lx %016lx %016lx %016lx\n",
 					origResult[0], origResult[1], origResult[2], origResult[3], origResult[4], origResult[5], origResult[6], origResult[7]);
-				fprintf(stderr, "testResult: %016lx %016lx %016lx %016lx %016lx %016lx %016lx %016lx\n",
+				snprintf(line + len, sizeof line - len, "testResult: %016lx %016lx %016lx %016lx %016lx %016lx %016lx %016lx\n",
 					testResult[0], testResult[1], testResult[2], testResult[3], testResult[4], testResult[5], testResult[6], testResult[7]);
 
-				assert(0);
+				pWorker->failure = line;
+				stopRandom = 1;
+				__sync_synchronize();
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	/**
+	 * @date 2026-10-17 15:36:50
+	 *
+	 * Worker entry for fixed patterns.
+	 * Units are claimed in increasing order, units beyond a known failure are skipped.
+	 * Because all lower units are still completed, the lowest failing unit is exactly the one a serial run reports.
+	 */
+	static void *fixedEntry(void *arg) {
+		worker_t                 *pWorker = (worker_t *) arg;
+		validaterewriteContext_t *pApp    = pWorker->pApp;
+
+		for (;;) {
+			unsigned iUnit = __sync_fetch_and_add(&pApp->nextUnit, 1);
+			if (iUnit >= pApp->fixedUnits.size() || iUnit > pApp->firstFailUnit)
+				break;
+
+			if (!pApp->fixedUnit(pWorker, iUnit)) {
+				pWorker->failUnit = iUnit;
+
+				// lower the bar
+				unsigned old;
+				while (iUnit < (old = pApp->firstFailUnit))
+					__sync_bool_compare_and_swap(&pApp->firstFailUnit, old, iUnit);
+				break;
+			}
+		}
+
+		return NULL;
+	}
+
+	/**
+	 * @date 2026-10-17 15:37:44
+	 *
+	 * Worker entry for random patterns.
+	 */
+	static void *randomEntry(void *arg) {
+		worker_t *pWorker = (worker_t *) arg;
+
+		pWorker->pApp->randomPatterns(pWorker);
+		return NULL;
+	}
+
+	/**
+	 * @date 2026-10-17 15:39:12
+	 *
+	 * Start all workers and wait for them to finish
+	 *
+	 * @param {function} entry - worker entry point
+	 * @param {boolean} ticker - display progress while waiting
+	 */
+	void runWorkers(void *(*entry)(void *), bool ticker) {
+		for (unsigned iThread = 0; iThread < opt_threads; iThread++) {
+			int ret = pthread_create(&pWorkers[iThread].thread, NULL, entry, pWorkers + iThread);
+			if (ret)
+				ctx.fatal("\n{\"error\":\"pthread_create() failed\",\"where\":\"%s:%s:%d\",\"return\":%d}\n",
+					  __FUNCTION__, __FILE__, __LINE__, ret);
+		}
+
+		if (ticker) {
+			while (!stopRandom) {
+				usleep(100000);
+
+				if (ctx.tick && ctx.opt_verbose >= ctx.VERBOSE_TICK) {
+					uint64_t cntNo = 0, cntYes = 0, cntCollapse = 0, cntTree = 0, cntPower[5] = {0};
+
+					// NOTE: racy reads, display only
+					ctx.progress = 0;
+					for (unsigned iThread = 0; iThread < opt_threads; iThread++) {
+						const baseTree_t *pTree = pWorkers[iThread].pTestTree;
+
+						ctx.progress += pWorkers[iThread].progress;
+						cntNo += pTree->cntRewriteNo;
+						cntYes += pTree->cntRewriteYes;
+						cntCollapse += pTree->cntRewriteCollapse;
+						cntTree += pTree->cntRewriteTree;
+						for (unsigned j = 0; j < 5; j++)
+							cntPower[j] += pTree->cntRewritePower[j];
+					}
+
+					int perSecond = ctx.updateSpeed();
+
+					fprintf(stderr, "\r\e[K[%s] %lu(%7d/s) %ld %ld %ld %ld [%ld %ld %ld %ld %ld]", ctx.timeAsString(),
+						ctx.progress, perSecond,
+						cntNo, cntYes, cntCollapse, cntTree,
+						cntPower[0], cntPower[1], cntPower[2], cntPower[3], cntPower[4]
+					);
+
+					ctx.tick = 0;
+				}
 			}
 		}
 
+		for (unsigned iThread = 0; iThread < opt_threads; iThread++)
+			pthread_join(pWorkers[iThread].thread, NULL);
+	}
+
+	void main(void) {
+		/*
+		 * Optimisations are default off
+		 */
+		if (!(opt_flags & ctx.MAGICMASK_REWRITE))
+			fprintf(stderr, "WARNING: optimisation `--rewrite` not specified\n");
+
+		/*
+		 * Text output is ordered, keep it single threaded
+		 */
+		if (opt_text || opt_threads < 1)
+			opt_threads = 1;
+
+		/*
+		 * Create private trees per worker.
+		 * NOTE: allocate from main thread, `myAlloc()` is not thread-safe
+		 */
+		pWorkers = new worker_t[opt_threads];
+
+		for (unsigned iThread = 0; iThread < opt_threads; iThread++) {
+			worker_t *pWorker = pWorkers + iThread;
+
+			pWorker->pApp      = this;
+			pWorker->threadId  = iThread;
+			pWorker->pOrigTree = new baseTree_t(ctx, KSTART, NSTART, NSTART, NSTART, 1/*numRoots*/, opt_maxNode, opt_flags);
+			pWorker->pTestTree = new baseTree_t(ctx, KSTART, NSTART, NSTART, NSTART, 1/*numRoots*/, opt_maxNode, opt_flags);
+			pWorker->pEval     = (uint64_t *) ctx.myAlloc("pEval", pWorker->pOrigTree->maxNodes, sizeof(*pWorker->pEval) * QUADPERFOOTPRINT);
+			pWorker->seed      = rand();
+			pWorker->progress  = 0;
+			pWorker->failUnit  = ~0U;
+		}
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "\r\e[K[%s] Fixed patterns threads=%u\n", ctx.timeAsString(), opt_threads);
+
+		ctx.setupSpeed(1);
+		ctx.tick = 0;
+
+		/*
+		 * Quick test with (wide) 4-node dyadic / 5-endpoint trees
+		 * Construction direct without use of `normaliseNode()`.
+		 * Save/load using `normaliseNode()`
+		 * Compare results
+		 *
+		 * Outer node combinations are the units of work.
+		 */
+
+		//@formatter:off
+		for (uint32_t Q1 = 0; Q1 < NSTART; Q1++)
+		for (uint32_t T1u=0; T1u<NSTART; T1u++)
+		for (uint32_t T1i = 0; T1i < 2; T1i++)
+		for (uint32_t F1 = 0; F1 < NSTART; F1++) {
+		//@formatter:on
+
+			// validate
+			if (Q1 == 0) continue;                // Q not zero
+			if (Q1 == T1u) continue;              // Q/T collapse
+			if (Q1 == F1) continue;               // Q/F collapse
+			if (T1u == F1 && T1i == 0) continue; // T/F collapse
+			if (T1u == 0 && T1i == 0) continue;  // Q?0:F -> F?!Q:0
+			if (T1u == 0 && F1 == 0) continue;   // Q?!0:0 -> Q
+
+			fixedUnits.push_back(Q1 << 24 | T1u << 16 | T1i << 8 | F1);
+		}
+
+		nextUnit      = 0;
+		firstFailUnit = ~0U;
+		runWorkers(fixedEntry, false);
+
+		if (firstFailUnit != ~0U) {
+			for (unsigned iThread = 0; iThread < opt_threads; iThread++) {
+				if (pWorkers[iThread].failUnit == firstFailUnit)
+					fputs(pWorkers[iThread].failure.c_str(), stderr);
+			}
+			assert(0);
+		}
+
+		/*
+		 * Merge statistics, sums are independent of scheduling
+		 */
+		ctx.progress = (uint64_t) fixedUnits.size() * (NSTART + 1) * (NSTART + 1) * 2 * (NSTART + 1);
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_SUMMARY) {
+			uint64_t cntNo = 0, cntYes = 0, cntCollapse = 0, cntTree = 0;
+
+			for (unsigned iThread = 0; iThread < opt_threads; iThread++) {
+				const baseTree_t *pTree = pWorkers[iThread].pTestTree;
+
+				cntNo += pTree->cntRewriteNo;
+				cntYes += pTree->cntRewriteYes;
+				cntCollapse += pTree->cntRewriteCollapse;
+				cntTree += pTree->cntRewriteTree;
+			}
+
+			fprintf(stderr, "\r\e[K[%s] {\"progress\":%lu,\"cntRewriteNo\":%lu,\"cntRewriteYes\":%lu,\"cntRewriteCollapse\":%lu,\"cntRewriteTree\":%lu}\n",
+				ctx.timeAsString(), ctx.progress, cntNo, cntYes, cntCollapse, cntTree);
+		}
+
+		/*
+		 * Create evaluator vector for 4n9.
+		 */
+
+		for (unsigned iThread = 0; iThread < opt_threads; iThread++) {
+			uint64_t *pEval = pWorkers[iThread].pEval;
+
+			// set 64bit slice to zero
+			for (unsigned j = 0; j < pWorkers[iThread].pOrigTree->maxNodes * QUADPERFOOTPRINT; j++)
+				pEval[j] = 0;
+
+			// set footprint for 64bit slice
+			assert(MAXSLOTS == 9);
+			assert(KSTART == 1);
+			for (unsigned i = 0; i < (1 << MAXSLOTS); i++) {
+				// v[0+(i/64)] should be 0
+				if (i & (1 << 0)) pEval[(KSTART + 0) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
+				if (i & (1 << 1)) pEval[(KSTART + 1) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
+				if (i & (1 << 2)) pEval[(KSTART + 2) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
+				if (i & (1 << 3)) pEval[(KSTART + 3) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
+				if (i & (1 << 4)) pEval[(KSTART + 4) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
+				if (i & (1 << 5)) pEval[(KSTART + 5) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
+				if (i & (1 << 6)) pEval[(KSTART + 6) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
+				if (i & (1 << 7)) pEval[(KSTART + 7) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
+				if (i & (1 << 8)) pEval[(KSTART + 8) * QUADPERFOOTPRINT + (i / 64)] |= 1LL << (i % 64);
+			}
+		}
+
+		/*
+		 * Extended test with random nodes
+		 */
+
+		if (ctx.opt_verbose >= ctx.VERBOSE_ACTIONS)
+			fprintf(stderr, "\r\e[K[%s] Random patterns [progress(speed) cntRewriteNo cntRewriteYes cntRewriteCollapse cntRewriteTree [cntRewritePower]]\n", ctx.timeAsString());
+
+		ctx.setupSpeed(1);
+		ctx.progress = 0;
+
+		stopRandom = 0;
+		runWorkers(randomEntry, true);
+
+		// report failure of lowest worker, workers stopping on the raised flag have no failure
+		for (unsigned iThread = 0; iThread < opt_threads; iThread++) {
+			if (!pWorkers[iThread].failure.empty()) {
+				fputs(pWorkers[iThread].failure.c_str(), stderr);
+				break;
+			}
+		}
+		assert(0);
 	}
 
 };
@@ -622,6 +881,7 @@ void usage(char *const *argv, bool verbose) {
 		fprintf(stderr, "\t-q --quiet\n");
 		fprintf(stderr, "\t-n --seed=<seed> [default=%d]\n", app.opt_seed);
 		fprintf(stderr, "\t   --text\n");
+		fprintf(stderr, "\t   --threads=<number> [default=%u]\n", app.opt_threads);
 		fprintf(stderr, "\t   --timer=<seconds> [default=%d]\n", ctx.opt_timer);
 		fprintf(stderr, "\t-v --verbose\n");
 
@@ -643,7 +903,7 @@ int main(int argc, char *argv[]) {
 
 	for (;;) {
 		enum {
-			LO_HELP     = 1, LO_DEBUG, LO_MAXNODE, LO_TIMER, LO_TEXT, LO_SEED,
+			LO_HELP     = 1, LO_DEBUG, LO_MAXNODE, LO_TIMER, LO_TEXT, LO_SEED, LO_THREADS,
 			LO_PARANOID, LO_NOPARANOID, LO_PURE, LO_NOPURE, LO_REWRITE, LO_NOREWRITE, LO_CASCADE, LO_NOCASCADE, LO_SHRINK, LO_NOSHRINK, LO_PIVOT3, LO_NOPIVOT3,
 			LO_DATABASE = 'D', LO_QUIET = 'q', LO_VERBOSE = 'v'
 		};
@@ -657,6 +917,7 @@ int main(int argc, char *argv[]) {
 			{"quiet",       2, 0, LO_QUIET},
 			{"seed",        1, 0, LO_SEED},
 			{"text",        0, 0, LO_TEXT},
+			{"threads",     1, 0, LO_THREADS},
 			{"timer",       1, 0, LO_TIMER},
 			{"verbose",     2, 0, LO_VERBOSE},
 			//
@@ -716,6 +977,9 @@ int main(int argc, char *argv[]) {
 		case LO_TEXT:
 			app.opt_text++;
 			break;
+		case LO_THREADS:
+			app.opt_threads = (unsigned) strtoul(optarg, NULL, 10);
+			break;
 		case LO_TIMER:
 			ctx.opt_timer = (unsigned) strtoul(optarg, NULL, 10);
 			break;